@@ -37,4 +37,51 @@ window.addEventListener('scroll', () => {
     }
 });
 
+
+// Tablero Jugable: si la Página la Sirve `memorama --serve`, el Tablero de Demostración se Conecta al Motor por WebSocket
+const boardGrid = document.querySelector('.bd-grid');                                           // Cuadrícula del Tablero de Demostración
+const boardTitle = document.querySelector('.board-demo-title');                                 // Título donde se Muestran Turno y Puntos
+const boardColors = ['#e53935', '#fb8c00', '#fdd835', '#43a047', '#1e88e5', '#00897b', '#8e24aa', '#f06292', '#6d4c41',
+                     '#c0ca33', '#3949ab', '#d81b60', '#00acc1', '#7cb342', '#5e35b1', '#ff7043', '#546e7a', '#ffb300'];
+if (boardGrid && location.protocol.startsWith('http')) {                                         // Solo Servida por HTTP (no al Abrir el Archivo)
+    const socket = new WebSocket(`${location.protocol === 'https:' ? 'wss' : 'ws'}://${location.host}/ws`);
+    socket.binaryType = 'arraybuffer';                                                           // Mensajes Binarios: Encabezado de 10 Bytes + Carga
+    const cells = [];                                                                            // Celdas del Tablero (Posición = Fila * 6 + Columna)
+    const seats = location.hash === '#rival' ? 1 : 2;                                            // #rival: Buscar un Rival en vez de Jugar ambos Turnos
+    let seat = 0;                                                                                // Asiento Propio Contra un Rival (0: Ambos)
+    let points = [0, 0];                                                                         // Puntos de cada Jugador
+    const paint = (position, letter) => {                                                        // Pintar una Celda: Oculta (X) o con su Letra
+        const cell = cells[position];
+        cell.textContent = String.fromCharCode(letter);
+        cell.className = letter === 88 ? 'bd-cell bd-x' : 'bd-cell';
+        cell.style.background = letter === 88 ? '' : boardColors[letter - 65];
+        cell.style.color = letter === 67 ? '#111' : '';
+    };
+    socket.addEventListener('open', () => {                                                      // Conectado: Reemplazar la Demostración por Celdas Vivas
+        boardGrid.innerHTML = '';
+        for (let position = 0; position < 36; position++) {
+            const cell = document.createElement('div');
+            cell.style.cursor = 'pointer';
+            cell.addEventListener('click', () => socket.send(new Uint8Array([points[0] + points[1] === 18 ? 255 : position])));
+            boardGrid.appendChild(cell);
+            cells.push(cell);
+        }
+        socket.send(new Uint8Array([254, seats]));                                               // Saludo de Juego: Asientos (sin Nombres)
+        if (seats === 1) boardTitle.textContent = 'Buscando rival…';
+    });
+    socket.addEventListener('message', (event) => {                                              // Estado Completo (Tipo 1) o Diferencias (Tipos 2 y 3)
+        const bytes = new Uint8Array(event.data);
+        if (bytes[0] === 4) { seat = bytes[1]; return; }                                         // Asiento Contra un Rival (Tipo 4)
+        points = [bytes[2], bytes[3]];
+        if (bytes[0] === 1) for (let position = 0; position < 36; position++) paint(position, bytes[10 + position]);
+        else for (let change = 0; change < bytes[10]; change++) paint(bytes[11 + 2 * change], bytes[12 + 2 * change]);
+        boardTitle.textContent = points[0] + points[1] === 18
+            ? `Fin de la partida ${points[0]} - ${points[1]} · Clic para jugar de nuevo`
+            : `Turno del Jugador ${bytes[1]}${seat === bytes[1] ? ' (tú)' : ''} · ${points[0]} - ${points[1]}`;
+    });
+    socket.addEventListener('close', (event) => {                                                // 1001: el Rival se Fue
+        boardTitle.textContent = event.code === 1001 ? 'El rival se fue · Recarga para jugar de nuevo' : 'Conexión cerrada · Recarga para jugar de nuevo';
+    });
+}
+
 /*****************************************************************************************************************************************************************************/
\ No newline at end of file
@@ -20,6 +20,28 @@
 #include <thread>         // Librería para Hilos de Ejecución
 #include <algorithm>      // Librería para Algoritmos Estándar
 #include <limits>         // Librería para Límites Numéricos
+#include <array>          // Inclusión del Tipo de Dato Arreglo Fijo
+#include <random>         // Librería para Generadores Pseudoaleatorios
+#include <cstdint>        // Librería para Enteros de Tamaño Fijo
+#include <cstdio>         // Librería para Formateo de Cadenas
+#include <cstring>        // Librería para Cadenas de C
+#include <cmath>          // Librería para Funciones Matemáticas
+#include <fstream>        // Librería para Archivos
+#include <filesystem>     // Librería para Directorios
+#include <stdexcept>      // Librería para Excepciones Estándar
+#include <atomic>         // Librería para Variables Atómicas
+#include <mutex>          // Librería para Exclusión Mutua
+#include <condition_variable> // Librería para Variables de Condición
+#include <map>            // Inclusión del Tipo de Dato Mapa Ordenado
+#include <charconv>       // Librería para Conversión de Números a Texto
+#include <type_traits>    // Librería para Rasgos de Tipos
+#include <cerrno>         // Librería para Códigos de Error
+#include <sstream>        // Librería para Flujos sobre Cadenas
+#include <functional>     // Librería para Objetos Función
+#include <set>            // Inclusión del Tipo de Dato Conjunto Ordenado
+#include <memory>         // Librería para Apuntadores Compartidos
+#include <unordered_map>  // Inclusión del Tipo de Dato Tabla de Dispersión
+#include <cctype>         // Librería para Clasificar Caracteres
 
 // =====================================================================================================================================
 // -------------------------------------------------------------- Alías ----------------------------------------------------------------
@@ -31,6 +53,8 @@ using seconds = std::chrono::seconds;
 // -------------------------------------------------------------- Constantes ----------------------------------------------------------------
 
 const std::streamsize MAX_LIMIT = std::numeric_limits<std::streamsize>::max();   /// Constante para el Límite Máximo de un Stream
+const int CARD_COUNT = 36;                                                        /// Número de Cartas del Tablero
+const int PAIR_COUNT = 18;                                                        /// Número de Pares del Tablero
 
 // =====================================================================================================================================
 // -------------------------------------------------------------- Sistema Operativo ----------------------------------------------
@@ -38,180 +62,165 @@ const std::streamsize MAX_LIMIT = std::numeric_limits<std::streamsize>::max();
 /// Detectar el Sistema Operativo
 #ifdef _WIN32                          // Windows
     #include <windows.h>               // Librería de Windows
+    #include <io.h>                    // Librería para Descriptores de Archivo
     #define IS_WINDOWS true            // Definir Constante para Windows
 #else                                  // POSIX (Linux, macOS)
     #include <unistd.h>                // Librería de POSIX
     #include <term.h>                  // Librería de Terminal POSIX
     #include <cstdlib>                 // Librería Estándar de C
+    #include <fcntl.h>                 // Librería para Abrir Archivos POSIX
+    #include <sys/mman.h>              // Librería para Proyectar Archivos en Memoria
+    #include <sys/stat.h>              // Librería para Información de Archivos
+    #include <sys/ioctl.h>             // Librería para el Tamaño de la Terminal
+    #include <csignal>                 // Librería para Señales
+    #include <sys/socket.h>            // Librería de Sockets
+    #include <sys/un.h>                // Librería para Sockets Unix
+    #include <poll.h>                  // Librería para Esperar Varios Descriptores
+    #include <netinet/in.h>            // Librería para Direcciones de Internet
+    #include <netinet/tcp.h>           // Librería para Opciones de TCP
+    #include <netdb.h>                 // Librería para Resolver Direcciones
+    #include <sys/wait.h>              // Librería para Esperar Procesos Hijos
+    #include <sys/resource.h>          // Librería para Límites del Proceso
+    #include <sys/file.h>              // Librería para Bloquear Archivos entre Procesos
+    #ifdef __linux__
+        #include <sys/sendfile.h>      // Librería para Enviar Archivos sin Copias
+        #include <sys/timerfd.h>       // Librería para Temporizadores como Descriptores
+        #include <sys/epoll.h>         // Librería para Esperar Muchos Descriptores
+    #endif
+    #ifndef MSG_NOSIGNAL                   // macOS: se Ignora SIGPIPE al Transmitir
+        #define MSG_NOSIGNAL 0
+    #endif
     #define IS_WINDOWS false           // Definir Constante para POSIX
 #endif              
 
 // =====================================================================================================================================
-// -------------------------------------------------------------- Funciones Cross-Platform ----------------------------------------------
-
-/**
- * @brief Función para Limpiar la Pantalla (Multiplataforma)
- */
-void clearScreen(){
+// -------------------------------------------------------------- Grabación de Sesiones -------------------------------------------------
 
-    /*
-       - Función: Limpiar Pantalla
-       - Argumentos: Ninguno 
-       - Retorno: Ninguno
-       - Objetivo: Limpiar la Pantalla de la Consola
-    */
+const char RECORD_MAGIC[8] = {'M', 'E', 'M', 'R', 'E', 'C', '0', '1'};          /// Firma de un Archivo de Grabación
+const size_t RECORD_BLOCK = 65536;                                                /// Bytes de Registros por Bloque Comprimido
+const size_t RECORD_BLOCK_LIMIT = 64u << 20;                                      /// Bloque más Grande que Acepta el Reproductor
+const int RECORD_DRAIN_MS = 50;                                                   /// Milisegundos entre Codificaciones
+const int RECORD_FLUSH_MS = 1000;                                                 /// Bloque Parcial a Disco al menos cada Segundo
+const size_t RECORD_SHARED_LINE = 16;                                             /// Largo Mínimo de una Línea del Diccionario
+const size_t RECORD_DICTIONARY = 65536;                                           /// Entradas Máximas del Diccionario
+const size_t RECORD_PENDING = 1u << 20;                                           /// Bytes Reservados para los Cuadros por Codificar
 
-    /// Limpiar Pantalla
-    #ifdef _WIN32                                                    // Windows
-        system("cls");                                               // Comando para Limpiar Pantalla en Windows
-    #else                                                            // POSIX (Linux, macOS)
-        if (system("clear") != 0) std::cout << "\033[2J\033[1;1H";   // Comando para Limpiar Pantalla en POSIX
-    #endif
+/// Enumeración: Codificación de una Línea respecto a lo ya Grabado
+enum RecordLine : uint8_t {
 
-}
+    LINE_SAME = 0,                               // Igual a la Misma Línea del Cuadro Anterior
+    LINE_SHARED = 1,                             // Entrada del Diccionario (Portada, Bordes, Menús)
+    LINE_DIFF = 2,                               // Prefijo y Sufijo de la Línea Anterior con Otro Centro
+    LINE_LITERAL = 3                             // Bytes Completos
 
+};
 
+/// Estructura: Cuadro Entregado por la Salida (Pendiente de Codificar)
+struct RecordedFrame {
 
+    uint64_t micros;                             // Microsegundos desde el Inicio de la Grabación
+    std::string bytes;                           // Bytes Escritos en la Terminal
 
-/**
- * @brief Función para Establecer Color de Texto (Multiplataforma)
- * @param colorCode Código de color (Windows: 0-15, POSIX: códigos ANSI)
- */
-void setConsoleColor(int colorCode){
-    
-    /*
-       - Función: Establecer Color de Texto
-       - Argumentos: 
-            - colorCode (int): Código de Color
-       - Retorno: Ninguno
-       - Objetivo: Establecer el Color de Texto en la Consola
-    */
-    
-    /// Establecer Color de Texto
-    #ifdef _WIN32                                                   // Windows
-        HANDLE handleConsole = GetStdHandle(STD_OUTPUT_HANDLE);     // Obtener el Handle de la Consola
-        SetConsoleTextAttribute(handleConsole, colorCode);          // Establecer Color en Windows
-    #else                                                           // POSIX (Linux, macOS)
+};
 
-        /// Códigos ANSI para colores básicos
-        const char* ANSI_COLORS[] = {
-            
-            "\033[0;30m",                          // 0: Negro
-            "\033[0;34m",                          // 1: Azul
-            "\033[0;32m",                          // 2: Verde
-            "\033[0;36m",                          // 3: Cian
-            "\033[0;31m",                          // 4: Rojo
-            "\033[0;35m",                          // 5: Magenta
-            "\033[0;33m",                          // 6: Amarillo
-            "\033[0;37m",                          // 7: Blanco
-            "\033[1;30m",                          // 8: Gris
-            "\033[1;34m",                          // 9: Azul Claro
-            "\033[1;32m",                          // 10: Verde Claro
-            "\033[1;36m",                          // 11: Cian Claro
-            "\033[1;31m",                          // 12: Rojo Claro
-            "\033[1;35m",                          // 13: Magenta Claro
-            "\033[1;33m",                          // 14: Amarillo Claro
-            "\033[1;37m"                           // 15: Blanco Brillante
+/// Estructura: Estado de Codificación (el Grabador y el Reproductor lo Avanzan Igual)
+struct LineCodec {
 
-        };
-        
-        /// Establecer Color si el Código es Válido
-        if (colorCode >= 0 && colorCode < 16) std::cout << ANSI_COLORS[colorCode];
-        
-    #endif
+    std::vector<std::string> previous;           // Líneas del Cuadro Anterior
+    std::vector<std::string> shared;             // Diccionario de Líneas por Contenido
+    std::unordered_map<uint64_t, uint32_t> index; // Huella -> Entrada del Diccionario
+    uint64_t lastMicros = 0;                     // Marca del Cuadro Anterior
 
-}
+};
 
+/// Estructura: Resumen de una Grabación
+struct RecordStats {
 
+    uint64_t frames = 0;                         // Cuadros Grabados
+    uint64_t rawBytes = 0;                       // Bytes que se Escribieron en la Terminal
+    uint64_t storedBytes = 0;                    // Bytes en el Archivo (con Encabezados)
+    uint64_t kinds[4] = {0, 0, 0, 0};            // Líneas por Codificación (RecordLine)
+    uint64_t encodeMicros = 0;                   // Tiempo del Hilo Codificando y Comprimiendo
 
+};
 
-/**
- * @brief Función para Emitir un Sonido (Beep) - Multiplataforma
- */
-void playBeep(){
+/// Estructura: Grabador (la Salida Entrega Cuadros y un Hilo los Codifica)
+struct Recorder {
 
-    /*
-       - Función: Emitir Sonido
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Emitir un Sonido (Beep) en la Consola
-    */
+    std::mutex lock;                             // Protege pending
+    std::string pending;                         // Cuadros por Codificar, Seguidos (Marca, Largo y Bytes de Cada Uno)
+    std::atomic<bool> running{true};             // Indica si el Hilo Sigue Activo
+    std::chrono::steady_clock::time_point start; // Inicio de la Grabación
+    std::FILE* file = nullptr;                   // Archivo de Salida
+    std::thread thread;                          // Hilo de Codificación
+    LineCodec codec;                             // Estado del Codificador (Solo el Hilo)
+    std::string records;                         // Registros sin Comprimir del Bloque Actual (Solo el Hilo)
+    RecordStats stats;                           // Resumen (Solo el Hilo)
 
-    /// Emitir Sonido
-    #ifdef _WIN32                          // Windows
-        Beep(750, 300);                    // Frecuencia de 750 Hz durante 300 ms
-    #else                                  // POSIX (Linux, macOS)
-        std::cout << '\a' << std::flush;   // Emitir sonido de alerta
-    #endif
+};
 
-}
+Recorder* recorder = nullptr;                                                     /// Grabación Activa (nullptr si no se Graba)
 
 
 
 
 /**
- * @brief Función para Pausar la Ejecución - Multiplataforma
+ * @brief Función que Calcula la Huella FNV-1a de una Línea.
+ * @param line (std::string): La Línea.
+ * @return (uint64_t) Huella.
  */
-void pauseExecution() {
-    
-    /*
-       - Función: Emitir Sonido
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Emitir un Sonido (Beep) en la Consola
-    */
+inline uint64_t lineHash(const std::string& line){
 
-    /// Pausar Ejecución
-    #ifdef _WIN32                                                            // Windows
-        system("pause");                                                     // Comando para Pausar en Windows
-    #else                                                                    // POSIX (Linux, macOS)
-        std::cout << "Presiona Enter para continuar...";                     // Mensaje para el Usuario
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');  // Esperar Entrada del Usuario
-        std::cin.get();                                                      // Esperar Enter
-    #endif
+    /// Un Byte a la Vez
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char byte : line) hash = (hash ^ byte) * 1099511628211ULL;
+    return hash;
 
 }
 
-// =====================================================================================================================================
-// -------------------------------------------------------------- Helpers ----------------------------------------------------------------
+
+
 
 /**
- * @brief Función que Espera una Cantidad de Segundos Específica.
- * @param seconds (int): La Cantidad de Segundos a Esperar.
+ * @brief Función que Agrega un Entero sin Signo de Longitud Variable (7 Bits por Byte).
+ * @param out (std::string): Destino.
+ * @param value (uint64_t): Valor.
  */
-inline void waitSeconds(int seconds){std::this_thread::sleep_for(std::chrono::seconds(seconds));}
+inline void putVarint(std::string& out, uint64_t value){
 
+    /// Bit Alto Encendido: Siguen más Bytes
+    while (value >= 0x80){
 
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
 
+    }
+    out.push_back(static_cast<char>(value));
 
-/**
- * @brief Función que Espera una Cantidad de Milisegundos Específica.
- * @param milliseconds (int): La Cantidad de Milisegundos a Esperar.
- */
-inline void waitMilliseconds(int milliseconds){std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));}
+}
 
 
 
 
 /**
- * @brief Función que Imprime un Mensaje de Error utilizando una Función de Error.
- * @param errorFunction (void(*)()): La Función de Error a Imprimir.
+ * @brief Función que Lee un Entero de Longitud Variable.
+ * @param in (std::string): Origen.
+ * @param at (size_t): Posición de Lectura (Avanza).
+ * @param value (uint64_t): Valor Leído.
+ * @return (bool) Falso si el Origen Termina a la Mitad o el Valor no Cabe.
  */
-void printError(void(*errorFunction)()){
+inline bool takeVarint(const std::string& in, size_t& at, uint64_t& value){
 
-    /*
-       - Función: Imprimir Error
-       - Argumentos:
-            - errorFunction (void(*)()): Función de Error a Imprimir 
-       - Retorno: Ninguno
-       - Objetivo: Imprimir un Mensaje de Error utilizando una Función de Error
-    */
+    /// Hasta Diez Bytes
+    value = 0;
+    for (int shift = 0; shift < 64 && at < in.size(); shift += 7){
 
-    /// Impresión de Mensaje de Error
-    clearScreen();                  // Limpiar Pantalla
-    errorFunction();                // Llamar a la Función de Error
-    waitSeconds(2);                 // Esperar 2 Segundos
-    clearScreen();                  // Limpiar Pantalla
+        uint8_t byte = static_cast<uint8_t>(in[at++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+
+    }
+    return false;
 
 }
 
@@ -219,125 +228,161 @@ void printError(void(*errorFunction)()){
 
 
 /**
- * @brief Función que Verifica que un Entero sea Positivo
- * @param intValue (int): El Entero a Validar.
- * @throw std::out_of_range Si el Entero no es Positivo.
+ * @brief Función que Agrega una Longitud de Secuencia (Extensión en Bytes de 255).
+ * @param out (std::string): Destino.
+ * @param length (size_t): Lo que Excede al Nibble.
  */
-void validatePositiveInt(int intValue) {
-
-    /*
-       - Función: Validar Entero Positivo
-       - Argumentos:
-            - intValue (int): Valor a Validar 
-       - Retorno: Ninguno
-       - Objetivo: Validar que un Entero sea Positivo
-    */
-
-    /// Verificar que el Entero sea Positivo
-    if (intValue < 0) throw std::out_of_range("El Valor debe ser un Entero Positivo");
-
-}
+inline void putRunLength(std::string& out, size_t length){
 
-// =====================================================================================================================================
-// -------------------------------------------------------------- Renders ----------------------------------------------------------------
+    /// 255 Indica que Sigue Otro Byte
+    while (length >= 255){
 
-/// Función: Portada del Juego
-void titleCover(){
-    
-    /*
-       - Función: Portada del Juego
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Memorama en Arte ASCII
-    */
+        out.push_back(static_cast<char>(255));
+        length -= 255;
 
-    // Impresión de Portada del Juego
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *          **   **  *****  **   **  *****  *****   ***   **   **  ***            * \n";
-    std::cout << "                      *          * * * *  *      * * * *  *   *  *   *  *   *  * * * * *   *           * \n";
-    std::cout << "                      *          *  *  *  ****   *  *  *  *   *  ****   *****  *  *  * *****           * \n";
-    std::cout << "                      *          *     *  *      *     *  *   *  *   *  *   *  *     * *   *           * \n";
-    std::cout << "                      *          *     *  *****  *     *  *****  *   *  *   *  *     * *   *           * \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      ********************************************************************************** \n";
+    }
+    out.push_back(static_cast<char>(length));
 
 }
 
 
 
 
-/// Función: Error de Rango
-void rangeError(){
+/**
+ * @brief Función que Comprime un Bloque con LZ77 (Secuencias al Estilo LZ4).
+ * @param raw (std::string): Bytes Originales.
+ * @return (std::string) Bloque Comprimido.
+ */
+std::string packBlock(const std::string& raw){
 
     /*
-       - Función: Error de Rango
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa un Valor Fuera de Rango
+       - Función: Comprimir Bloque
+       - Argumentos:
+            - raw (std::string): Bytes Originales
+       - Retorno: Bloque Comprimido
+       - Objetivo: Cada Secuencia es un Byte de Control (Nibble Alto: Literales, Nibble Bajo: Coincidencia - 4), los Literales,
+                   la Distancia en 2 Bytes y las Extensiones de Longitud; la Última Secuencia solo Lleva Literales.
+                   Las Coincidencias se Buscan con una Tabla de Huellas de 4 Bytes (un Candidato por Entrada)
     */
 
-    // Impresión de Mensaje de Error
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                        ERROR                                   * \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                           Fuera de Rango (Numeros de 0-5)                      * \n";
-    std::cout << "                      ********************************************************************************** \n";
+    /// Tabla de Últimas Posiciones por Huella
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(raw.data());
+    size_t size = raw.size();
+    std::vector<uint32_t> table(1 << 14, UINT32_MAX);
+    std::string out;
+    out.reserve(size / 2 + 16);
+
+    /// Emitir Literales Pendientes y, si Hay, una Coincidencia
+    auto emit = [&](size_t anchor, size_t literals, size_t distance, size_t length){
+
+        size_t extra = length ? length - 4 : 0;
+        out.push_back(static_cast<char>((std::min<size_t>(literals, 15) << 4) | std::min<size_t>(extra, 15)));
+        if (literals >= 15) putRunLength(out, literals - 15);
+        out.append(raw, anchor, literals);
+        if (!length) return;
+        out.push_back(static_cast<char>(distance & 0xFF));
+        out.push_back(static_cast<char>(distance >> 8));
+        if (extra >= 15) putRunLength(out, extra - 15);
+
+    };
+
+    /// Recorrer Buscando Coincidencias de al menos 4 Bytes a no más de 64 KiB
+    size_t anchor = 0, position = 0;
+    while (position + 4 <= size){
+
+        uint32_t sequence;
+        std::memcpy(&sequence, in + position, 4);
+        uint32_t slot = (sequence * 2654435761u) >> 18;
+        uint32_t candidate = table[slot];
+        table[slot] = static_cast<uint32_t>(position);
+        if (candidate == UINT32_MAX || position - candidate > 65535 || std::memcmp(in + candidate, in + position, 4) != 0){
+
+            position++;
+            continue;
 
-}
+        }
+        size_t length = 4;
+        while (position + length < size && in[candidate + length] == in[position + length]) length++;
+        emit(anchor, position - anchor, position - candidate, length);
+        position += length;
+        anchor = position;
 
+    }
+    emit(anchor, size - anchor, 0, 0);
+    return out;
 
+}
 
-/// Función: Felicitaciones al Ganador
-void win(){
 
-    /*
-       - Función: Felicitaciones al Ganador
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Felicitaciones al Ganador
-    */
 
-    /// Configración Inicial
-    clearScreen();                     // Limpiar Pantalla   
-    waitSeconds(2);                   // Esperar 2 Segundos
 
-    /// Mensaje de Felicitaciones
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *       *****  *****  *      *   ****  *  *****    ***   ****   *****  ****      * \n";
-    std::cout << "                      *       *      *      *      *  *      *  *    *  *   *  *   *  *     *          * \n";
-    std::cout << "                      *       ****   ****   *      *  *      *  *    *  *****  *   *  ****   ****      * \n";
-    std::cout << "                      *       *      *      *      *  *      *  *    *  *   *  *   *  *          *     * \n";
-    std::cout << "                      *       *      *****  *****  *   ****  *  *****   *   *  ****   *****  ****      * \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      ********************************************************************************** \n";
+/**
+ * @brief Función que Descomprime un Bloque de packBlock.
+ * @param packed (std::string): Bloque Comprimido.
+ * @param rawSize (size_t): Tamaño Original.
+ * @param raw (std::string): Bytes Originales (Salida).
+ * @return (bool) Falso si el Bloque está Dañado.
+ */
+bool unpackBlock(const std::string& packed, size_t rawSize, std::string& raw){
+
+    /// Leer una Extensión de Longitud
+    size_t at = 0;
+    auto runLength = [&](size_t& length){
+
+        uint8_t byte;
+        do {
+
+            if (at >= packed.size()) return false;
+            byte = static_cast<uint8_t>(packed[at++]);
+            length += byte;
+
+        } while (byte == 255);
+        return true;
+
+    };
+
+    /// Secuencias hasta Agotar el Bloque
+    raw.clear();
+    raw.reserve(rawSize);
+    while (at < packed.size()){
+
+        uint8_t control = static_cast<uint8_t>(packed[at++]);
+        size_t literals = control >> 4;
+        if (literals == 15 && !runLength(literals)) return false;
+        if (literals > packed.size() - at || raw.size() + literals > rawSize) return false;
+        raw.append(packed, at, literals);
+        at += literals;
+        if (at == packed.size()) break;                                          // Última Secuencia
+
+        /// Coincidencia (Puede Solaparse con lo que Copia)
+        if (packed.size() - at < 2) return false;
+        size_t distance = static_cast<uint8_t>(packed[at]) | (static_cast<size_t>(static_cast<uint8_t>(packed[at + 1])) << 8);
+        at += 2;
+        size_t length = control & 0x0F;
+        if (length == 15 && !runLength(length)) return false;
+        length += 4;
+        if (distance == 0 || distance > raw.size() || raw.size() + length > rawSize) return false;
+        size_t from = raw.size() - distance;
+        for (size_t k = 0; k < length; k++) raw.push_back(raw[from + k]);
 
-}
+    }
+    return raw.size() == rawSize;
 
+}
 
 
 
-/// Función: Mensaje de Empate
-void tie(){
 
-    /*
-       - Función: Mensaje de Empate
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Empate
-    */
+/**
+ * @brief Función que Agrega una Línea al Diccionario si Califica.
+ * @param codec (LineCodec): Estado de Codificación.
+ * @param line (std::string): La Línea.
+ */
+inline void shareLine(LineCodec& codec, const std::string& line){
 
-    // Mensaje de Empate
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *                   *****  **   **  ****    ***   *******  *****                 * \n";
-    std::cout << "                      *                   *      * * * *  *   *  *   *     *     *                     * \n";
-    std::cout << "                      *                   ****   *  *  *  ****   *****     *     ****                  * \n";
-    std::cout << "                      *                   *      *     *  *      *   *     *     *                     * \n";
-    std::cout << "                      *                   *****  *     *  *      *   *     *     *****                 * \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      ********************************************************************************** \n";
+    /// Solo Líneas Largas y Huellas Nuevas (una Colisión Deja la Entrada Original; el Reproductor Decide Igual)
+    if (line.size() < RECORD_SHARED_LINE || codec.shared.size() >= RECORD_DICTIONARY) return;
+    if (codec.index.emplace(lineHash(line), static_cast<uint32_t>(codec.shared.size())).second) codec.shared.push_back(line);
 
 }
 
@@ -345,85 +390,103 @@ void tie(){
 
 
 /**
- * @brief Función de Impresión de Error de Carta ya Descubierta.
- * @param sameCard (bool): Indica si la carta seleccionada es la misma que la primera.
+ * @brief Función que Codifica un Cuadro contra el Anterior y el Diccionario.
+ * @param codec (LineCodec): Estado de Codificación (Avanza).
+ * @param frame (RecordedFrame): El Cuadro.
+ * @param out (std::string): Registros (se Agrega al Final).
+ * @param kinds (uint64_t[4]): Conteo de Líneas por Codificación.
  */
-void cardDiscoveredError(bool sameCard){
-    
+void encodeFrame(LineCodec& codec, const RecordedFrame& frame, std::string& out, uint64_t kinds[4]){
+
     /*
-       - Función: Error de Carta ya Descubierta
+       - Función: Codificar Cuadro
        - Argumentos:
-            - sameCard (bool): Indica si la carta seleccionada es la misma que la primera
+            - codec (LineCodec): Estado de Codificación
+            - frame (RecordedFrame): El Cuadro
+            - out (std::string): Registros
+            - kinds (uint64_t[4]): Conteo por Codificación
        - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Error cuando el Usuario selecciona una Carta ya Descubierta
+       - Objetivo: Registro = Delta de Tiempo, Número de Líneas y una Codificación por Línea (Cortando Después de cada '\n').
+                   Las Líneas Iguales a las del Cuadro Anterior Cuestan un Byte, las Portadas y Bordes ya Vistos un Índice,
+                   y las Demás Guardan solo el Centro que Cambió o sus Bytes Completos
     */
-    
-    /// Impresión de Mensaje de Error
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                     ERROR                                      * \n";
-    std::cout << "                      ********************************************************************************** \n";
-    if (sameCard) std::cout << "                      *                   Ya elegiste esa Carta como Primera. Escoge otra.             * \n";
-    else std::cout << "                      *                    Esa Carta ya fue descubierta. Escoge otra.                  * \n";
-    std::cout << "                      ********************************************************************************** \n";
 
-}
+    /// Encabezado del Registro
+    const std::string& bytes = frame.bytes;
+    putVarint(out, frame.micros - codec.lastMicros);
+    codec.lastMicros = frame.micros;
+    size_t count = static_cast<size_t>(std::count(bytes.begin(), bytes.end(), '\n'));
+    if (!bytes.empty() && bytes.back() != '\n') count++;
+    putVarint(out, count);
+
+    /// Una Codificación por Línea
+    std::vector<std::string> current;
+    current.reserve(count);
+    size_t begin = 0;
+    while (begin < bytes.size()){
+
+        size_t end = bytes.find('\n', begin);
+        end = (end == std::string::npos) ? bytes.size() : end + 1;
+        current.emplace_back(bytes, begin, end - begin);
+        const std::string& line = current.back();
+        const std::string* before = (current.size() <= codec.previous.size()) ? &codec.previous[current.size() - 1] : nullptr;
+        begin = end;
+
+        /// Sin Cambios en esa Posición
+        if (before && *before == line){
+
+            out.push_back(static_cast<char>(LINE_SAME));
+            kinds[LINE_SAME]++;
+            continue;
 
+        }
 
+        /// Ya Vista en Cualquier Posición
+        if (line.size() >= RECORD_SHARED_LINE){
 
+            auto found = codec.index.find(lineHash(line));
+            if (found != codec.index.end() && codec.shared[found->second] == line){
 
-/**
- * @brief Función de Impresión de Datos Generales del Juego.
- * @param player1Points (int): Puntos del Jugador 1.
- * @param player2Points (int): Puntos del Jugador 2.
- * @param turn (int): Turno del Jugador Actual.
- * @param playersNames (std::vector<std::string>): Nombres de los Jugadores.
- * @throw std::out_of_range (int): Si algún Entero no es Positivo.
- */
-void printGeneralData(int player1Points, int player2Points, int turn, const std::vector<std::string>& playersNames){
+                out.push_back(static_cast<char>(LINE_SHARED));
+                putVarint(out, found->second);
+                kinds[LINE_SHARED]++;
+                continue;
 
-    /*
-       - Función: Datos Generales
-       - Argumentos:
-            - player1Points (int): Puntos del Jugador 1 
-            - player2Points (int): Puntos del Jugador 2 
-            - turn (int): Turno del Jugador Actual 
-            - playersNames (std::vector<std::string>): Nombres de los Jugadores 
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Datos Generales del Juego (Puntajes y Turno Actual)
-    */
+            }
 
-    /// Validaciones de Argumentos de Tipo Entero
-    validatePositiveInt(player1Points);                    // Puntos del Jugador 1
-    validatePositiveInt(player2Points);                    // Puntos del Jugador 2
-    validatePositiveInt(turn);                             // Turno del Jugador Actual
+        }
 
-    /// Impresión de Datos Generales
-    std::cout << "                      *            " << playersNames[0] << " : " << player1Points << " puntos           |            " << playersNames[1] << " : " << player2Points << " puntos \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                               Turno del jugador: " << playersNames[turn - 1] << "\n";
-    std::cout << "                      ********************************************************************************** \n";
+        /// Prefijo y Sufijo Comunes con la Línea Anterior
+        size_t prefix = 0, suffix = 0;
+        if (before){
 
-}
+            size_t limit = std::min(before->size(), line.size());
+            while (prefix < limit && (*before)[prefix] == line[prefix]) prefix++;
+            while (suffix < limit - prefix && (*before)[before->size() - 1 - suffix] == line[line.size() - 1 - suffix]) suffix++;
 
+        }
+        if (prefix + suffix >= 8){
 
+            out.push_back(static_cast<char>(LINE_DIFF));
+            putVarint(out, prefix);
+            putVarint(out, suffix);
+            putVarint(out, line.size() - prefix - suffix);
+            out.append(line, prefix, line.size() - prefix - suffix);
+            kinds[LINE_DIFF]++;
 
+        }
+        else {
 
-/// Función: Error de Tipo
-void typeError(){
+            out.push_back(static_cast<char>(LINE_LITERAL));
+            putVarint(out, line.size());
+            out.append(line);
+            kinds[LINE_LITERAL]++;
 
-    /*
-       - Función: Error de Tipo
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa un Valor de Tipo Inválido
-    */
+        }
+        shareLine(codec, line);
 
-    // Impresión de Mensaje de Error
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                     ERROR                                      * \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *               Entrada Invalida. Por favor ingresa un Numero Entero             * \n";
-    std::cout << "                      ********************************************************************************** \n";
+    }
+    codec.previous.swap(current);
 
 }
 
@@ -431,43 +494,90 @@ void typeError(){
 
 
 /**
- * @brief Función de Impresión de Error de Cadena Vacía de Nombres de Jugadores.
- * @param playerNum (int): Número del Jugador (0 o 1).
- * @param playersNames (std::vector<std::string>): Vector de Nombres de los Jugadores.
+ * @brief Función que Reconstruye un Cuadro desde sus Registros.
+ * @param codec (LineCodec): Estado de Codificación (Avanza).
+ * @param in (std::string): Registros del Bloque.
+ * @param at (size_t): Posición de Lectura (Avanza).
+ * @param frame (RecordedFrame): El Cuadro (Salida).
+ * @return (bool) Falso si los Registros están Dañados.
  */
-void emptyNameError(const std::vector<std::string>& playersNames, int playerNum){
+bool decodeFrame(LineCodec& codec, const std::string& in, size_t& at, RecordedFrame& frame){
+
+    /// Encabezado del Registro
+    uint64_t delta, count;
+    if (!takeVarint(in, at, delta) || !takeVarint(in, at, count) || count > in.size()) return false;
+    codec.lastMicros += delta;
+    frame.micros = codec.lastMicros;
+    frame.bytes.clear();
+
+    /// Una Codificación por Línea
+    std::vector<std::string> current;
+    current.reserve(count);
+    for (uint64_t k = 0; k < count; k++){
+
+        if (at >= in.size()) return false;
+        uint8_t kind = static_cast<uint8_t>(in[at++]);
+        const std::string* before = (k < codec.previous.size()) ? &codec.previous[k] : nullptr;
+        uint64_t a, b, c;
+        switch (kind){
+
+            case LINE_SAME:                                                         // Copiar la Anterior
+                if (!before) return false;
+                current.push_back(*before);
+                break;
+
+            case LINE_SHARED:                                                       // Copiar del Diccionario
+                if (!takeVarint(in, at, a) || a >= codec.shared.size()) return false;
+                current.push_back(codec.shared[a]);
+                break;
+
+            case LINE_DIFF:                                                         // Prefijo + Centro + Sufijo
+                if (!before || !takeVarint(in, at, a) || !takeVarint(in, at, b) || !takeVarint(in, at, c)) return false;
+                if (a + b > before->size() || c > in.size() - at) return false;
+                current.emplace_back(*before, 0, a);
+                current.back().append(in, at, c);
+                current.back().append(*before, before->size() - b, b);
+                at += c;
+                shareLine(codec, current.back());
+                break;
+
+            case LINE_LITERAL:                                                      // Bytes Completos
+                if (!takeVarint(in, at, a) || a > in.size() - at) return false;
+                current.emplace_back(in, at, a);
+                at += a;
+                shareLine(codec, current.back());
+                break;
+
+            default:
+                return false;
 
-    /*
-       - Función: Error de Cadena Vacía de Nombres de Jugadores
-       - Argumentos:
-            - playerNum (int): Número del Jugador (0 o 1)
-            - playersNames (std::vector<std::string>&): Vector de Nombres de los Jugadores
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa una Cadena Vacía como Nombre de Jugador
-    */
+        }
+        frame.bytes += current.back();
 
-    /// Configuraciones Iniciales
-    waitSeconds(2);                 // Esperar 2 Segundos
-    clearScreen();                  // Limpiar Pantalla
-     
-    // Impresión de Mensaje de Error
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                     ERROR                                      * \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                   El Nombre no puede estar Vacio, Jugador " << playerNum + 1 << "                    * \n";
-    std::cout << "                      ********************************************************************************** \n";
- 
-    /// Configuraciones Finales
-    waitSeconds(2);                 // Esperar 2 Segundos
-    clearScreen();                  // Limpiar Pantalla
+    }
+    codec.previous.swap(current);
+    return true;
 
-    if (playerNum == 1){
+}
 
-        std::cout << "                      ********************************************************************************** \n";
-        std::cout << "                      *                   Escribe el Nombre del Jugador 1: " << playersNames[playerNum - 1] << " \n";
-        std::cout << "                      ********************************************************************************** \n";
 
-    }
+
+
+/**
+ * @brief Función que Comprime y Escribe los Registros Pendientes como un Bloque.
+ * @param state (Recorder): El Grabador.
+ */
+void writeRecordBlock(Recorder& state){
+
+    /// Encabezado del Bloque: Tamaño Original y Comprimido
+    if (state.records.empty()) return;
+    std::string packed = packBlock(state.records);
+    uint32_t sizes[2] = {static_cast<uint32_t>(state.records.size()), static_cast<uint32_t>(packed.size())};
+    std::fwrite(sizes, sizeof(sizes), 1, state.file);
+    std::fwrite(packed.data(), 1, packed.size(), state.file);
+    std::fflush(state.file);
+    state.stats.storedBytes += sizeof(sizes) + packed.size();
+    state.records.clear();
 
 }
 
@@ -475,73 +585,53 @@ void emptyNameError(const std::vector<std::string>& playersNames, int playerNum)
 
 
 /**
- * @brief Función para Leer Nombres de los Jugadores.
- * @param playersNames (std::vector<std::string>): Vector de Nombres de los Jugadores.
+ * @brief Función del Hilo de Codificación.
+ * @param state (Recorder): El Grabador.
  */
-void inputNames(std::vector<std::string>& playersNames){
+void recorderLoop(Recorder& state){
 
-    /*
-       - Función: Leer Nombres de los Jugadores
-       - Argumentos:
-            - playerNames (std::vector<std::string>&): Vector de Nombres de los Jugadores
-       - Retorno: Ninguno
-       - Objetivo: Leer Nombres de los Jugadores para su Almacenamiento
-    */
-
-    /// Lectura de Nombres
-    for(int i = 0; i < 2; i++){
-        
-        do {                                                                                // Repetir hasta obtener un nombre válido
-            
-            /// Impresión y Lectura de Nombre de Jugador
-            if (i == 0) std::cout << "                      ********************************************************************************** \n";
-            std::cout << "                      *                   Escribe el Nombre del Jugador " << i+1 << ": ";
-            std::getline(std::cin, playersNames[i]);
-            
-            /// Buscar Primer Carácter no Espacio
-            auto start = playersNames[i].find_first_not_of(" \t\n\r");                   
-            
-            /// Si solo hay Espacios, marcar como Vacío
-            if (start == std::string::npos) playersNames[i] = "";                 
-                    
-            /// Imprimir Error de Nombre Vacío si el Nombre de algún Jugador está Vacío 
-            if (playersNames[i].empty()) emptyNameError(playersNames, i);               
-            
-        } while (playersNames[i].empty());                                                // Repetir hasta obtener un nombre válido
-        
-        std::cout << "                      ********************************************************************************** \n";
-    
-    }
-    
-    /// Configuraciones Finales
-    waitSeconds(2);              // Esperamos 2 Segundos
-    clearScreen();               // Limpiar Pantalla
+    /// Codificar por Lotes; un Bloque Parcial va a Disco al menos cada Segundo
+    std::string batch;
+    batch.reserve(RECORD_PENDING);
+    RecordedFrame frame;
+    auto lastFlush = std::chrono::steady_clock::now();
+    while (true){
 
-}
+        bool active = state.running.load(std::memory_order_acquire);
+        {
 
+            std::lock_guard<std::mutex> guard(state.lock);
+            batch.swap(state.pending);
 
+        }
+        auto began = std::chrono::steady_clock::now();
+        for (size_t at = 0; at < batch.size(); ){
+
+            uint32_t size;
+            std::memcpy(&frame.micros, batch.data() + at, sizeof(frame.micros));
+            std::memcpy(&size, batch.data() + at + sizeof(frame.micros), sizeof(size));
+            at += sizeof(frame.micros) + sizeof(size);
+            frame.bytes.assign(batch, at, size);
+            at += size;
+            encodeFrame(state.codec, frame, state.records, state.stats.kinds);
+            state.stats.frames++;
+            state.stats.rawBytes += frame.bytes.size();
+            if (state.records.size() >= RECORD_BLOCK) writeRecordBlock(state);
 
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlush >= std::chrono::milliseconds(RECORD_FLUSH_MS) || !active){
 
-/// Función: Animación de Carga
-void loading(){
+            writeRecordBlock(state);
+            lastFlush = now;
 
-    /*
-       - Función: Animación de Carga
-       - Argumentos: Ninguno
-       - Retorno: Ninguno
-       - Objetivo: Imprimir Animación de Carga
-    */
+        }
+        state.stats.encodeMicros += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - began).count());
 
-    /// Animación de Carga
-    for (int i = 0; i < 3; i++){                    // Repetir 3 Veces
+        batch.clear();                                                       // Conserva la Capacidad para el Próximo Intercambio
+        if (!active) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(RECORD_DRAIN_MS));
 
-        std::cout << "Cargando";                    // Imprimir Cargando
-        for (int j = 0; j < 5; j++){                // Repetir 5 Veces
-            
-            std::cout << ".";                       // Imprimir Punto
-            waitMilliseconds(500);                  // Esperar 500 MiliSegundos
-        }
-        clearScreen();                              // Limpiar Pantalla
     }
 
 }
@@ -550,30 +640,41 @@ void loading(){
 
 
 /**
- * @brief Función para Imprimir el Tablero.
- * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas de Cartas Visibles.
+ * @brief Función que Entrega a la Grabación el Cuadro Recién Escrito.
+ * @param frame (std::string): Búfer del Cuadro (la Salida lo Sigue Usando).
  */
-void printBoard(const std::vector<std::vector<std::string>>& visibleCards){
+inline void recordFrame(const std::string& frame){
 
-    /*
-       - Función: Imprimir el Tablero
-       - Argumentos:
-            - visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles 
-       - Retorno: Ninguno
-       - Objetivo: Imprimir el Tablero con las Cartas Visibles
-    */
+    /// Agregar Marca, Largo y Bytes al Final de lo Pendiente: una Copia Secuencial, sin Reservas ni Búferes Sueltos
+    uint64_t micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - recorder->start).count());
+    uint32_t size = static_cast<uint32_t>(frame.size());
+    std::lock_guard<std::mutex> guard(recorder->lock);
+    recorder->pending.append(reinterpret_cast<const char*>(&micros), sizeof(micros));
+    recorder->pending.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    recorder->pending.append(frame);
 
-    /// Impresión de Cartas Visibles del Tablero
-    for (int i = 0; i < 6; i++){                                                                          // Recorrido de 5 Iteraciones
+}
 
-        std::cout << "                      *                                   " << i << " ";            // Imprimimos el Número de Fila
-        for (int j = 0; j < 6; j++){                                                                      // Recorrido de 5 Cartas
 
-            if (j == 5) std::cout << visibleCards[i][j] << "                                * \n";        // Si Ultima Carta: Fin de Fila
-            else std::cout << visibleCards[i][j] << " ";                                                  // Solo Imprimir la Carta
-        
-        }
-    }
+
+
+/**
+ * @brief Función que Inicia la Grabación de la Sesión.
+ * @param path (std::string): Archivo de Grabación (se Reemplaza).
+ * @throw std::runtime_error: Si el Archivo no se puede Crear.
+ */
+void startRecording(const std::string& path){
+
+    /// Crear con la Firma e Iniciar el Hilo
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) throw std::runtime_error("No se pudo Crear " + path);
+    std::fwrite(RECORD_MAGIC, 1, sizeof(RECORD_MAGIC), file);
+    recorder = new Recorder;
+    recorder->file = file;
+    recorder->pending.reserve(RECORD_PENDING);                               // Lo Pendiente de 50 ms Cabe sin Crecer
+    recorder->stats.storedBytes = sizeof(RECORD_MAGIC);
+    recorder->start = std::chrono::steady_clock::now();
+    recorder->thread = std::thread(recorderLoop, std::ref(*recorder));
 
 }
 
@@ -581,32 +682,22 @@ void printBoard(const std::vector<std::vector<std::string>>& visibleCards){
 
 
 /**
- * @brief Función para Leer 1era Carta de Fila.
- * @param rowCard1 (int): La Primera Carta de Fila.
- * @param onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada.
- * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ * @brief Función que Detiene la Grabación Codificando lo Pendiente.
+ * @return (RecordStats) Resumen de la Grabación.
  */
-void rowCard1(int& rowCard1, bool onlyPrint){
+RecordStats stopRecording(){
 
-    /*
-       - Función: Leer 1era Carta de Fila
-       - Argumentos:
-            - rowCard1 (int): Primera Carta de Fila 
-       - Retorno: Ninguno
-       - Objetivo: Leer 1era Carta de Fila del Usuario
-    */
+    /// Sin Grabación Activa
+    if (!recorder) return RecordStats();
 
-    /// Validación de Argumento
-    validatePositiveInt(rowCard1);                             // Entero Positivo
-    
-    ///Impresión y Lectura de Primera Carta de Fila
-    std::cout << "                      ********************************************************************************** \n";
-    if (onlyPrint) std::cout << "                      *                  Elige la fila de la primera carta (0-5): " << rowCard1 << "                    *   \n";
-    else{
-    
-        std::cout << "                      *                  Elige la fila de la primera carta (0-5): ";
-        std::cin >> rowCard1;
-    }
+    /// Detener el Hilo y Cerrar
+    recorder->running.store(false, std::memory_order_release);
+    recorder->thread.join();
+    std::fclose(recorder->file);
+    RecordStats stats = recorder->stats;
+    delete recorder;
+    recorder = nullptr;
+    return stats;
 
 }
 
@@ -614,75 +705,161 @@ void rowCard1(int& rowCard1, bool onlyPrint){
 
 
 /**
- * @brief Función para Leer 1era Carta de Columna.
- * @param columnCard2 (int): La Primera Carta de Columna.
- * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ * @brief Función que Reproduce una Grabación en la Salida Estándar.
+ * @param path (std::string): Archivo de Grabación.
+ * @param speed (double): Factor de Velocidad (0 = sin Esperas).
+ * @return (uint64_t) Cuadros Reproducidos.
+ * @throw std::runtime_error: Si el Archivo no es una Grabación o está Dañado.
  */
-void columnCard1(int& columnCard1){
-    
+uint64_t playRecording(const std::string& path, double speed){
+
     /*
-       - Función: Leer 1era Carta de Columna
+       - Función: Reproducir Grabación
        - Argumentos:
-            - columnCard1 (int): Primera Carta de Columna
-       - Retorno: Ninguno
-       - Objetivo: Leer 1era Carta de Columna del Usuario
+            - path (std::string): Archivo de Grabación
+            - speed (double): Factor de Velocidad
+       - Retorno: Cuadros Reproducidos
+       - Objetivo: Cada Cuadro se Emite en su Marca Original Dividida entre la Velocidad, Medida desde el Inicio de la
+                   Reproducción (los Retrasos de la Terminal no se Acumulan). Una Grabación Interrumpida se Reproduce
+                   hasta su Último Bloque Completo
     */
 
-    /// Validación de Argumento
-    validatePositiveInt(columnCard1);                             // Entero Positivo
+    /// Verificar la Firma
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) throw std::runtime_error("No se pudo Abrir " + path);
+    char magic[sizeof(RECORD_MAGIC)];
+    if (std::fread(magic, 1, sizeof(magic), file) != sizeof(magic) || std::memcmp(magic, RECORD_MAGIC, sizeof(magic)) != 0){
 
-    ///Impresión y Lectura de Primera Carta de Columna
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                  Elige la columna de la primera carta (0-5): ";
-    std::cin >> columnCard1;
+        std::fclose(file);
+        throw std::runtime_error(path + " no es una Grabacion");
+
+    }
+
+    /// Bloque por Bloque
+    LineCodec codec;
+    RecordedFrame frame;
+    std::string packed, raw;
+    uint32_t sizes[2];
+    uint64_t played = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (std::fread(sizes, sizeof(sizes), 1, file) == 1){
+
+        if (sizes[0] > RECORD_BLOCK_LIMIT || sizes[1] > RECORD_BLOCK_LIMIT) break;
+        packed.resize(sizes[1]);
+        if (std::fread(&packed[0], 1, packed.size(), file) != packed.size()) break;              // Bloque Incompleto
+        if (!unpackBlock(packed, sizes[0], raw)){
+
+            std::fclose(file);
+            throw std::runtime_error(path + ": Bloque Dañado");
+
+        }
+
+        /// Emitir cada Cuadro en su Momento
+        size_t at = 0;
+        while (at < raw.size()){
+
+            if (!decodeFrame(codec, raw, at, frame)){
+
+                std::fclose(file);
+                throw std::runtime_error(path + ": Registro Dañado");
+
+            }
+            if (speed > 0) std::this_thread::sleep_until(start + std::chrono::microseconds(static_cast<long long>(frame.micros / speed)));
+            std::fwrite(frame.bytes.data(), 1, frame.bytes.size(), stdout);
+            std::fflush(stdout);
+            played++;
+
+        }
+
+    }
+    std::fclose(file);
+    return played;
 
 }
 
+// =====================================================================================================================================
+// -------------------------------------------------------------- Salida en Pantalla ----------------------------------------------------
+
+/// Estructura: Búfer de Pantalla (Cada Cuadro se Compone Aquí y se Emite con una sola Escritura)
+struct ScreenBuffer {
+
+    std::string data;                            // Bytes Pendientes del Cuadro Actual
+    bool virtualTerminal = true;                 // La Consola Interpreta Secuencias ANSI
+
+};
+
+ScreenBuffer screen;                                                              /// Búfer Global de la Consola
+
+const int CANONICAL_INDENT = 22;                                                  /// Sangría con que se Componen las Pantallas
+const int BOX_WIDTH = 83;                                                         /// Ancho del Recuadro (con Espacio Final)
+const int FULL_FRAME_LINES = 34;                                                  /// Líneas de un Cuadro Completo con Portada
+
+/// Estructura: Geometría de la Pantalla (se Recalcula solo al Cambiar el Tamaño de la Terminal)
+struct ScreenLayout {
+
+    int width = 0;                               // Columnas de la Terminal (0 = Desconocido)
+    int height = 0;                              // Filas de la Terminal (0 = Desconocido)
+    int indent = CANONICAL_INDENT;               // Sangría que Centra el Recuadro
+    bool compact = false;                        // Sin Portada si el Cuadro no Cabe a lo Alto
+    std::string scratch;                         // Búfer Auxiliar para Cambiar la Sangría
+
+};
+
+ScreenLayout layout;                                                              /// Geometría Actual
+volatile sig_atomic_t resizePending = 1;                                          /// Cambio de Tamaño Pendiente (SIGWINCH)
+
+
+
+
+/// Manejador de SIGWINCH: solo Marca el Cambio (el Cálculo se Hace al Componer el Siguiente Cuadro)
+inline void onResize(int){resizePending = 1;}
+
 
 
 
 /**
- * @brief Función de Impresión de Elementos Visuales del Juego.
- * @param player1Points (int): Puntos del Jugador 1
- * @param player2Points (int): Puntos del Jugador 2
- * @param turn (int): Número de Turno
- * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas con las Cartas Visibles.
- * @param playersName (std::vector<std::string>): El Vector de Cadenas donde que Almacenan los Nombres de los Jugadores.
- * @throw std::out_of_range (int): Si algún Entero es Negativo
+ * @brief Función que Recalcula la Geometría si la Terminal Cambió de Tamaño.
+ * @return (bool) Verdadero si la Geometría Cambió.
  */
-void printGame(
-    
-    int& player1Points, 
-    int& player2Points, 
-    int& turn, 
-    const std::vector<std::vector<std::string>>& visibleCards, 
-    const std::vector<std::string>& playersNames
+bool updateLayout(){
 
-){
-    
     /*
-       - Función: Impresión de Elementos Visuales del Juego
-       - Argumentos:
-            - player1Points (int): Puntos del Jugador 1
-            - player2Points (int): Puntos del Jugador 2
-            - turn (int): Número de Turno
-            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas con las Cartas Visibles.
-            - playersName (std::vector<std::string>): El Vector de Cadenas donde que Almacenan los Nombres de los Jugadores.
-       - Retorno: Ninguno
-       - Objetivo: Impresión de Elementos Visuales del Juego para la visualización del Usuario
+       - Función: Actualizar Geometría
+       - Argumentos: Ninguno
+       - Retorno: Verdadero si la Geometría Cambió
+       - Objetivo: Consultar el Tamaño de la Terminal y Derivar Sangría y Vista Compacta, sin Repetir el Cálculo
+                   Mientras el Tamaño no Cambie
     */
 
-    /// Imprimir Portada del Juego
-    titleCover();
+    /// Consultar el Tamaño (en Windows no hay SIGWINCH: se Consulta en cada Cuadro)
+    int width = 0, height = 0;
+    #ifdef _WIN32
+        CONSOLE_SCREEN_BUFFER_INFO info;
+        if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)){
 
-    /// Imprimir la Información General del Juego
-    printGeneralData(player1Points, player2Points, turn, playersNames);
+            width = info.srWindow.Right - info.srWindow.Left + 1;
+            height = info.srWindow.Bottom - info.srWindow.Top + 1;
 
-    /// Mostrar Tablero Visible con Coordenadas
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *                                     0 1 2 3 4 5                                * \n";
-    printBoard(visibleCards);
-    std::cout << "                      *                                                                                * \n";
+        }
+    #else
+        if (!resizePending) return false;
+        resizePending = 0;
+        struct winsize size;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0){
+
+            width = size.ws_col;
+            height = size.ws_row;
+
+        }
+    #endif
+    if (width == layout.width && height == layout.height) return false;
+
+    /// Derivar Geometría (sin Terminal se Conserva la Composición Original)
+    layout.width = width;
+    layout.height = height;
+    layout.indent = width > 0 ? std::max(0, (width - BOX_WIDTH) / 2) : CANONICAL_INDENT;
+    layout.compact = height > 0 && height < FULL_FRAME_LINES;
+    return true;
 
 }
 
@@ -690,30 +867,54 @@ void printGame(
 
 
 /**
- * @brief Función para Leer 2da Carta de Fila.
- * @param aMatch (bool): Indica si las Cartas Hicieron Pareja.
+ * @brief Función que Cambia la Sangría de las Líneas del Recuadro en el Búfer.
  */
-void cardMessage(bool aMatch){
-   
+void applyIndent(){
+
     /*
-       - Función: Mensaje de Carta
-       - Argumentos:
-            - aMatch (bool): Indica si las Cartas Hicieron Pareja
+       - Función: Aplicar Sangría
+       - Argumentos: Ninguno
        - Retorno: Ninguno
-       - Objetivo: Imprimir Mensaje de Carta (Pareja Encontrada o No Son Iguales)
+       - Objetivo: Reemplazar la Sangría Canónica de cada Línea por la de la Geometría Actual en una sola Pasada
     */
 
-    
-    /// Impresión de Mensaje de Carta
-    std::cout << "                      ********************************************************************************** \n";
-    if (aMatch){
-    
-        std::cout << "                      *                                 ¡Pareja encontrada!                            * \n";
-        playBeep();
+    /// Sangría Canónica: Nada que Hacer
+    if (layout.indent == CANONICAL_INDENT) return;
+
+    /// Copiar Línea por Línea Cambiando la Sangría
+    const std::string& data = screen.data;
+    std::string& result = layout.scratch;
+    result.clear();
+    size_t begin = 0;
+    while (begin < data.size()){
+
+        size_t end = data.find('\n', begin);
+        end = end == std::string::npos ? data.size() : end + 1;
+
+        /// Secuencias de Control al Inicio (clearScreen) se Copian Tal Cual y no Cuentan como Sangría
+        size_t text = begin;
+        while (text + 1 < end && data[text] == '\033' && data[text + 1] == '['){
+
+            size_t final = text + 2;
+            while (final < end && (data[final] < '@' || data[final] > '~')) final++;   // Parámetros hasta el Byte Final
+            if (final == end) break;
+            text = final + 1;
+
+        }
+        size_t spaces = 0;
+        while (text + spaces < end && data[text + spaces] == ' ') spaces++;
+        if (spaces == static_cast<size_t>(CANONICAL_INDENT)){                         // Línea del Recuadro
+
+            result.append(data, begin, text - begin);
+            result.append(layout.indent, ' ');
+            result.append(data, text + spaces, end - text - spaces);
+
+        }
+        else result.append(data, begin, end - begin);                             // Otra Línea
+        begin = end;
 
     }
-    else std::cout << "                      *                                   No son iguales.                              *\n";
-    std::cout << "                      ********************************************************************************** \n";
+    screen.data.swap(result);
 
 }
 
@@ -721,90 +922,101 @@ void cardMessage(bool aMatch){
 
 
 /**
- * @brief Función para Leer 2da Carta de Fila.
- * @param rowCard2 (int): La Segunda Carta de Fila.
- * @param onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada.
- * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ * @brief Función que Prepara la Consola para el Búfer de Pantalla.
  */
-void rowCard2(int& rowCard2, bool onlyPrint){
+void initScreen(){
 
     /*
-       - Función: Leer 2da Carta de Fila
-       - Argumentos:
-            - rowCard2 (int): Segunda Carta de Fila
-            - onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada. 
+       - Función: Preparar Pantalla
+       - Argumentos: Ninguno
        - Retorno: Ninguno
-       - Objetivo: Leer 2da Carta de Fila del Usuario
+       - Objetivo: Desacoplar iostream de stdio, Reservar el Búfer, Activar ANSI en Windows y Escuchar SIGWINCH
     */
 
-    /// Validación de Argumento
-    validatePositiveInt(rowCard2);                             // Entero Positivo
+    /// Sin Sincronización con stdio: la Salida ya no Pasa por std::cout
+    std::ios::sync_with_stdio(false);
+    screen.data.reserve(16384);
+
+    /// En Windows, Activar Secuencias ANSI (si no se Puede, se Usa la API de Consola)
+    #ifdef _WIN32
+        HANDLE handleConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD mode = 0;
+        screen.virtualTerminal = GetConsoleMode(handleConsole, &mode) && SetConsoleMode(handleConsole, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    #else
+        signal(SIGWINCH, onResize);
+    #endif
 
-    ///Impresión y Lectura de Segunda Carta de Fila    
-    std::cout << "                      ********************************************************************************** \n";
-    if (onlyPrint) std::cout << "                      *                  Elige la fila de la segunda carta (0-5): " << rowCard2 << "                    *   \n";
-    else{
-    
-        std::cout << "                      *                  Elige la fila de la segunda carta (0-5): ";
-        std::cin >> rowCard2;
-    
-    }
 }
 
 
 
 
 /**
- * @brief Función para Leer 2da Carta de Columna.
- * @param columnCard2 (int): La Segunda Carta de Columna.
- * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ * @brief Función que Emite el Cuadro Pendiente con una sola Escritura.
  */
-void columnCard2(int& columnCard2){
-    
+void presentFrame(){
+
     /*
-       - Función: Leer 2da Carta de Columna
-       - Argumentos:
-            - columnCard2 (int): Primera Carta de Columna 
+       - Función: Emitir Cuadro
+       - Argumentos: Ninguno
        - Retorno: Ninguno
-       - Objetivo: Leer 2da Carta de Columna del Usuario
+       - Objetivo: Escribir Todo el Búfer en la Salida Estándar y Vaciarlo (Conservando su Capacidad)
     */
 
-    /// Validación de Argumento
-    validatePositiveInt(columnCard2);                             // Entero Positivo
+    /// Nada que Emitir
+    if (screen.data.empty()) return;
+
+    /// Ajustar la Sangría a la Terminal
+    updateLayout();
+    applyIndent();
+
+    /// Escribir (Reintentando si la Escritura es Parcial)
+    const char* cursor = screen.data.data();
+    size_t remaining = screen.data.size();
+    while (remaining > 0){
+
+        #ifdef _WIN32
+            DWORD written = 0;
+            if (!WriteFile(GetStdHandle(STD_OUTPUT_HANDLE), cursor, static_cast<DWORD>(remaining), &written, nullptr)) break;
+        #else
+            ssize_t written = write(STDOUT_FILENO, cursor, remaining);
+            if (written < 0 && errno == EINTR) continue;                  // Interrumpida por una Señal
+            if (written <= 0) break;                                      // Salida Cerrada
+        #endif
+        cursor += written;
+        remaining -= static_cast<size_t>(written);
 
-    ///Impresión y Lectura de Segunda Carta de Columna
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                  Elige la columna de la segunda carta (0-5): ";
-    std::cin >> columnCard2;
+    }
+
+    /// Entregar una Copia del Cuadro a la Grabación y Vaciar (el Búfer Conserva su Capacidad)
+    if (recorder) recordFrame(screen.data);
+    screen.data.clear();
 
 }
 
-// =====================================================================================================================================
-// ------------------------------------------------------- Funciones Core --------------------------------------------------------------
+
+
+
+/// Operadores de Inserción en el Búfer (Reemplazan a std::cout)
+inline ScreenBuffer& operator<<(ScreenBuffer& buffer, const char* text){buffer.data.append(text); return buffer;}
+inline ScreenBuffer& operator<<(ScreenBuffer& buffer, const std::string& text){buffer.data.append(text); return buffer;}
+inline ScreenBuffer& operator<<(ScreenBuffer& buffer, char character){buffer.data.push_back(character); return buffer;}
+
+
+
 
 /**
- * @brief Función de Creación de Arreglo de Pares.
- * @param letters (std::vector<std::string>): El Vector de Cadenas con las Letras Base.
- * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenarán los Pares.
+ * @brief Función que Copia una Pantalla Precompuesta al Búfer.
+ * @param blob (const char[N]): La Pantalla como Literal.
+ * @return (size_t) La Posición del Búfer donde Empieza la Copia (para Parchar Huecos).
  */
-void createPairs(const std::vector<std::string>& letters, std::vector<std::string>& pairs){
-    
-    /*
-       - Función: Creación de Arreglo
-       - Argumentos:
-            - letters (std::vector<std::string>): El Vector de Cadenas con las Letras Base.
-            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenarán los Pares.
-       - Retorno: Ninguno
-       - Objetivo: Crear un Arreglo de Pares de Letras
-    */
+template <size_t N>
+inline size_t appendBlob(const char (&blob)[N]){
 
-    /// Creación de Arreglo de Pares
-    for (int i = 0; i < 18; i++){          /// Repetir 18 Veces
-        
-        pairs[i * 2] = letters[i];         /// Asignar Letra a la Posición Par
-        pairs[i * 2 + 1] = letters[i];     /// Asignar Letra a la Posición Impar
-    
-    }
+    /// Una sola Copia de N - 1 Bytes (sin el Terminador)
+    size_t base = screen.data.size();
+    screen.data.append(blob, N - 1);
+    return base;
 
 }
 
@@ -812,304 +1024,11448 @@ void createPairs(const std::vector<std::string>& letters, std::vector<std::strin
 
 
 /**
- * @brief Función para Barajear.
- * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+ * @brief Función que Busca un Hueco Marcado dentro de una Pantalla.
+ * @param blob (const char*): La Pantalla.
+ * @param mark (char): El Carácter que Marca el Hueco.
+ * @return (size_t) La Posición del Hueco.
  */
-void shuffleCards(std::vector<std::string>& pairs){
-    
+constexpr size_t findSlot(const char* blob, char mark){
+
+    /// Recorrido en Tiempo de Compilación
+    size_t position = 0;
+    while (blob[position] != '\0' && blob[position] != mark) position++;
+    return position;
+
+}
+
+
+
+
+/**
+ * @brief Función que Busca los Huecos de las Cartas ('X') dentro de una Pantalla.
+ * @param blob (const char[N]): La Pantalla.
+ * @return (std::array<uint16_t, CARD_COUNT>) Las Posiciones en Orden de Lectura.
+ */
+template <size_t N>
+constexpr std::array<uint16_t, CARD_COUNT> findCardSlots(const char (&blob)[N]){
+
+    /// Recorrido en Tiempo de Compilación
+    std::array<uint16_t, CARD_COUNT> slots{};
+    size_t count = 0;
+    for (size_t i = 0; i < N && count < CARD_COUNT; i++) if (blob[i] == 'X') slots[count++] = static_cast<uint16_t>(i);
+    return slots;
+
+}
+
+
+
+/**
+ * @brief Operador que Inserta un Entero en el Búfer sin Pasar por un Stream.
+ * @param buffer (ScreenBuffer): El Búfer.
+ * @param value (T): El Entero.
+ * @return (ScreenBuffer&) El mismo Búfer.
+ */
+template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, char>::value && !std::is_same<T, bool>::value>>
+inline ScreenBuffer& operator<<(ScreenBuffer& buffer, T value){
+
+    /// Conversión Directa a Texto
+    char digits[24];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer.data.append(digits, result.ptr);
+    return buffer;
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Funciones Cross-Platform ----------------------------------------------
+
+/**
+ * @brief Función para Limpiar la Pantalla (Multiplataforma)
+ */
+void clearScreen(){
+
     /*
-       - Función: Barajear Arreglo
-       - Argumentos:
-            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+       - Función: Limpiar Pantalla
+       - Argumentos: Ninguno 
        - Retorno: Ninguno
-       - Objetivo: Barajear un Arreglo de Pares de Letras
+       - Objetivo: Limpiar la Pantalla de la Consola
     */
 
-    /// Barajear Arreglo de Pares
-    for (int i = 0; i < 36; i++){
+    /// Nuevo Cuadro: Recalcular Geometría si la Terminal Cambió
+    updateLayout();
+
+    /// Limpiar Pantalla
+    if (screen.virtualTerminal) screen << "\033[H\033[2J\033[3J";     // Secuencia ANSI dentro del Mismo Cuadro
+    else{                                                            // Consola de Windows sin ANSI
+
+        presentFrame();                                              // Emitir lo Pendiente antes de Limpiar
+        if (system("cls") != 0) screen << "\n";                     // Comando para Limpiar Pantalla en Windows
 
-        int azar = rand() % 36;               // Generación de número aleatorio entre 0 y 36
-        std::string temp = pairs[i];          // Variable Temporal para Intercambio
-        pairs[i] = pairs[azar];               // Intercambio de Valores
-        pairs[azar] = temp;                   // Asignación del Valor Temporal
-    
     }
+
 }
 
 
 
 
 /**
- * @brief Función para Crear Tablero.
- * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
- * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
- * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+ * @brief Función para Establecer Color de Texto (Multiplataforma)
+ * @param colorCode Código de color (Windows: 0-15, POSIX: códigos ANSI)
  */
-void createBoard(
+void setConsoleColor(int colorCode){
     
-    std::vector<std::vector<std::string>>& visibleCards, 
-    std::vector<std::vector<std::string>>& board, 
-    const std::vector<std::string>& pairs
+    /*
+       - Función: Establecer Color de Texto
+       - Argumentos: 
+            - colorCode (int): Código de Color
+       - Retorno: Ninguno
+       - Objetivo: Establecer el Color de Texto en la Consola
+    */
+    
+    /// Consola de Windows sin ANSI: Emitir lo Pendiente y Usar la API de Consola
+    #ifdef _WIN32                                                   // Windows
+        if (!screen.virtualTerminal){
 
-){
+            presentFrame();                                         // El Color Aplica desde Aquí
+            HANDLE handleConsole = GetStdHandle(STD_OUTPUT_HANDLE); // Obtener el Handle de la Consola
+            SetConsoleTextAttribute(handleConsole, colorCode);      // Establecer Color en Windows
+            return;
+
+        }
+    #endif
+
+    /// Códigos ANSI para Colores Básicos (se Insertan en el Búfer con el Resto del Cuadro)
+    const char* ANSI_COLORS[] = {
+        
+        "\033[0;30m",                          // 0: Negro
+        "\033[0;34m",                          // 1: Azul
+        "\033[0;32m",                          // 2: Verde
+        "\033[0;36m",                          // 3: Cian
+        "\033[0;31m",                          // 4: Rojo
+        "\033[0;35m",                          // 5: Magenta
+        "\033[0;33m",                          // 6: Amarillo
+        "\033[0;37m",                          // 7: Blanco
+        "\033[1;30m",                          // 8: Gris
+        "\033[1;34m",                          // 9: Azul Claro
+        "\033[1;32m",                          // 10: Verde Claro
+        "\033[1;36m",                          // 11: Cian Claro
+        "\033[1;31m",                          // 12: Rojo Claro
+        "\033[1;35m",                          // 13: Magenta Claro
+        "\033[1;33m",                          // 14: Amarillo Claro
+        "\033[1;37m"                           // 15: Blanco Brillante
+
+    };
     
+    /// Establecer Color si el Código es Válido
+    if (colorCode >= 0 && colorCode < 16) screen << ANSI_COLORS[colorCode];
+
+}
+
+
+
+
+/**
+ * @brief Función para Emitir un Sonido (Beep) - Multiplataforma
+ */
+void playBeep(){
+
     /*
-       - Función: Crear Tablero
-       - Argumentos:
-            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
-            - board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
-            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+       - Función: Emitir Sonido
+       - Argumentos: Ninguno
        - Retorno: Ninguno
-       - Objetivo: Crear el Tablero del Juego
+       - Objetivo: Emitir un Sonido (Beep) en la Consola
     */
 
-    /// Creación del Tablero y Ocultación de Cartas
-    int k = 0;                                            // Índice para el Arreglo de Pares
-    for (int i = 0; i < 6; i++){                          // Filas
-  
-        for (int j = 0; j < 6; j++){                      // Columnas
+    /// Emitir Sonido
+    #ifdef _WIN32                          // Windows
+        presentFrame();                    // Mostrar el Cuadro antes del Sonido
+        Beep(750, 300);                    // Frecuencia de 750 Hz durante 300 ms
+    #else                                  // POSIX (Linux, macOS)
+        screen << '\a';                    // Emitir Sonido de Alerta con el Cuadro
+    #endif
 
-            board[i][j] = pairs[k];                       // Asignar Par al Tablero
-            visibleCards[i][j] = "X";                     // Ocultar Carta
-            k++;                                          // Incrementar Índice de Pares
-        }
-    }
 }
 
 
 
 
 /**
- * @brief Función de Bucle Principal.
- * @param minutes (int): Minutos Transcurridos.
- * @param seconds (int): Segundos Transcurridos.
- * @param errorCounter (int): Contador de Errores.
- * @param movesCounter (int): Contador de Movimientos.
- * @param player1Points (int): Puntos del Jugador 1.
- * @param player2Points (int): Puntos del Jugador 2.
- * @param turn (int): Turno del Jugador Actual.
- * @param card1Row (int): Fila de la Primera Carta.
- * @param card1Column (int): Columna de la Primera Carta.
- * @param card2Row (int): Fila de la Segunda Carta.
- * @param card2Column (int): Columna de la Segunda Carta.
- * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
- * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
- * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
- * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ * @brief Función para Pausar la Ejecución - Multiplataforma
  */
-void mainLoop(
-    
-    int& minutes, 
-    int& seconds,
-    int& errorCounter,
-    int& movesCounter, 
-    int& player1Points, 
-    int& player2Points, 
-    int& turn,
-    int& card1Row, 
-    int& card1Column, 
-    int& card2Row, 
-    int& card2Column,
-    const std::vector<std::string>& playerNames, 
-    const std::vector<std::vector<std::string>>& board,
-    std::vector<std::vector<std::string>>& visibleCards 
- 
-){
+void pauseExecution() {
     
     /*
-       - Función: Bucle Principal
+       - Función: Emitir Sonido
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Emitir un Sonido (Beep) en la Consola
+    */
+
+    /// Pausar Ejecución
+    #ifdef _WIN32                                                            // Windows
+        presentFrame();                                                      // Mostrar el Cuadro Pendiente
+        system("pause");                                                     // Comando para Pausar en Windows
+    #else                                                                    // POSIX (Linux, macOS)
+        screen << "Presiona Enter para continuar...";                        // Mensaje para el Usuario
+        presentFrame();                                                      // Mostrar el Cuadro con el Mensaje antes de Esperar
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');  // Esperar Entrada del Usuario
+        std::cin.get();                                                      // Esperar Enter
+    #endif
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Relojes de Turno -----------------------------------------------------
+
+/// Estructura: Reloj de una Mesa (Bolsas de Tiempo, Incremento y un timerfd Armado a la Caída de Bandera)
+struct TurnClock {
+
+    long long bankNanos[2] = {0, 0};             // Tiempo Restante de cada Jugador
+    long long usedNanos[2] = {0, 0};             // Tiempo Consumido por cada Jugador
+    long long incrementNanos = 0;                // Tiempo que se Suma al Completar un Movimiento
+    long long startedAt = 0;                     // Marca Monótona en que Empezó a Correr
+    int running = 0;                             // Jugador cuyo Reloj Corre (0 = Detenido)
+    int flagged = 0;                             // Jugador que se Quedó sin Tiempo (0 = Ninguno)
+    int descriptor = -1;                         // timerfd (CLOCK_MONOTONIC, Tiempo Absoluto)
+
+};
+
+/// Estructura: Reloj de la Partida Interactiva (Espera a la Vez la Entrada y la Bandera)
+struct MatchClock {
+
+    TurnClock clock;                             // Reloj de la Mesa
+    int inputPoller = -1;                        // epoll con la Entrada Estándar y el timerfd
+    int pausePoller = -1;                        // epoll solo con el timerfd (Pausas)
+    bool inputPollable = true;                   // Falso si la Entrada es un Archivo Regular (Nunca Bloquea)
+
+};
+
+/// Excepción: Bandera Caída (Interrumpe la Espera de una Carta o de una Pausa)
+struct TimeForfeit : std::runtime_error {
+
+    int player;                                  // Jugador sin Tiempo
+    explicit TimeForfeit(int who) : std::runtime_error("Bandera Caida"), player(who) {}
+
+};
+
+MatchClock* matchClock = nullptr;                                                 /// Reloj de la Partida (nullptr sin Control de Tiempo)
+
+
+
+
+/**
+ * @brief Función que Lee el Reloj Monótono (el Mismo que Usan los timerfd).
+ * @return (long long) Nanosegundos.
+ */
+inline long long monotonicNanos(){
+
+    /// steady_clock es CLOCK_MONOTONIC en Linux
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+}
+
+
+
+
+/**
+ * @brief Función que Arma (o Desarma) el timerfd de un Reloj a un Instante Absoluto.
+ * @param descriptor (int): El timerfd.
+ * @param deadline (long long): Instante Monótono en Nanosegundos (0 = Desarmar).
+ */
+inline void setTimerDeadline(int descriptor, long long deadline){
+
+    /// Sin timerfd fuera de Linux (nunca se Crea un Reloj)
+    #ifdef __linux__
+        itimerspec spec{};
+        spec.it_value.tv_sec = static_cast<time_t>(deadline / 1000000000LL);
+        spec.it_value.tv_nsec = static_cast<long>(deadline % 1000000000LL);
+        timerfd_settime(descriptor, TFD_TIMER_ABSTIME, &spec, nullptr);
+    #else
+        (void)descriptor; (void)deadline;
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Pone a Correr el Reloj de un Jugador.
+ * @param clock (TurnClock): El Reloj.
+ * @param player (int): Jugador (1 o 2).
+ * @param now (long long): Instante desde el que Corre.
+ */
+void armClock(TurnClock& clock, int player, long long now){
+
+    /// La Bandera Cae al Agotar lo que Queda (el Kernel Avisa por el timerfd)
+    clock.running = player;
+    clock.startedAt = now;
+    setTimerDeadline(clock.descriptor, now + std::max(1LL, clock.bankNanos[player - 1]));
+
+}
+
+
+
+
+/**
+ * @brief Función que Detiene el Reloj Cobrando Hasta un Instante.
+ * @param clock (TurnClock): El Reloj.
+ * @param at (long long): Instante del Cobro (el del Evento, no el de su Proceso).
+ * @return (bool) Falso si la Bandera Cayó.
+ */
+bool chargeClock(TurnClock& clock, long long at){
+
+    /// Reloj Detenido: Nada que Cobrar
+    if (!clock.running) return clock.flagged == 0;
+
+    /// Cobrar sin Pasar de lo que Quedaba
+    long long& bank = clock.bankNanos[clock.running - 1];
+    long long spent = std::min(bank, std::max(0LL, at - clock.startedAt));
+    bank -= spent;
+    clock.usedNanos[clock.running - 1] += spent;
+    if (bank <= 0) clock.flagged = clock.running;
+    clock.running = 0;
+    setTimerDeadline(clock.descriptor, 0);
+    return clock.flagged == 0;
+
+}
+
+
+
+
+/**
+ * @brief Función que Indica si la Bandera del Jugador en Turno ya Cayó en un Instante.
+ * @param clock (TurnClock): El Reloj.
+ * @param at (long long): Instante.
+ * @return (bool) Verdadero si se Agotó su Tiempo.
+ */
+inline bool clockOverdrawn(const TurnClock& clock, long long at){
+
+    /// Solo Corre un Reloj a la Vez
+    return clock.running && at - clock.startedAt >= clock.bankNanos[clock.running - 1];
+
+}
+
+
+
+
+/**
+ * @brief Función que Inicia el Control de Tiempo de la Partida Interactiva.
+ * @param control (std::string): Minutos por Jugador e Incremento en Segundos ("M+S", por ejemplo "5+3").
+ * @throw std::invalid_argument: Si el Control no es Válido.
+ * @throw std::runtime_error: Si el Sistema no tiene timerfd o no se Pueden Crear los Descriptores.
+ */
+void startMatchClock(const std::string& control){
+
+    /*
+       - Función: Iniciar Reloj de la Partida
        - Argumentos:
-            - minutes (int): Minutos Transcurridos.
-            - seconds (int): Segundos Transcurridos.
-            - errorCounter (int): Contador de Errores.
-            - movesCounter (int): Contador de Movimientos.
-            - player1Points (int): Puntos del Jugador 1.
-            - player2Points (int): Puntos del Jugador 2.
-            - turn (int): Turno del Jugador Actual.
-            - card1Row (int): Fila de la Primera Carta.
-            - card1Column (int): Columna de la Primera Carta.
-            - card2Row (int): Fila de la Segunda Carta.
-            - card2Column (int): Columna de la Segunda Carta.
-            - playerNames (std::vector<std::string>): Nombres de los Jugadores.
-            - board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
-            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+            - control (std::string): Control de Tiempo
        - Retorno: Ninguno
-       - Objetivo: Crear el Tablero del Juego
+       - Objetivo: Un timerfd Armado a la Caída de Bandera del Jugador en Turno, Vigilado junto con la Entrada Estándar
+                   por un epoll (para Pedir una Carta) y solo por Otro (para las Pausas que se le Cobran)
     */
 
-    /// Bucle Principal del Juego
-    auto start_time = std::chrono::steady_clock::now();                                       // Empezamos un cronometro
-    bool validCard = false;                                                                   // Bandera de Carta Válida
-    while (player1Points + player2Points < 18){                                               // Mientras no se acabe el Juego           
-        
-        do{                                                                                   // Repetir hasta que la Carta sea Válida   
-        
-            validCard = false;                                                                // Reiniciar Bandera de Carta Válida
-            clearScreen();                                                                    // Limpiar Pantalla
-            printGame(player1Points, player2Points, turn, visibleCards, playerNames);         // Actualizar Tiempo Transcurrido
-            while (true){                                                                     // Mientras
+    /// Interpretar "Minutos+Segundos"
+    size_t plus = control.find('+');
+    double minutesPerPlayer = std::stod(control.substr(0, plus));
+    double increment = (plus == std::string::npos) ? 0.0 : std::stod(control.substr(plus + 1));
+    if (!(minutesPerPlayer > 0) || !(increment >= 0)) throw std::invalid_argument("Control de Tiempo no Valido: " + control);
+
+    #ifndef __linux__
+        throw std::runtime_error("Los Relojes de Turno Requieren timerfd (Linux)");
+    #else
+
+        /// Descriptores
+        MatchClock* state = new MatchClock;
+        state->clock.bankNanos[0] = state->clock.bankNanos[1] = static_cast<long long>(minutesPerPlayer * 60e9);
+        state->clock.incrementNanos = static_cast<long long>(increment * 1e9);
+        state->clock.descriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        state->inputPoller = epoll_create1(EPOLL_CLOEXEC);
+        state->pausePoller = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u32 = 1;
+        if (state->clock.descriptor < 0 || state->inputPoller < 0 || state->pausePoller < 0 ||
+            epoll_ctl(state->inputPoller, EPOLL_CTL_ADD, state->clock.descriptor, &event) != 0 ||
+            epoll_ctl(state->pausePoller, EPOLL_CTL_ADD, state->clock.descriptor, &event) != 0){
+
+            for (int descriptor : {state->clock.descriptor, state->inputPoller, state->pausePoller}) if (descriptor >= 0) close(descriptor);
+            delete state;
+            throw std::runtime_error("No se pudo Crear el Reloj");
+
+        }
+
+        /// La Entrada (un Archivo Regular no se puede Vigilar, pero Tampoco Bloquea)
+        event.data.u32 = 0;
+        state->inputPollable = epoll_ctl(state->inputPoller, EPOLL_CTL_ADD, STDIN_FILENO, &event) == 0;
+        matchClock = state;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Termina el Control de Tiempo.
+ * @return (int) Jugador que Perdió por Tiempo (0 = Ninguno).
+ */
+int stopMatchClock(){
+
+    /// Sin Control de Tiempo
+    if (!matchClock) return 0;
+
+    /// Cerrar los Descriptores
+    int flagged = matchClock->clock.flagged;
+    close(matchClock->clock.descriptor);
+    close(matchClock->inputPoller);
+    close(matchClock->pausePoller);
+    delete matchClock;
+    matchClock = nullptr;
+    return flagged;
+
+}
+
+
+
+
+/**
+ * @brief Función que Cobra la Bandera si el timerfd ya Expiró.
+ * @param state (MatchClock): El Reloj de la Partida.
+ * @throw TimeForfeit: Si Cayó la Bandera.
+ */
+void collectFlag(MatchClock& state){
+
+    /// Vaciar el Contador de Expiraciones y Cobrar
+    #ifdef __linux__
+        uint64_t expirations = 0;
+        if (read(state.clock.descriptor, &expirations, sizeof(expirations)) != sizeof(expirations) && !clockOverdrawn(state.clock, monotonicNanos())) return;
+        int player = state.clock.running;
+        chargeClock(state.clock, monotonicNanos());
+        throw TimeForfeit(player);
+    #else
+        (void)state;
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Espera a que Haya una Entrada por Leer o Caiga la Bandera.
+ * @param state (MatchClock): El Reloj de la Partida.
+ * @throw TimeForfeit: Si Cae la Bandera antes de la Entrada.
+ */
+void awaitInput(MatchClock& state){
+
+    /*
+       - Función: Esperar Entrada
+       - Argumentos:
+            - state (MatchClock): Reloj de la Partida
+       - Retorno: Ninguno
+       - Objetivo: Regresar solo cuando std::cin tiene un Carácter Visible sin Bloquear; los Espacios y Líneas Vacías se
+                   Consumen Aquí para que la Lectura Formateada no se Quede Esperando Fuera del Reloj
+    */
+
+    #ifdef __linux__
+        std::streambuf* input = std::cin.rdbuf();
+        while (state.clock.running){
+
+            /// Saltar Espacios ya Leídos; lo Primero Visible Termina la Espera
+            while (input->in_avail() > 0){
+
+                if (!std::isspace(input->sgetc())) return;
+                input->sbumpc();
+
+            }
+            if (!state.inputPollable) return;
+
+            /// Esperar la Entrada o la Bandera
+            epoll_event events[2];
+            int ready = epoll_wait(state.inputPoller, events, 2, -1);
+            if (ready < 0 && errno == EINTR) continue;                                     // Señal (SIGWINCH)
+            if (ready < 0) return;
+            bool inputReady = false;
+            for (int k = 0; k < ready; k++){
+
+                if (events[k].data.u32 == 1) collectFlag(state);
+                else inputReady = true;
+
+            }
+            if (inputReady && input->sgetc() == std::char_traits<char>::eof()) return;  // Fin de la Entrada
+
+        }
+    #else
+        (void)state;
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Espera una Pausa mientras Corre un Reloj (Termina Antes si Cae la Bandera).
+ * @param state (MatchClock): El Reloj de la Partida.
+ * @param milliseconds (int): Duración de la Pausa.
+ * @throw TimeForfeit: Si Cae la Bandera durante la Pausa.
+ */
+void clockPause(MatchClock& state, int milliseconds){
+
+    /// Esperar Hasta el Final de la Pausa (Reintentando tras Señales)
+    #ifdef __linux__
+        long long until = monotonicNanos() + milliseconds * 1000000LL;
+        for (long long left = until - monotonicNanos(); left > 0; left = until - monotonicNanos()){
+
+            epoll_event event;
+            if (epoll_wait(state.pausePoller, &event, 1, static_cast<int>((left + 999999) / 1000000)) > 0) collectFlag(state);
+
+        }
+    #else
+        (void)state;
+        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    #endif
+
+}
+
+/**
+ * @brief Función que Lee una Coordenada; con Reloj, la Espera Termina si Cae la Bandera.
+ * @param value (int): Coordenada Leída.
+ * @throw TimeForfeit: Si Cae la Bandera antes de la Entrada.
+ */
+inline void readCoordinate(int& value){
+
+    /// Esperar sin Bloquear Fuera del Reloj y Leer
+    if (matchClock) awaitInput(*matchClock);
+    std::cin >> value;
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Helpers ----------------------------------------------------------------
+
+/**
+ * @brief Función que Espera una Cantidad de Milisegundos Específica.
+ * @param milliseconds (int): La Cantidad de Milisegundos a Esperar.
+ */
+inline void waitMilliseconds(int milliseconds){
+
+    /// Con un Reloj Corriendo, la Pausa se Cobra y la Bandera la Interrumpe
+    presentFrame();
+    if (matchClock && matchClock->clock.running) clockPause(*matchClock, milliseconds);
+    else std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+
+}
+
+
+
+
+/**
+ * @brief Función que Espera una Cantidad de Segundos Específica.
+ * @param seconds (int): La Cantidad de Segundos a Esperar.
+ */
+inline void waitSeconds(int seconds){waitMilliseconds(seconds * 1000);}
+
+
+
+
+/**
+ * @brief Función que Imprime un Mensaje de Error utilizando una Función de Error.
+ * @param errorFunction (void(*)()): La Función de Error a Imprimir.
+ */
+void printError(void(*errorFunction)()){
+
+    /*
+       - Función: Imprimir Error
+       - Argumentos:
+            - errorFunction (void(*)()): Función de Error a Imprimir 
+       - Retorno: Ninguno
+       - Objetivo: Imprimir un Mensaje de Error utilizando una Función de Error
+    */
+
+    /// Impresión de Mensaje de Error
+    clearScreen();                  // Limpiar Pantalla
+    errorFunction();                // Llamar a la Función de Error
+    waitSeconds(2);                 // Esperar 2 Segundos
+    clearScreen();                  // Limpiar Pantalla
+
+}
+
+
+
+
+/**
+ * @brief Función que Verifica que un Entero sea Positivo
+ * @param intValue (int): El Entero a Validar.
+ * @throw std::out_of_range Si el Entero no es Positivo.
+ */
+void validatePositiveInt(int intValue) {
+
+    /*
+       - Función: Validar Entero Positivo
+       - Argumentos:
+            - intValue (int): Valor a Validar 
+       - Retorno: Ninguno
+       - Objetivo: Validar que un Entero sea Positivo
+    */
+
+    /// Verificar que el Entero sea Positivo
+    if (intValue < 0) throw std::out_of_range("El Valor debe ser un Entero Positivo");
+
+}
+
+
+
+
+/**
+ * @brief Función que Detecta la Tecla de Pista ('p') tras una Lectura Fallida.
+ * @return (bool) Verdadero si se Presionó la Tecla de Pista (la Línea se Descarta).
+ */
+bool hintKeyPressed(){
+
+    /*
+       - Función: Detectar Tecla de Pista
+       - Argumentos: Ninguno
+       - Retorno: Verdadero si la Entrada era 'p' o 'P'
+       - Objetivo: Distinguir la Tecla de Pista de una Entrada Inválida (el Estado de Fallo ya fue Limpiado)
+    */
+
+    /// Revisar el Siguiente Carácter sin Consumirlo
+    int next = std::cin.peek();
+    if (next != 'p' && next != 'P') return false;
+    std::cin.ignore(MAX_LIMIT, '\n');                 // Descartar la Línea
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función para Reemplazar un Archivo de Forma Atómica.
+ * @param temporaryPath (std::string): El Archivo Nuevo ya Escrito.
+ * @param path (std::string): El Archivo a Reemplazar.
+ * @throw std::runtime_error Si el Reemplazo Falla.
+ */
+void replaceFile(const std::string& temporaryPath, const std::string& path){
+
+    /// Renombrar sobre el Destino (Atómico en el mismo Sistema de Archivos)
+    #ifdef _WIN32
+        bool replaced = MoveFileExA(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+    #else
+        bool replaced = std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+    #endif
+    if (!replaced) throw std::runtime_error("No se pudo Reemplazar " + path);
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Tablas de Finales ----------------------------------------------------
+
+const int TABLEBASE_ENTRIES = (PAIR_COUNT + 1) * (PAIR_COUNT + 2) / 2;            /// Posiciones Canónicas (Pares, Sueltas Conocidas)
+const char* const TABLEBASE_PATH = "memorama.tb";                                 /// Archivo de las Tablas
+
+/// Estructura: Valores de una Posición Canónica al Inicio del Turno sin Pases (Ventaja Esperada de Quien Juega)
+struct TablebaseEntry {
+
+    float value;                                 // Valor con Juego Óptimo de Ambos entre Movimientos que Revelan
+    float firstUnknown;                          // Valor si la Primera Carta es Desconocida
+    float firstSingle;                           // Valor si la Primera es una Suelta Conocida (-1e9 si no hay)
+    float secondUnknown;                         // Primera Desconocida de Letra Nueva: Valor si la Segunda es Desconocida
+    float secondSingle;                          // Primera Desconocida de Letra Nueva: Valor si la Segunda es una Suelta (-1e9 si no hay)
+
+};
+
+/// Estructura: Encabezado del Archivo de Tablas
+struct TablebaseHeader {
+
+    char magic[8];                               // Firma "MEMTB001"
+    uint32_t pairs;                              // Pares Máximos (18)
+    uint32_t entries;                            // Entradas del Archivo
+
+};
+
+const TablebaseEntry* tablebase = nullptr;                                        /// Tablas Cargadas (nullptr si no Hay)
+
+
+
+
+/**
+ * @brief Función que Calcula el Índice de una Posición Canónica.
+ * @param pairs (int): Pares sin Descubrir que no son Pares Conocidos (0-18).
+ * @param singles (int): Letras con una sola Carta Vista (0-pares).
+ * @return (int) Índice en [0, TABLEBASE_ENTRIES), sin Huecos ni Colisiones.
+ */
+inline int tablebaseIndex(int pairs, int singles){return pairs * (pairs + 1) / 2 + singles;}
+
+
+
+
+/**
+ * @brief Función que Calcula las Tablas por Programación Dinámica.
+ * @param entries (TablebaseEntry*): Destino de TABLEBASE_ENTRIES Entradas.
+ */
+void buildTablebase(TablebaseEntry* entries){
+
+    /*
+       - Función: Calcular Tablas
+       - Argumentos:
+            - entries (TablebaseEntry*): Destino
+       - Retorno: Ninguno
+       - Objetivo: Con Memoria Perfecta, las Letras son Intercambiables y las Posiciones no Importan: una Posición
+                   es (n Pares, k Sueltas) con u = 2n - k Desconocidas, y los Pares Conocidos se Toman Antes.
+                   Cada Valor Depende de Pares Menores o de más Sueltas con los mismos Pares, así que se Recorre n
+                   Ascendente y k Descendente. Voltear Dos Sueltas Conocidas (Pasar) queda Fuera del Modelo: Repite
+                   la Posición con el Rival en Turno y Crearía Ciclos. Los Valores son Óptimos solo entre los
+                   Movimientos que Revelan Alguna Carta; con Pases, una Posición de Valor Negativo con Dos o más
+                   Sueltas Valdría al menos 0 (Pasar y que el Rival Pase También)
+    */
+
+    /// Fin de la Partida (los Valores se Encadenan en Doble Precisión y se Guardan en Simple)
+    const double NONE = -1e9;
+    std::array<double, TABLEBASE_ENTRIES> values;
+    values[0] = 0.0;
+    entries[0] = TablebaseEntry{0.0f, 0.0f, static_cast<float>(NONE), 0.0f, static_cast<float>(NONE)};
+    auto value = [&](int n, int k){return values[tablebaseIndex(n, k)];};
+
+    for (int n = 1; n <= PAIR_COUNT; n++){
+
+        for (int k = n; k >= 0; k--){
+
+            double u = 2 * n - k, fresh = u - k;                                    // Desconocidas y de Letra Nueva
+
+            /// Primera Desconocida: Pareja de una Suelta (se Toma), o Letra Nueva y se Elige la Segunda
+            double secondUnknown = NONE, secondSingle = NONE, firstUnknown = 0.0;
+            if (k > 0) firstUnknown += k / u * (1.0 + value(n - 1, k - 1));
+            if (fresh > 0){
+
+                double rest = u - 1;                                                // Desconocidas tras la Primera
+                secondUnknown = 1.0 / rest * (1.0 + value(n - 1, k))               // Su Pareja
+                              - k / rest * (1.0 + value(n - 1, k));                  // Pareja de otra Suelta: el Rival la Toma
+                if (rest - 1 - k > 0) secondUnknown -= (rest - 1 - k) / rest * value(n, k + 2); // Otra Letra Nueva
+                if (k > 0) secondSingle = -value(n, k + 1);                          // Suelta Vista: no Revela Nada
+                firstUnknown += fresh / u * std::max(secondUnknown, secondSingle);
+
+            }
+
+            /// Primera una Suelta Conocida y Segunda Desconocida
+            double firstSingle = NONE;
+            if (k > 0){
+
+                firstSingle = 1.0 / u * (1.0 + value(n - 1, k - 1)) - (k - 1) / u * (1.0 + value(n - 1, k - 1));
+                if (fresh > 0) firstSingle -= fresh / u * value(n, k + 1);
+
+            }
+
+            /// Guardar
+            values[tablebaseIndex(n, k)] = std::max(firstUnknown, firstSingle);
+            TablebaseEntry& entry = entries[tablebaseIndex(n, k)];
+            entry.value = static_cast<float>(values[tablebaseIndex(n, k)]);
+            entry.firstUnknown = static_cast<float>(firstUnknown);
+            entry.firstSingle = static_cast<float>(firstSingle);
+            entry.secondUnknown = static_cast<float>(secondUnknown);
+            entry.secondSingle = static_cast<float>(secondSingle);
+
+        }
+
+    }
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Rastreo de Cartas ----------------------------------------------------
+
+/// Estructura: Memoria Incremental de todas las Cartas Vistas desde el Reparto
+struct CardTracker {
+
+    int8_t letterAt[CARD_COUNT];                 // Letra Vista en cada Posición (-1 si Nunca se Vio)
+    bool matched[CARD_COUNT];                    // Posiciones ya Emparejadas
+    int8_t seen[PAIR_COUNT][2];                  // Posiciones Vistas y no Emparejadas de cada Letra
+    int8_t seenCount[PAIR_COUNT];                // Número de Posiciones Vistas de cada Letra
+    int8_t unknown[CARD_COUNT];                  // Lista de Posiciones Nunca Vistas
+    int8_t unknownSlot[CARD_COUNT];              // Índice de cada Posición en la Lista (-1 si ya se Vio)
+    int unknownCount;                            // Número de Posiciones Nunca Vistas
+    int8_t pairs[PAIR_COUNT];                    // Pila de Letras con ambas Cartas Vistas
+    int8_t pairSlot[PAIR_COUNT];                 // Índice de cada Letra en la Pila (-1 si no está)
+    int pairCount;                               // Pares Completos Conocidos
+    int8_t singles[PAIR_COUNT];                  // Lista de Letras con una sola Carta Vista
+    int8_t singleSlot[PAIR_COUNT];               // Índice de cada Letra en la Lista (-1 si no está)
+    int knownSingles;                            // Letras con una sola Carta Vista
+    int pendingFirst;                            // Primera Carta del Movimiento en Curso (-1 si Ninguna)
+    bool pendingSeen;                            // La Primera Carta ya se Había Visto antes de Voltearla
+
+};
+
+
+
+
+/// Estructura: Sugerencia de Jugada
+struct Hint {
+
+    int first;                                   // Posición Sugerida para Voltear
+    int second;                                  // Segunda Posición si el Par es Seguro (-1 si no)
+    double probability;                          // Probabilidad de Encontrar Pareja en este Movimiento
+    double advantage;                            // Ventaja Esperada según las Tablas de Finales (NAN sin Tablas)
+
+};
+
+
+
+
+/**
+ * @brief Función para Reiniciar el Rastreo al Repartir.
+ * @param tracker (CardTracker): El Rastreo a Reiniciar.
+ */
+void resetTracker(CardTracker& tracker){
+
+    /// Todas las Posiciones Desconocidas
+    for (int i = 0; i < CARD_COUNT; i++){
+
+        tracker.letterAt[i] = -1;
+        tracker.matched[i] = false;
+        tracker.unknown[i] = static_cast<int8_t>(i);
+        tracker.unknownSlot[i] = static_cast<int8_t>(i);
+
+    }
+
+    /// Ninguna Letra Vista
+    for (int l = 0; l < PAIR_COUNT; l++){
+
+        tracker.seenCount[l] = 0;
+        tracker.pairSlot[l] = -1;
+        tracker.singleSlot[l] = -1;
+
+    }
+    tracker.unknownCount = CARD_COUNT;
+    tracker.pairCount = 0;
+    tracker.knownSingles = 0;
+    tracker.pendingFirst = -1;
+    tracker.pendingSeen = false;
+
+}
+
+
+
+
+/**
+ * @brief Función para Registrar una Carta Volteada.
+ * @param tracker (CardTracker): El Rastreo.
+ * @param position (int): La Posición Volteada (fila * 6 + columna).
+ * @param letter (int): La Letra de la Carta (0-17).
+ */
+void trackReveal(CardTracker& tracker, int position, int letter){
+
+    /*
+       - Función: Registrar Carta Volteada
+       - Argumentos:
+            - tracker (CardTracker): Rastreo
+            - position (int): Posición Volteada
+            - letter (int): Letra de la Carta
+       - Retorno: Ninguno
+       - Objetivo: Actualizar Desconocidas, Sueltas y Pares Conocidos en O(1)
+    */
+
+    /// Una Carta ya Vista no Aporta Información
+    if (tracker.letterAt[position] >= 0 || tracker.matched[position]) return;
+
+    /// Quitar de la Lista de Desconocidas (Intercambio con la Última)
+    int unknownSlot = tracker.unknownSlot[position];
+    int lastUnknown = tracker.unknown[--tracker.unknownCount];
+    tracker.unknown[unknownSlot] = static_cast<int8_t>(lastUnknown);
+    tracker.unknownSlot[lastUnknown] = static_cast<int8_t>(unknownSlot);
+    tracker.unknownSlot[position] = -1;
+
+    /// Registrar la Letra
+    tracker.letterAt[position] = static_cast<int8_t>(letter);
+    tracker.seen[letter][tracker.seenCount[letter]++] = static_cast<int8_t>(position);
+    if (tracker.seenCount[letter] == 1){                                              // Primera Carta de la Letra
+
+        tracker.singleSlot[letter] = static_cast<int8_t>(tracker.knownSingles);
+        tracker.singles[tracker.knownSingles++] = static_cast<int8_t>(letter);
+
+    }
+    else{                                                                             // Par Completo Conocido
+
+        int slot = tracker.singleSlot[letter];                                        // Sacar de las Sueltas (Intercambio con la Última)
+        int last = tracker.singles[--tracker.knownSingles];
+        tracker.singles[slot] = static_cast<int8_t>(last);
+        tracker.singleSlot[last] = static_cast<int8_t>(slot);
+        tracker.singleSlot[letter] = -1;
+        tracker.pairSlot[letter] = static_cast<int8_t>(tracker.pairCount);
+        tracker.pairs[tracker.pairCount++] = static_cast<int8_t>(letter);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Registrar la Primera Carta de un Movimiento.
+ * @param tracker (CardTracker): El Rastreo.
+ * @param position (int): La Posición Volteada.
+ * @param letter (int): La Letra de la Carta.
+ */
+inline void trackFirst(CardTracker& tracker, int position, int letter){
+
+    /// Recordar si ya se Conocía (Decide qué Tabla Aplica a la Segunda Carta)
+    tracker.pendingSeen = tracker.letterAt[position] >= 0;
+    trackReveal(tracker, position, letter);
+    tracker.pendingFirst = position;
+
+}
+
+
+
+
+/**
+ * @brief Función para Registrar el Resultado de un Movimiento.
+ * @param tracker (CardTracker): El Rastreo.
+ * @param first (int): La Primera Posición Volteada.
+ * @param second (int): La Segunda Posición Volteada.
+ * @param isMatch (bool): Indica si las Cartas Hicieron Pareja.
+ */
+void trackResolve(CardTracker& tracker, int first, int second, bool isMatch){
+
+    /// Movimiento Terminado
+    tracker.pendingFirst = -1;
+    if (!isMatch) return;                                                             // Sin Pareja: Ambas Quedan Vistas
+
+    /// Sacar el Par de la Pila de Pares Conocidos (Intercambio con el Último)
+    int letter = tracker.letterAt[first];
+    int slot = tracker.pairSlot[letter];
+    int last = tracker.pairs[--tracker.pairCount];
+    tracker.pairs[slot] = static_cast<int8_t>(last);
+    tracker.pairSlot[last] = static_cast<int8_t>(slot);
+    tracker.pairSlot[letter] = -1;
+
+    /// Marcar Emparejadas
+    tracker.seenCount[letter] = 0;
+    tracker.matched[first] = tracker.matched[second] = true;
+    tracker.letterAt[first] = tracker.letterAt[second] = -1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Sugiere la Mejor Jugada con la Información Vista.
+ * @param tracker (CardTracker): El Rastreo.
+ * @return (Hint) La Sugerencia (first = -1 si no hay Cartas por Voltear).
+ */
+Hint queryHint(const CardTracker& tracker){
+
+    /*
+       - Función: Consultar Pista
+       - Argumentos:
+            - tracker (CardTracker): Rastreo
+       - Retorno: Sugerencia
+       - Objetivo: Responder en O(1) sin Recorrer el Tablero; con Tablas de Finales Cargadas, Elegir entre Carta
+                   Desconocida y Suelta Conocida por su Valor en las Tablas y Reportar la Ventaja Esperada
+    */
+
+    /// Posición Canónica Actual (n Pares sin Contar los Conocidos, k Sueltas)
+    int unknownLeft = tracker.unknownCount;
+    int pairs = (unknownLeft + tracker.knownSingles) / 2;
+    auto entry = [&](int singles){return tablebase ? &tablebase[tablebaseIndex(pairs, singles)] : nullptr;};
+
+    /// Segunda Carta del Movimiento en Curso
+    if (tracker.pendingFirst >= 0){
+
+        int letter = tracker.letterAt[tracker.pendingFirst];
+        if (tracker.seenCount[letter] == 2){                                          // La Pareja ya se Vio
+
+            int partner = tracker.seen[letter][0] == tracker.pendingFirst ? tracker.seen[letter][1] : tracker.seen[letter][0];
+            const TablebaseEntry* known = entry(tracker.knownSingles);
+            return Hint{partner, -1, 1.0, known ? tracker.pairCount + known->value : NAN};
+
+        }
+        if (unknownLeft == 0) return Hint{-1, -1, 0.0, NAN};
+        const TablebaseEntry* before = tracker.pairCount > 0 ? nullptr : entry(tracker.knownSingles - !tracker.pendingSeen);
+        if (before && tracker.pendingSeen) return Hint{tracker.unknown[0], -1, 1.0 / unknownLeft, before->firstSingle};
+        if (before && before->secondSingle > before->secondUnknown){                  // Mejor no Revelar Nada
+
+            for (int s = 0; s < tracker.knownSingles; s++){
+
+                int position = tracker.seen[tracker.singles[s]][0];
+                if (position != tracker.pendingFirst) return Hint{position, -1, 0.0, before->secondSingle};
+
+            }
+
+        }
+        return Hint{tracker.unknown[0], -1, 1.0 / unknownLeft, before ? before->secondUnknown : NAN}; // Su Pareja está entre las Desconocidas
+
+    }
+
+    /// Par Completo Conocido: Pareja Segura
+    const TablebaseEntry* current = entry(tracker.knownSingles);
+    if (tracker.pairCount > 0){
+
+        int letter = tracker.pairs[tracker.pairCount - 1];
+        return Hint{tracker.seen[letter][0], tracker.seen[letter][1], 1.0, current ? tracker.pairCount + current->value : NAN};
+
+    }
+
+    /// Abrir con una Suelta si las Tablas lo Prefieren (la Segunda será Desconocida)
+    if (unknownLeft == 0) return Hint{-1, -1, 0.0, NAN};
+    if (current && current->firstSingle > current->firstUnknown) return Hint{tracker.seen[tracker.singles[0]][0], -1, 1.0 / unknownLeft, current->firstSingle};
+
+    /// Voltear una Desconocida: Coincide con una Suelta, o luego con otra Desconocida
+    double singles = tracker.knownSingles;
+    double probability = singles / unknownLeft;
+    if (unknownLeft > 1) probability += (unknownLeft - singles) / unknownLeft / (unknownLeft - 1);
+    return Hint{tracker.unknown[0], -1, probability, current ? current->firstUnknown : NAN};
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Validación de Movimientos --------------------------------------------
+
+const uint32_t HUMAN_MIN_INTERVAL = 120;                                          /// Milisegundos Mínimos entre Volteos Humanos
+const uint8_t RATE_BURST = 4;                                                     /// Volteos Rápidos Seguidos que se Toleran
+const uint16_t FLAG_STRIKES = 3;                                                  /// Volteos Demasiado Rápidos para Marcar la Conexión
+
+/// Veredictos de Validación (Banderas Combinables; 0 es Movimiento Válido)
+enum MoveVerdict : uint8_t {
+
+    MOVE_OK = 0,                                 // Movimiento Válido
+    MOVE_OUT_OF_RANGE = 1,                       // Fila o Columna fuera de 0-5
+    MOVE_REVEALED = 2,                           // Carta ya Descubierta
+    MOVE_SAME_CARD = 4,                          // Segunda Carta Igual a la Primera
+    MOVE_OUT_OF_TURN = 8,                        // Jugador sin Turno
+    MOVE_TOO_FAST = 16,                          // Más Rápido de lo Humanamente Posible
+    MOVE_NO_TABLE = 32                           // Mesa Inexistente (el Volteo no se Evalúa)
+
+};
+
+/// Estructura: Estado de una Mesa para Validar (Tablero como Máscara de Bits)
+struct MoveGuard {
+
+    uint64_t hidden = 0;                         // Bit i Encendido: Carta i Boca Abajo
+    int8_t pendingFirst = -1;                    // Primera Carta del Movimiento en Curso (-1 si no Hay)
+    uint8_t turn = 1;                            // Jugador en Turno (1 o 2)
+
+};
+
+/// Estructura: Volteo Recibido
+struct MoveRequest {
+
+    uint32_t table;                              // Mesa del Movimiento
+    uint8_t player;                              // Jugador que lo Envía (1 o 2)
+    int8_t row;                                  // Fila Pedida
+    int8_t column;                               // Columna Pedida
+    uint32_t timestamp;                          // Milisegundos desde que se Abrió la Conexión
+
+};
+
+/// Estructura: Límite de Ritmo de una Conexión (Cubeta de Fichas)
+struct RateLimiter {
+
+    uint32_t lastRefill = 0;                     // Momento de la Última Recarga
+    uint8_t tokens = RATE_BURST;                 // Volteos Disponibles
+    uint16_t strikes = 0;                        // Volteos Rechazados por Rápidos
+    bool flagged = false;                        // Conexión Marcada como Sospechosa
+
+};
+
+
+
+
+/**
+ * @brief Función que Reconstruye el Estado de Validación desde las Cartas Visibles.
+ * @param guard (MoveGuard): El Estado a Reconstruir.
+ * @param visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles.
+ * @param turn (int): Turno del Jugador Actual.
+ */
+void resetGuard(MoveGuard& guard, const std::vector<std::vector<std::string>>& visibleCards, int turn){
+
+    /// Una Carta Boca Abajo es un Bit Encendido
+    guard.hidden = 0;
+    for (int k = 0; k < CARD_COUNT; k++) guard.hidden |= static_cast<uint64_t>(visibleCards[k / 6][k % 6] == "X") << k;
+    guard.pendingFirst = -1;
+    guard.turn = static_cast<uint8_t>(turn);
+
+}
+
+
+
+
+/**
+ * @brief Función que Registra la Primera Carta de un Movimiento en el Estado de Validación.
+ * @param guard (MoveGuard): El Estado.
+ * @param position (int): Posición de la Carta (0-35).
+ */
+inline void guardFirst(MoveGuard& guard, int position){
+
+    /// La Carta queda Boca Arriba y Pendiente
+    guard.hidden &= ~(uint64_t(1) << position);
+    guard.pendingFirst = static_cast<int8_t>(position);
+
+}
+
+
+
+
+/**
+ * @brief Función que Valida un Volteo contra el Estado de la Mesa.
+ * @param guard (MoveGuard): El Estado de la Mesa.
+ * @param player (int): Jugador que Voltea (1 o 2).
+ * @param row (int): Fila Pedida.
+ * @param column (int): Columna Pedida.
+ * @return (uint8_t) Banderas de MoveVerdict (0 si es Válido).
+ */
+inline uint8_t validateMove(const MoveGuard& guard, int player, int row, int column){
+
+    /*
+       - Función: Validar Volteo
+       - Argumentos:
+            - guard (MoveGuard): Estado de la Mesa
+            - player (int): Jugador que Voltea
+            - row (int): Fila Pedida
+            - column (int): Columna Pedida
+       - Retorno: Banderas de Veredicto
+       - Objetivo: Calcular Todas las Reglas con Aritmética sobre la Máscara, sin Saltos Dependientes de los Datos
+    */
+
+    /// Rango: un Negativo como Unsigned es Mayor que 5
+    unsigned r = static_cast<unsigned>(row), c = static_cast<unsigned>(column);
+    unsigned outOfRange = (r > 5) | (c > 5);
+    unsigned position = (r * 6 + c) & 63;                                    // Índice Seguro aun Fuera de Rango
+
+    /// Reglas sobre la Máscara
+    unsigned inRange = outOfRange ^ 1;
+    unsigned revealed = inRange & static_cast<unsigned>(~(guard.hidden >> position) & 1);
+    unsigned same = inRange & static_cast<unsigned>(static_cast<int>(position) == guard.pendingFirst);
+    unsigned outOfTurn = static_cast<unsigned>(player != guard.turn);
+    return static_cast<uint8_t>(outOfRange * MOVE_OUT_OF_RANGE | revealed * MOVE_REVEALED | same * MOVE_SAME_CARD | outOfTurn * MOVE_OUT_OF_TURN);
+
+}
+
+
+
+
+/**
+ * @brief Función que Aplica el Límite de Ritmo a un Volteo.
+ * @param limiter (RateLimiter): El Límite de la Conexión.
+ * @param timestamp (uint32_t): Momento del Volteo en Milisegundos.
+ * @return (uint8_t) MOVE_TOO_FAST si el Volteo Excede el Ritmo Humano, 0 si no.
+ */
+inline uint8_t throttleMove(RateLimiter& limiter, uint32_t timestamp){
+
+    /*
+       - Función: Limitar Ritmo
+       - Argumentos:
+            - limiter (RateLimiter): Límite de la Conexión
+            - timestamp (uint32_t): Momento del Volteo
+       - Retorno: MOVE_TOO_FAST o 0
+       - Objetivo: Recargar una Ficha cada HUMAN_MIN_INTERVAL ms (hasta RATE_BURST); sin Fichas el Volteo se
+                   Rechaza y Suma un Strike, y FLAG_STRIKES Strikes Marcan la Conexión
+    */
+
+    /// Un Momento Anterior a la Última Recarga (Desorden o Reloj que Retrocede) no Recarga ni Retrocede la Cubeta
+    if (static_cast<int32_t>(timestamp - limiter.lastRefill) < 0) timestamp = limiter.lastRefill;
+
+    /// Recarga Proporcional al Tiempo Transcurrido (Conservando el Resto)
+    uint32_t refill = (timestamp - limiter.lastRefill) / HUMAN_MIN_INTERVAL;
+    limiter.lastRefill += refill * HUMAN_MIN_INTERVAL;
+    limiter.tokens = static_cast<uint8_t>(std::min<uint32_t>(RATE_BURST, limiter.tokens + refill));
+
+    /// Consumir Ficha o Registrar Strike
+    unsigned empty = limiter.tokens == 0;
+    limiter.tokens -= static_cast<uint8_t>(empty ^ 1);
+    limiter.strikes += static_cast<uint16_t>(empty);
+    limiter.flagged |= limiter.strikes >= FLAG_STRIKES;
+    return static_cast<uint8_t>(empty * MOVE_TOO_FAST);
+
+}
+
+
+
+
+/**
+ * @brief Función que Valida un Lote de Volteos de Muchas Mesas.
+ * @param guards (MoveGuard*): Estado de cada Mesa.
+ * @param tables (size_t): Número de Mesas (Largo de guards; limiters Tiene el Doble).
+ * @param limiters (RateLimiter*): Límite de cada Conexión (Mesa * 2 + Jugador - 1).
+ * @param requests (MoveRequest*): Los Volteos Recibidos.
+ * @param count (size_t): Número de Volteos.
+ * @param verdicts (uint8_t*): Veredicto de cada Volteo.
+ */
+void validateBatch(const MoveGuard* guards, size_t tables, RateLimiter* limiters, const MoveRequest* requests, size_t count, uint8_t* verdicts){
+
+    /*
+       - Función: Validar Lote
+       - Argumentos:
+            - guards (MoveGuard*): Estado de cada Mesa
+            - tables (size_t): Número de Mesas
+            - limiters (RateLimiter*): Límite de cada Conexión
+            - requests (MoveRequest*): Volteos Recibidos
+            - count (size_t): Número de Volteos
+            - verdicts (uint8_t*): Veredictos
+       - Retorno: Ninguno
+       - Objetivo: Etapa Independiente del Render: Reglas del Tablero más Ritmo por Conexión; los Volteos de una
+                   misma Mesa en un Lote se Validan contra el mismo Estado (el Motor lo Actualiza al Aplicarlos)
+    */
+
+    /// Un Veredicto por Volteo
+    for (size_t i = 0; i < count; i++){
+
+        const MoveRequest& request = requests[i];
+        if (request.table >= tables){verdicts[i] = MOVE_NO_TABLE; continue;}         // Índice Recibido: nunca sin Comprobar
+        uint8_t verdict = validateMove(guards[request.table], request.player, request.row, request.column);
+        verdicts[i] = verdict | throttleMove(limiters[request.table * 2 + ((request.player - 1) & 1)], request.timestamp);
+
+    }
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Flujo de Turnos ------------------------------------------------------
+
+const uint16_t FLOW_PAUSE = 2000;                                                 /// Milisegundos de cada Pausa del Flujo
+
+/// Estados del Flujo de un Movimiento (Punto donde se Reanuda)
+enum FlowState : uint8_t {
+
+    FLOW_FIRST,                                  // Espera la Primera Carta
+    FLOW_SECOND,                                 // Espera la Segunda Carta
+    FLOW_RETRY_FIRST,                            // Pausa tras Rechazar la Primera Carta
+    FLOW_RETRY_SECOND,                           // Pausa tras Rechazar la Segunda Carta
+    FLOW_MATCH,                                  // Pausa Mostrando la Pareja
+    FLOW_NO_MATCH,                               // Pausa Mostrando las Cartas Distintas
+    FLOW_HIDE,                                   // Pausa tras Taparlas y Cambiar de Turno
+    FLOW_DONE                                    // Partida Terminada
+
+};
+
+/// Lo que el Flujo Espera para Continuar
+enum FlowAwait : uint8_t {
+
+    AWAIT_PICK,                                  // Una Carta (Fila y Columna)
+    AWAIT_TIMER,                                 // Que Pase el Tiempo Pedido
+    AWAIT_DONE                                   // Nada: la Partida Terminó
+
+};
+
+/// Lo que Ocurrió en el Último Paso (para Mostrarlo)
+enum FlowEvent : uint8_t {
+
+    EVENT_NONE,                                  // Nada que Mostrar
+    EVENT_RANGE,                                 // Carta fuera de Rango (se Vuelve a Pedir)
+    EVENT_REVEALED,                              // Carta ya Descubierta (Cuenta como Error)
+    EVENT_SAME_CARD,                             // Segunda Carta Igual a la Primera (Cuenta como Error)
+    EVENT_FIRST,                                 // Primera Carta Volteada
+    EVENT_MATCH,                                 // Segunda Carta Volteada: Pareja
+    EVENT_NO_MATCH,                              // Segunda Carta Volteada: Distintas
+    EVENT_MOVE                                   // Movimiento Completo (Momento de Guardar)
+
+};
+
+/// Estructura: Resultado de Reanudar el Flujo
+struct FlowStep {
+
+    uint8_t await;                               // Qué Espera Ahora (FlowAwait)
+    uint8_t event;                               // Qué Ocurrió (FlowEvent)
+    uint16_t milliseconds;                       // Duración de la Espera si es AWAIT_TIMER
+
+};
+
+/// Estructura: Marco Fijo de una Partida (Todo lo que se Conserva entre Suspensiones)
+struct TurnFlow {
+
+    std::array<uint8_t, CARD_COUNT> cards;       // Letra de cada Posición (0-17)
+    MoveGuard guard;                             // Cartas Boca Abajo, Primera Pendiente y Turno
+    uint8_t state;                               // Punto de Reanudación (FlowState)
+    int8_t second;                               // Segunda Carta del Movimiento en Curso
+    uint8_t points[2];                           // Puntos de cada Jugador
+    uint16_t moves;                              // Contador de Movimientos
+    uint16_t errors;                             // Contador de Errores
+
+};
+
+
+
+
+/**
+ * @brief Función que Prepara el Flujo de una Partida.
+ * @param flow (TurnFlow): El Marco a Preparar.
+ * @param cards (std::array<uint8_t, CARD_COUNT>): Letra de cada Posición.
+ * @param hidden (uint64_t): Cartas Boca Abajo (Bit i = Posición i).
+ * @param turn (int): Jugador en Turno (1 o 2).
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param moves (int): Movimientos ya Jugados.
+ * @param errors (int): Errores ya Cometidos.
+ * @return (FlowStep) Lo que Espera el Flujo al Empezar.
+ */
+FlowStep startFlow(TurnFlow& flow, const std::array<uint8_t, CARD_COUNT>& cards, uint64_t hidden, int turn, int player1Points, int player2Points, int moves, int errors){
+
+    /// Estado Inicial del Marco
+    flow.cards = cards;
+    flow.guard.hidden = hidden;
+    flow.guard.pendingFirst = -1;
+    flow.guard.turn = static_cast<uint8_t>(turn);
+    flow.second = -1;
+    flow.points[0] = static_cast<uint8_t>(player1Points);
+    flow.points[1] = static_cast<uint8_t>(player2Points);
+    flow.moves = static_cast<uint16_t>(moves);
+    flow.errors = static_cast<uint16_t>(errors);
+
+    /// Una Partida ya Completa no Espera Nada
+    flow.state = player1Points + player2Points < PAIR_COUNT ? FLOW_FIRST : FLOW_DONE;
+    return {static_cast<uint8_t>(flow.state == FLOW_DONE ? AWAIT_DONE : AWAIT_PICK), EVENT_NONE, 0};
+
+}
+
+
+
+
+/**
+ * @brief Función que Cierra un Movimiento y Pasa al Siguiente.
+ * @param flow (TurnFlow): El Marco.
+ * @return (FlowStep) Espera de la Siguiente Carta o Fin de la Partida.
+ */
+inline FlowStep finishFlowMove(TurnFlow& flow){
+
+    /// Sin Carta Pendiente; la Partida Acaba al Descubrir los 18 Pares
+    flow.guard.pendingFirst = -1;
+    flow.second = -1;
+    flow.state = flow.points[0] + flow.points[1] < PAIR_COUNT ? FLOW_FIRST : FLOW_DONE;
+    return {static_cast<uint8_t>(flow.state == FLOW_DONE ? AWAIT_DONE : AWAIT_PICK), EVENT_MOVE, 0};
+
+}
+
+
+
+
+/**
+ * @brief Función que Reanuda el Flujo con la Carta Elegida.
+ * @param flow (TurnFlow): El Marco (Debe Esperar AWAIT_PICK).
+ * @param row (int): Fila Elegida.
+ * @param column (int): Columna Elegida.
+ * @return (FlowStep) Lo Ocurrido y lo que Espera Ahora.
+ */
+FlowStep flowPick(TurnFlow& flow, int row, int column){
+
+    /*
+       - Función: Reanudar con Carta
+       - Argumentos:
+            - flow (TurnFlow): Marco de la Partida
+            - row (int): Fila Elegida
+            - column (int): Columna Elegida
+       - Retorno: Evento y Espera
+       - Objetivo: Aplicar las Reglas de mainLoop a una Carta sin Leer ni Dibujar nada, para que la Terminal,
+                   un Bot o un Planificador de muchas Partidas Conduzcan el mismo Flujo
+    */
+
+    /// Validar contra la Máscara (siempre con el Turno en Curso: Quién Elige lo Decide el que Conduce)
+    uint8_t verdict = validateMove(flow.guard, flow.guard.turn, row, column);
+    if (verdict & MOVE_OUT_OF_RANGE) return {AWAIT_PICK, EVENT_RANGE, 0};
+    bool second = flow.state == FLOW_SECOND;
+    if (verdict & (MOVE_SAME_CARD | MOVE_REVEALED)){
+
+        flow.errors++;
+        flow.state = second ? FLOW_RETRY_SECOND : FLOW_RETRY_FIRST;
+        return {AWAIT_TIMER, static_cast<uint8_t>(verdict & MOVE_SAME_CARD ? EVENT_SAME_CARD : EVENT_REVEALED), FLOW_PAUSE};
+
+    }
+
+    /// Primera Carta: Queda Boca Arriba y Pendiente
+    int position = row * 6 + column;
+    if (!second){
+
+        guardFirst(flow.guard, position);
+        flow.state = FLOW_SECOND;
+        return {AWAIT_PICK, EVENT_FIRST, 0};
+
+    }
+
+    /// Segunda Carta: Voltear y Comparar
+    flow.guard.hidden &= ~(uint64_t(1) << position);
+    flow.second = static_cast<int8_t>(position);
+    flow.moves++;
+    if (flow.cards[position] == flow.cards[flow.guard.pendingFirst]){
+
+        flow.state = FLOW_MATCH;
+        return {AWAIT_TIMER, EVENT_MATCH, FLOW_PAUSE};
+
+    }
+    flow.errors++;
+    flow.state = FLOW_NO_MATCH;
+    return {AWAIT_TIMER, EVENT_NO_MATCH, FLOW_PAUSE};
+
+}
+
+
+
+
+/**
+ * @brief Función que Reanuda el Flujo al Vencer su Espera.
+ * @param flow (TurnFlow): El Marco (Debe Esperar AWAIT_TIMER).
+ * @return (FlowStep) Lo Ocurrido y lo que Espera Ahora.
+ */
+FlowStep flowTimer(TurnFlow& flow){
+
+    /// Continuar desde el Punto de Reanudación
+    switch (flow.state){
+
+        case FLOW_RETRY_FIRST:                                                      // Volver a Pedir la Primera
+            flow.state = FLOW_FIRST;
+            return {AWAIT_PICK, EVENT_NONE, 0};
+
+        case FLOW_RETRY_SECOND:                                                     // Volver a Pedir la Segunda
+            flow.state = FLOW_SECOND;
+            return {AWAIT_PICK, EVENT_NONE, 0};
+
+        case FLOW_MATCH:                                                            // Punto al Jugador en Turno
+            flow.points[flow.guard.turn - 1]++;
+            return finishFlowMove(flow);
+
+        case FLOW_NO_MATCH:                                                         // Tapar y Ceder el Turno
+            flow.guard.hidden |= (uint64_t(1) << flow.guard.pendingFirst) | (uint64_t(1) << flow.second);
+            flow.guard.turn = static_cast<uint8_t>(3 - flow.guard.turn);
+            flow.state = FLOW_HIDE;
+            return {AWAIT_TIMER, EVENT_NONE, FLOW_PAUSE};
+
+        case FLOW_HIDE:                                                             // Fin del Movimiento
+            return finishFlowMove(flow);
+
+        default:                                                                    // Sin Espera Pendiente
+            throw std::logic_error("El Flujo no Espera un Temporizador");
+
+    }
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Telemetría -----------------------------------------------------------
+
+const size_t TELEMETRY_RING = 4096;                                               /// Muestras del Anillo (Potencia de 2)
+const int TELEMETRY_DRAIN_MS = 50;                                                /// Milisegundos entre Vaciados a Disco
+
+/// Estructura: Un Intento de Volteo (Registro de Ancho Fijo en el Archivo)
+struct FlipSample {
+
+    uint32_t game;                               // Partida (Segundos del Reloj al Iniciarla)
+    uint32_t atMillis;                           // Milisegundos desde el Inicio de la Partida
+    uint32_t rowMicros;                          // Desde que se Pide la Carta hasta Ingresar la Fila
+    uint32_t thinkMicros;                        // Desde que se Pide la Carta hasta Ingresar la Columna
+    uint32_t betweenMicros;                      // Segunda Carta: desde que se Aceptó la Primera (0 en la Primera)
+    int8_t row;                                  // Fila Ingresada
+    int8_t column;                               // Columna Ingresada
+    uint8_t stage;                               // Carta del Movimiento (1 o 2)
+    uint8_t event;                               // Resultado del Intento (FlowEvent)
+    uint8_t player;                              // Jugador en Turno (1 o 2)
+    uint8_t inputErrors;                         // Entradas no Numéricas o Filas fuera de Rango antes del Intento
+    uint16_t reserved;                           // Relleno
+
+};
+
+/// Estructura: Anillo de un Productor y un Consumidor con Hilo de Vaciado
+struct Telemetry {
+
+    FlipSample slots[TELEMETRY_RING];            // Muestras
+    alignas(64) std::atomic<uint64_t> head{0};   // Próxima Escritura (Solo el Juego)
+    alignas(64) std::atomic<uint64_t> tail{0};   // Próxima Lectura (Solo el Hilo de Vaciado)
+    std::atomic<uint64_t> dropped{0};            // Muestras Perdidas por Anillo Lleno
+    std::atomic<bool> running{true};             // Indica si el Hilo Sigue Activo
+    std::FILE* file = nullptr;                   // Archivo de Salida (Agregando)
+    std::thread thread;                          // Hilo de Vaciado
+
+};
+
+Telemetry* telemetry = nullptr;                                                   /// Telemetría Activa (nullptr si no se Registra)
+
+
+
+
+/**
+ * @brief Función que Registra un Intento de Volteo sin Bloquear.
+ * @param sample (FlipSample): La Muestra.
+ */
+inline void recordFlip(const FlipSample& sample){
+
+    /// Anillo Lleno: se Pierde la Muestra antes que Retrasar la Entrada
+    if (!telemetry) return;
+    uint64_t head = telemetry->head.load(std::memory_order_relaxed);
+    if (head - telemetry->tail.load(std::memory_order_acquire) >= TELEMETRY_RING){
+
+        telemetry->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+
+    }
+    telemetry->slots[head & (TELEMETRY_RING - 1)] = sample;
+    telemetry->head.store(head + 1, std::memory_order_release);
+
+}
+
+
+
+
+/**
+ * @brief Función que Escribe a Disco las Muestras Pendientes del Anillo.
+ * @param state (Telemetry): La Telemetría.
+ */
+void drainTelemetry(Telemetry& state){
+
+    /// Hasta Dos Tramos Contiguos (el Anillo puede Dar la Vuelta)
+    uint64_t tail = state.tail.load(std::memory_order_relaxed);
+    uint64_t head = state.head.load(std::memory_order_acquire);
+    while (tail < head){
+
+        size_t offset = static_cast<size_t>(tail & (TELEMETRY_RING - 1));
+        size_t count = static_cast<size_t>(std::min<uint64_t>(head - tail, TELEMETRY_RING - offset));
+        std::fwrite(state.slots + offset, sizeof(FlipSample), count, state.file);
+        tail += count;
+
+    }
+    state.tail.store(tail, std::memory_order_release);
+    std::fflush(state.file);
+
+}
+
+
+
+
+/**
+ * @brief Función del Hilo de Vaciado.
+ * @param state (Telemetry): La Telemetría.
+ */
+void telemetryLoop(Telemetry& state){
+
+    /// Vaciar Periódicamente y una Última Vez al Terminar
+    while (state.running.load(std::memory_order_acquire)){
+
+        drainTelemetry(state);
+        std::this_thread::sleep_for(std::chrono::milliseconds(TELEMETRY_DRAIN_MS));
+
+    }
+    drainTelemetry(state);
+
+}
+
+
+
+
+/**
+ * @brief Función que Inicia la Telemetría de Volteos.
+ * @param path (std::string): Archivo de Muestras (se Agrega al Final).
+ * @throw std::runtime_error: Si el Archivo no se puede Abrir.
+ */
+void startTelemetry(const std::string& path){
+
+    /// Abrir para Agregar e Iniciar el Hilo
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    if (!file) throw std::runtime_error("No se pudo Abrir " + path);
+    telemetry = new Telemetry;
+    telemetry->file = file;
+    telemetry->thread = std::thread(telemetryLoop, std::ref(*telemetry));
+
+}
+
+
+
+
+/**
+ * @brief Función que Detiene la Telemetría Vaciando lo Pendiente.
+ */
+void stopTelemetry(){
+
+    /// Sin Telemetría Activa
+    if (!telemetry) return;
+
+    /// Detener el Hilo y Cerrar
+    telemetry->running.store(false, std::memory_order_release);
+    telemetry->thread.join();
+    std::fclose(telemetry->file);
+    delete telemetry;
+    telemetry = nullptr;
+
+}
+
+
+
+
+/**
+ * @brief Función que Convierte una Duración a Microsegundos Saturados.
+ * @param from (std::chrono::steady_clock::time_point): Inicio.
+ * @param to (std::chrono::steady_clock::time_point): Fin.
+ * @return (uint32_t) Microsegundos (hasta ~71 Minutos).
+ */
+inline uint32_t elapsedMicros(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to){
+
+    /// Saturar en lugar de Desbordar
+    long long micros = std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+    return static_cast<uint32_t>(std::min<long long>(std::max(0LL, micros), std::numeric_limits<uint32_t>::max()));
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Transmisión a Espectadores -------------------------------------------
+
+const int SPECTATOR_RING = 256;                                                   /// Cuadros Retenidos para Espectadores Lentos
+const int SPECTATOR_FRAME_BYTES = 640;                                            /// Tamaño Máximo de un Cuadro Serializado
+const int SPECTATOR_HEADER_BYTES = 10;                                            /// Tipo, Turno, Puntos, Número de Cuadro y Longitud
+const size_t SPECTATOR_BATCH_BYTES = 16384;                                       /// Bytes Pendientes por Espectador antes de Esperar
+
+/// Tipos de Mensaje del Protocolo de Espectadores
+enum SpectatorMessage : uint8_t {
+
+    MESSAGE_SNAPSHOT = 1,                        // Estado Completo (al Unirse o al Quedarse Atrás)
+    MESSAGE_DIFF = 2,                            // Cartas que Cambiaron desde el Cuadro Anterior
+    MESSAGE_REPLY = 3,                           // Diferencias en Respuesta a un Volteo (Servidor Web)
+    MESSAGE_SEAT = 4                             // Asiento de la Conexión en una Partida con Rival (Servidor Web)
+
+};
+
+/// Estructura: Cuadro Serializado dentro del Anillo
+struct SpectatorFrame {
+
+    uint16_t length = 0;                         // Bytes Usados
+    uint8_t bytes[SPECTATOR_FRAME_BYTES];        // Encabezado y Carga
+
+};
+
+/// Estructura: Espectador Conectado
+struct Spectator {
+
+    int descriptor = -1;                         // Socket del Espectador
+    uint64_t nextSequence = 0;                   // Próximo Cuadro del Anillo por Enviar
+    std::string pending;                         // Bytes por Enviar (Copiados del Anillo)
+    size_t offset = 0;                           // Bytes de pending ya Enviados
+
+};
+
+/// Estructura: Transmisor de una Partida
+struct Broadcaster {
+
+    std::mutex lock;                             // Protege Estado y Anillo (Secciones de Copia Breves)
+    char cards[CARD_COUNT];                      // Último Tablero Visible Publicado
+    uint8_t points[2] = {0, 0};                  // Últimos Puntos Publicados
+    uint8_t turn = 1;                            // Último Turno Publicado
+    std::string names[2];                        // Nombres de los Jugadores
+    uint64_t head = 0;                           // Número del Próximo Cuadro
+    SpectatorFrame ring[SPECTATOR_RING];         // Anillo de Cuadros Serializados una sola Vez
+    int listener = -1;                           // Socket que Acepta Espectadores
+    int wake[2] = {-1, -1};                      // Tubería para Despertar al Hilo Transmisor
+    std::atomic<bool> running{false};            // El Hilo Transmisor Sigue Activo
+    std::thread thread;                          // Hilo Transmisor
+    std::string path;                            // Ruta del Socket
+
+};
+
+Broadcaster* broadcaster = nullptr;                                               /// Transmisor Activo (nullptr si no se Transmite)
+
+
+
+
+/**
+ * @brief Función que Escribe el Encabezado de un Mensaje de Espectador.
+ * @param out (uint8_t*): Destino (al Menos SPECTATOR_HEADER_BYTES).
+ * @param type (SpectatorMessage): Tipo de Mensaje.
+ * @param turn (uint8_t): Turno Publicado.
+ * @param points (const uint8_t[2]): Puntos Publicados.
+ * @param sequence (uint64_t): Número de Cuadro.
+ * @param payload (size_t): Bytes de Carga que Siguen.
+ */
+inline void writeSpectatorHeader(uint8_t* out, SpectatorMessage type, uint8_t turn, const uint8_t points[2], uint64_t sequence, size_t payload){
+
+    /// Campos en Orden Fijo y Little Endian
+    out[0] = type;
+    out[1] = turn;
+    out[2] = points[0];
+    out[3] = points[1];
+    for (int i = 0; i < 4; i++) out[4 + i] = static_cast<uint8_t>(sequence >> (8 * i));
+    out[8] = static_cast<uint8_t>(payload);
+    out[9] = static_cast<uint8_t>(payload >> 8);
+
+}
+
+
+
+
+/**
+ * @brief Función que Serializa el Estado Completo para un Espectador Nuevo.
+ * @param state (Broadcaster): El Estado (con el Candado Tomado).
+ * @param out (std::string): Destino (se Agrega al Final).
+ */
+void serializeSnapshot(const Broadcaster& state, std::string& out){
+
+    /*
+       - Función: Serializar Estado Completo
+       - Argumentos:
+            - state (Broadcaster): Estado Actual
+            - out (std::string): Destino
+       - Retorno: Ninguno
+       - Objetivo: Encabezado, 36 Cartas y Nombres (Longitud de un Byte cada uno)
+    */
+
+    /// Carga: Cartas y Nombres
+    uint8_t bytes[SPECTATOR_FRAME_BYTES];
+    size_t length = SPECTATOR_HEADER_BYTES;
+    std::memcpy(bytes + length, state.cards, CARD_COUNT);
+    length += CARD_COUNT;
+    for (int p = 0; p < 2; p++){
+
+        size_t size = std::min<size_t>(state.names[p].size(), 255);
+        bytes[length++] = static_cast<uint8_t>(size);
+        std::memcpy(bytes + length, state.names[p].data(), size);
+        length += size;
+
+    }
+
+    /// Encabezado con el Número del Próximo Cuadro
+    writeSpectatorHeader(bytes, MESSAGE_SNAPSHOT, state.turn, state.points, state.head, length - SPECTATOR_HEADER_BYTES);
+    out.append(reinterpret_cast<const char*>(bytes), length);
+
+}
+
+
+
+
+/**
+ * @brief Función que Publica un Cuadro de la Partida a los Espectadores.
+ * @param visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ */
+void publishFrame(const std::vector<std::vector<std::string>>& visibleCards, int player1Points, int player2Points, int turn){
+
+    /*
+       - Función: Publicar Cuadro
+       - Argumentos:
+            - visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles
+            - player1Points (int): Puntos del Jugador 1
+            - player2Points (int): Puntos del Jugador 2
+            - turn (int): Turno del Jugador Actual
+       - Retorno: Ninguno
+       - Objetivo: Serializar una sola Vez las Cartas que Cambiaron y Dejar el Cuadro en el Anillo; el Envío
+                   lo Hace el Hilo Transmisor, por lo que la Partida Nunca Espera a un Espectador
+    */
+
+    /// Sin Transmisión Activa
+    if (!broadcaster) return;
+    Broadcaster& state = *broadcaster;
+
+    {
+
+        std::lock_guard<std::mutex> guard(state.lock);
+
+        /// Diferencias contra el Último Cuadro
+        SpectatorFrame& frame = state.ring[state.head % SPECTATOR_RING];
+        size_t length = SPECTATOR_HEADER_BYTES + 1;
+        for (int k = 0; k < CARD_COUNT; k++){
+
+            char card = visibleCards[k / 6][k % 6][0];
+            if (card == state.cards[k]) continue;
+            state.cards[k] = card;
+            frame.bytes[length++] = static_cast<uint8_t>(k);
+            frame.bytes[length++] = static_cast<uint8_t>(card);
+
+        }
+        uint8_t count = static_cast<uint8_t>((length - SPECTATOR_HEADER_BYTES - 1) / 2);
+        bool scoreChanged = state.points[0] != player1Points || state.points[1] != player2Points || state.turn != turn;
+        if (count == 0 && !scoreChanged) return;                             // Cuadro Repetido
+
+        /// Encabezado y Avance del Anillo
+        state.points[0] = static_cast<uint8_t>(player1Points);
+        state.points[1] = static_cast<uint8_t>(player2Points);
+        state.turn = static_cast<uint8_t>(turn);
+        frame.bytes[SPECTATOR_HEADER_BYTES] = count;
+        writeSpectatorHeader(frame.bytes, MESSAGE_DIFF, state.turn, state.points, state.head, length - SPECTATOR_HEADER_BYTES);
+        frame.length = static_cast<uint16_t>(length);
+        state.head++;
+
+    }
+
+    /// Despertar al Hilo Transmisor (sin Bloquear si la Tubería está Llena)
+    #ifndef _WIN32
+        char notice = 1;
+        if (write(state.wake[1], &notice, 1) < 0) {}
+    #endif
+
+}
+
+
+
+
+#ifndef _WIN32
+
+/**
+ * @brief Función que Llena los Bytes Pendientes de un Espectador.
+ * @param state (Broadcaster): El Transmisor.
+ * @param spectator (Spectator): El Espectador.
+ */
+void refillSpectator(Broadcaster& state, Spectator& spectator){
+
+    /*
+       - Función: Llenar Pendientes
+       - Argumentos:
+            - state (Broadcaster): Transmisor
+            - spectator (Spectator): Espectador
+       - Retorno: Ninguno
+       - Objetivo: Copiar los Cuadros que le Faltan; si el Anillo ya los Sobrescribió, el Espectador Pierde esos
+                   Cuadros y Recibe el Estado Completo
+    */
+
+    /// Aún hay Bytes sin Enviar
+    if (spectator.offset < spectator.pending.size()) return;
+    spectator.pending.clear();
+    spectator.offset = 0;
+
+    /// Copiar del Anillo (o Estado Completo si se Quedó Atrás)
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.head - spectator.nextSequence > static_cast<uint64_t>(SPECTATOR_RING)){
+
+        serializeSnapshot(state, spectator.pending);
+        spectator.nextSequence = state.head;
+        return;
+
+    }
+    while (spectator.nextSequence < state.head && spectator.pending.size() < SPECTATOR_BATCH_BYTES){
+
+        const SpectatorFrame& frame = state.ring[spectator.nextSequence % SPECTATOR_RING];
+        spectator.pending.append(reinterpret_cast<const char*>(frame.bytes), frame.length);
+        spectator.nextSequence++;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función del Hilo Transmisor: Acepta Espectadores y les Reparte los Cuadros.
+ * @param state (Broadcaster): El Transmisor.
+ */
+void broadcastLoop(Broadcaster& state){
+
+    /*
+       - Función: Ciclo del Transmisor
+       - Argumentos:
+            - state (Broadcaster): Transmisor
+       - Retorno: Ninguno
+       - Objetivo: Esperar con poll() Conexiones, Cuadros Nuevos y Sockets Listos para Escribir; los Envíos son
+                   no Bloqueantes y un Espectador Lento solo se Atrasa él mismo
+    */
+
+    std::vector<Spectator> spectators;
+    std::vector<pollfd> descriptors;
+    while (state.running){
+
+        /// Descriptores a Vigilar
+        descriptors.clear();
+        descriptors.push_back({state.listener, POLLIN, 0});
+        descriptors.push_back({state.wake[0], POLLIN, 0});
+        uint64_t head;
+        {
+
+            std::lock_guard<std::mutex> guard(state.lock);
+            head = state.head;
+
+        }
+        for (const Spectator& spectator : spectators){
+
+            bool hasWork = spectator.offset < spectator.pending.size() || spectator.nextSequence < head;
+            descriptors.push_back({spectator.descriptor, static_cast<short>(hasWork ? POLLOUT : 0), 0});
+
+        }
+        if (poll(descriptors.data(), descriptors.size(), 200) < 0 && errno != EINTR) break;
+
+        /// Vaciar la Tubería de Aviso
+        if (descriptors[1].revents & POLLIN){
+
+            char drain[256];
+            while (read(state.wake[0], drain, sizeof(drain)) > 0) {}
+
+        }
+
+        /// Enviar a cada Espectador Listo (de Atrás hacia Adelante para Poder Quitar)
+        for (size_t i = spectators.size(); i-- > 0;){
+
+            Spectator& spectator = spectators[i];
+            short events = descriptors[i + 2].revents;
+            bool closed = (events & (POLLERR | POLLHUP | POLLNVAL)) != 0;
+            if (!closed && (events & POLLOUT)){
+
+                refillSpectator(state, spectator);
+                ssize_t sent = send(spectator.descriptor, spectator.pending.data() + spectator.offset, spectator.pending.size() - spectator.offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+                if (sent > 0) spectator.offset += static_cast<size_t>(sent);
+                else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) closed = true;
+
+            }
+            if (closed){
+
+                close(spectator.descriptor);
+                spectators[i] = std::move(spectators.back());
+                spectators.pop_back();
+
+            }
+
+        }
+
+        /// Aceptar Espectadores Nuevos: Reciben el Estado Completo
+        if (descriptors[0].revents & POLLIN){
+
+            int descriptor;
+            while ((descriptor = accept(state.listener, nullptr, nullptr)) >= 0){
+
+                fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+                Spectator spectator;
+                spectator.descriptor = descriptor;
+                {
+
+                    std::lock_guard<std::mutex> guard(state.lock);
+                    serializeSnapshot(state, spectator.pending);
+                    spectator.nextSequence = state.head;
+
+                }
+                spectators.push_back(std::move(spectator));
+
+            }
+
+        }
+
+    }
+
+    /// Cerrar Conexiones (los Espectadores Ven Fin de Archivo)
+    for (Spectator& spectator : spectators) close(spectator.descriptor);
+
+}
+
+#endif
+
+
+
+
+/**
+ * @brief Función que Empieza a Transmitir la Partida en un Socket Unix.
+ * @param path (std::string): Ruta del Socket.
+ * @param visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param playersNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @throw std::runtime_error: Si no se Puede Crear el Socket.
+ */
+void startBroadcast(
+    
+    const std::string& path, 
+    const std::vector<std::vector<std::string>>& visibleCards, 
+    int player1Points, 
+    int player2Points, 
+    int turn, 
+    const std::vector<std::string>& playersNames
+
+){
+
+    /*
+       - Función: Iniciar Transmisión
+       - Argumentos:
+            - path (std::string): Ruta del Socket
+            - visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles
+            - player1Points (int): Puntos del Jugador 1
+            - player2Points (int): Puntos del Jugador 2
+            - turn (int): Turno del Jugador Actual
+            - playersNames (std::vector<std::string>): Nombres de los Jugadores
+       - Retorno: Ninguno
+       - Objetivo: Crear el Socket de Escucha, Fijar el Estado Inicial y Lanzar el Hilo Transmisor
+    */
+
+    #ifdef _WIN32
+        (void)path; (void)visibleCards; (void)player1Points; (void)player2Points; (void)turn; (void)playersNames;
+        throw std::runtime_error("La Transmision a Espectadores no esta Disponible en Windows");
+    #else
+
+        /// Estado Inicial
+        Broadcaster* state = new Broadcaster();
+        for (int k = 0; k < CARD_COUNT; k++) state->cards[k] = visibleCards[k / 6][k % 6][0];
+        state->points[0] = static_cast<uint8_t>(player1Points);
+        state->points[1] = static_cast<uint8_t>(player2Points);
+        state->turn = static_cast<uint8_t>(turn);
+        state->names[0] = playersNames[0];
+        state->names[1] = playersNames[1];
+        state->path = path;
+
+        /// Socket de Escucha no Bloqueante
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)){delete state; throw std::runtime_error("Ruta de Socket Demasiado Larga: " + path);}
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        unlink(path.c_str());                                                // Socket de una Transmisión Anterior
+        state->listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (state->listener < 0 || bind(state->listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(state->listener, 1024) != 0){
+
+            if (state->listener >= 0) close(state->listener);
+            delete state;
+            throw std::runtime_error("No se pudo Abrir el Socket de Espectadores: " + path);
+
+        }
+        fcntl(state->listener, F_SETFL, fcntl(state->listener, F_GETFL) | O_NONBLOCK);
+
+        /// Tubería de Aviso no Bloqueante
+        if (pipe(state->wake) != 0){
+
+            close(state->listener);
+            delete state;
+            throw std::runtime_error("No se pudo Crear la Tuberia de Aviso");
+
+        }
+        for (int end : state->wake) fcntl(end, F_SETFL, fcntl(end, F_GETFL) | O_NONBLOCK);
+
+        /// Lanzar Hilo Transmisor (un Espectador que se Desconecta no debe Terminar la Partida)
+        signal(SIGPIPE, SIG_IGN);
+        state->running = true;
+        state->thread = std::thread(broadcastLoop, std::ref(*state));
+        broadcaster = state;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Termina la Transmisión y Libera el Socket.
+ */
+void stopBroadcast(){
+
+    /// Sin Transmisión Activa
+    if (!broadcaster) return;
+
+    /// Detener el Hilo y Cerrar Descriptores
+    #ifndef _WIN32
+        broadcaster->running = false;
+        char notice = 1;
+        if (write(broadcaster->wake[1], &notice, 1) < 0) {}
+        broadcaster->thread.join();
+        close(broadcaster->listener);
+        close(broadcaster->wake[0]);
+        close(broadcaster->wake[1]);
+        unlink(broadcaster->path.c_str());
+    #endif
+    delete broadcaster;
+    broadcaster = nullptr;
+
+}
+
+// =====================================================================================================================================
+// -------------------------------------------------------------- Renders ----------------------------------------------------------------
+
+/// Pantalla: Portada del Juego
+constexpr char TITLE_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                                                                * \n"
+    "                      *          **   **  *****  **   **  *****  *****   ***   **   **  ***            * \n"
+    "                      *          * * * *  *      * * * *  *   *  *   *  *   *  * * * * *   *           * \n"
+    "                      *          *  *  *  ****   *  *  *  *   *  ****   *****  *  *  * *****           * \n"
+    "                      *          *     *  *      *     *  *   *  *   *  *   *  *     * *   *           * \n"
+    "                      *          *     *  *****  *     *  *****  *   *  *   *  *     * *   *           * \n"
+    "                      *                                                                                * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Rango
+constexpr char RANGE_ERROR_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                        ERROR                                   * \n"
+    "                      ********************************************************************************** \n"
+    "                      *                           Fuera de Rango (Numeros de 0-5)                      * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Felicitaciones al Ganador
+constexpr char WIN_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                                                                * \n"
+    "                      *       *****  *****  *      *   ****  *  *****    ***   ****   *****  ****      * \n"
+    "                      *       *      *      *      *  *      *  *    *  *   *  *   *  *     *          * \n"
+    "                      *       ****   ****   *      *  *      *  *    *  *****  *   *  ****   ****      * \n"
+    "                      *       *      *      *      *  *      *  *    *  *   *  *   *  *          *     * \n"
+    "                      *       *      *****  *****  *   ****  *  *****   *   *  ****   *****  ****      * \n"
+    "                      *                                                                                * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Mensaje de Empate
+constexpr char TIE_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                                                                * \n"
+    "                      *                   *****  **   **  ****    ***   *******  *****                 * \n"
+    "                      *                   *      * * * *  *   *  *   *     *     *                     * \n"
+    "                      *                   ****   *  *  *  ****   *****     *     ****                  * \n"
+    "                      *                   *      *     *  *      *   *     *     *                     * \n"
+    "                      *                   *****  *     *  *      *   *     *     *****                 * \n"
+    "                      *                                                                                * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Tipo
+constexpr char TYPE_ERROR_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                     ERROR                                      * \n"
+    "                      ********************************************************************************** \n"
+    "                      *               Entrada Invalida. Por favor ingresa un Numero Entero             * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Partida Guardada
+constexpr char NO_SAVED_GAME_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                     ERROR                                      * \n"
+    "                      ********************************************************************************** \n"
+    "                      *              No hay Partida Guardada. Se Iniciara una Partida Nueva.           * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Carta Elegida como Primera
+constexpr char SAME_CARD_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                     ERROR                                      * \n"
+    "                      ********************************************************************************** \n"
+    "                      *                   Ya elegiste esa Carta como Primera. Escoge otra.             * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Carta ya Descubierta
+constexpr char CARD_DISCOVERED_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                     ERROR                                      * \n"
+    "                      ********************************************************************************** \n"
+    "                      *                    Esa Carta ya fue descubierta. Escoge otra.                  * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Error de Nombre Vacío ('#' es el Hueco del Número de Jugador)
+constexpr char EMPTY_NAME_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                     ERROR                                      * \n"
+    "                      ********************************************************************************** \n"
+    "                      *                   El Nombre no puede estar Vacio, Jugador #                    * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Pareja Encontrada
+constexpr char MATCH_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                 ¡Pareja encontrada!                            * \n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Cartas Distintas
+constexpr char NO_MATCH_SCREEN[] =
+    "                      ********************************************************************************** \n"
+    "                      *                                   No son iguales.                              *\n"
+    "                      ********************************************************************************** \n";
+
+/// Pantalla: Tablero con Coordenadas (cada 'X' es el Hueco de una Carta)
+constexpr char BOARD_SCREEN[] =
+    "                      *                                                                                * \n"
+    "                      *                                     0 1 2 3 4 5                                * \n"
+    "                      *                                   0 X X X X X X                                * \n"
+    "                      *                                   1 X X X X X X                                * \n"
+    "                      *                                   2 X X X X X X                                * \n"
+    "                      *                                   3 X X X X X X                                * \n"
+    "                      *                                   4 X X X X X X                                * \n"
+    "                      *                                   5 X X X X X X                                * \n"
+    "                      *                                                                                * \n";
+
+/// Posiciones de los Huecos dentro de las Pantallas (Calculadas en Tiempo de Compilación)
+constexpr size_t EMPTY_NAME_SLOT = findSlot(EMPTY_NAME_SCREEN, '#');
+constexpr std::array<uint16_t, CARD_COUNT> BOARD_SLOTS = findCardSlots(BOARD_SCREEN);
+
+/// Función: Portada del Juego
+void titleCover(){
+    
+    /*
+       - Función: Portada del Juego
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Memorama en Arte ASCII
+    */
+
+    // Impresión de Portada del Juego
+    appendBlob(TITLE_SCREEN);
+
+}
+
+
+
+
+/// Función: Error de Rango
+void rangeError(){
+
+    /*
+       - Función: Error de Rango
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa un Valor Fuera de Rango
+    */
+
+    // Impresión de Mensaje de Error
+    appendBlob(RANGE_ERROR_SCREEN);
+
+}
+
+
+
+/// Función: Felicitaciones al Ganador
+void win(){
+
+    /*
+       - Función: Felicitaciones al Ganador
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Felicitaciones al Ganador
+    */
+
+    /// Configración Inicial
+    clearScreen();                     // Limpiar Pantalla   
+    waitSeconds(2);                   // Esperar 2 Segundos
+
+    /// Mensaje de Felicitaciones
+    appendBlob(WIN_SCREEN);
+
+}
+
+
+
+
+/// Función: Mensaje de Empate
+void tie(){
+
+    /*
+       - Función: Mensaje de Empate
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Empate
+    */
+
+    // Mensaje de Empate
+    appendBlob(TIE_SCREEN);
+
+}
+
+
+
+
+/**
+ * @brief Función de Impresión de Error de Carta ya Descubierta.
+ * @param sameCard (bool): Indica si la carta seleccionada es la misma que la primera.
+ */
+void cardDiscoveredError(bool sameCard){
+    
+    /*
+       - Función: Error de Carta ya Descubierta
+       - Argumentos:
+            - sameCard (bool): Indica si la carta seleccionada es la misma que la primera
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Error cuando el Usuario selecciona una Carta ya Descubierta
+    */
+    
+    /// Impresión de Mensaje de Error
+    if (sameCard) appendBlob(SAME_CARD_SCREEN);
+    else appendBlob(CARD_DISCOVERED_SCREEN);
+
+}
+
+
+
+
+/**
+ * @brief Función de Impresión de Datos Generales del Juego.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param playersNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @throw std::out_of_range (int): Si algún Entero no es Positivo.
+ */
+void printGeneralData(int player1Points, int player2Points, int turn, const std::vector<std::string>& playersNames){
+
+    /*
+       - Función: Datos Generales
+       - Argumentos:
+            - player1Points (int): Puntos del Jugador 1 
+            - player2Points (int): Puntos del Jugador 2 
+            - turn (int): Turno del Jugador Actual 
+            - playersNames (std::vector<std::string>): Nombres de los Jugadores 
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Datos Generales del Juego (Puntajes y Turno Actual)
+    */
+
+    /// Validaciones de Argumentos de Tipo Entero
+    validatePositiveInt(player1Points);                    // Puntos del Jugador 1
+    validatePositiveInt(player2Points);                    // Puntos del Jugador 2
+    validatePositiveInt(turn);                             // Turno del Jugador Actual
+
+    /// Impresión de Datos Generales
+    screen << "                      *            " << playersNames[0] << " : " << player1Points << " puntos           |            " << playersNames[1] << " : " << player2Points << " puntos \n";
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                               Turno del jugador: " << playersNames[turn - 1] << "\n";
+    screen << "                      ********************************************************************************** \n";
+
+}
+
+
+
+
+/// Función: Error de Tipo
+void typeError(){
+
+    /*
+       - Función: Error de Tipo
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa un Valor de Tipo Inválido
+    */
+
+    // Impresión de Mensaje de Error
+    appendBlob(TYPE_ERROR_SCREEN);
+
+}
+
+
+
+
+/// Función: Error de Partida Guardada
+void noSavedGameError(){
+
+    /*
+       - Función: Error de Partida Guardada
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Error cuando se pide Continuar y no hay Partida Guardada
+    */
+
+    // Impresión de Mensaje de Error
+    appendBlob(NO_SAVED_GAME_SCREEN);
+
+}
+
+
+
+
+/**
+ * @brief Función de Impresión de Error de Cadena Vacía de Nombres de Jugadores.
+ * @param playerNum (int): Número del Jugador (0 o 1).
+ * @param playersNames (std::vector<std::string>): Vector de Nombres de los Jugadores.
+ */
+void emptyNameError(const std::vector<std::string>& playersNames, int playerNum){
+
+    /*
+       - Función: Error de Cadena Vacía de Nombres de Jugadores
+       - Argumentos:
+            - playerNum (int): Número del Jugador (0 o 1)
+            - playersNames (std::vector<std::string>&): Vector de Nombres de los Jugadores
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Error cuando el Usuario ingresa una Cadena Vacía como Nombre de Jugador
+    */
+
+    /// Configuraciones Iniciales
+    waitSeconds(2);                 // Esperar 2 Segundos
+    clearScreen();                  // Limpiar Pantalla
+     
+    // Impresión de Mensaje de Error (Parchando el Número de Jugador)
+    size_t base = appendBlob(EMPTY_NAME_SCREEN);
+    screen.data[base + EMPTY_NAME_SLOT] = static_cast<char>('1' + playerNum);
+ 
+    /// Configuraciones Finales
+    waitSeconds(2);                 // Esperar 2 Segundos
+    clearScreen();                  // Limpiar Pantalla
+
+    if (playerNum == 1){
+
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *                   Escribe el Nombre del Jugador 1: " << playersNames[playerNum - 1] << " \n";
+        screen << "                      ********************************************************************************** \n";
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer Nombres de los Jugadores.
+ * @param playersNames (std::vector<std::string>): Vector de Nombres de los Jugadores.
+ */
+void inputNames(std::vector<std::string>& playersNames){
+
+    /*
+       - Función: Leer Nombres de los Jugadores
+       - Argumentos:
+            - playerNames (std::vector<std::string>&): Vector de Nombres de los Jugadores
+       - Retorno: Ninguno
+       - Objetivo: Leer Nombres de los Jugadores para su Almacenamiento
+    */
+
+    /// Lectura de Nombres
+    for(int i = 0; i < 2; i++){
+        
+        do {                                                                                // Repetir hasta obtener un nombre válido
+            
+            /// Impresión y Lectura de Nombre de Jugador
+            if (i == 0) screen << "                      ********************************************************************************** \n";
+            screen << "                      *                   Escribe el Nombre del Jugador " << i+1 << ": ";
+            presentFrame();
+            std::getline(std::cin, playersNames[i]);
+            
+            /// Buscar Primer Carácter no Espacio
+            auto start = playersNames[i].find_first_not_of(" \t\n\r");                   
+            
+            /// Si solo hay Espacios, marcar como Vacío
+            if (start == std::string::npos) playersNames[i] = "";                 
+                    
+            /// Imprimir Error de Nombre Vacío si el Nombre de algún Jugador está Vacío 
+            if (playersNames[i].empty()) emptyNameError(playersNames, i);               
+            
+        } while (playersNames[i].empty());                                                // Repetir hasta obtener un nombre válido
+        
+        screen << "                      ********************************************************************************** \n";
+    
+    }
+    
+    /// Configuraciones Finales
+    waitSeconds(2);              // Esperamos 2 Segundos
+    clearScreen();               // Limpiar Pantalla
+
+}
+
+
+
+
+/// Función: Animación de Carga
+void loading(){
+
+    /*
+       - Función: Animación de Carga
+       - Argumentos: Ninguno
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Animación de Carga
+    */
+
+    /// Animación de Carga
+    for (int i = 0; i < 3; i++){                    // Repetir 3 Veces
+
+        screen << "Cargando";                       // Imprimir Cargando
+        for (int j = 0; j < 5; j++){                // Repetir 5 Veces
+            
+            screen << ".";                          // Imprimir Punto
+            waitMilliseconds(500);                  // Esperar 500 MiliSegundos
+        }
+        clearScreen();                              // Limpiar Pantalla
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Imprimir el Tablero.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas de Cartas Visibles.
+ */
+void printBoard(const std::vector<std::vector<std::string>>& visibleCards){
+
+    /*
+       - Función: Imprimir el Tablero
+       - Argumentos:
+            - visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles 
+       - Retorno: Ninguno
+       - Objetivo: Imprimir el Tablero con Coordenadas y las Cartas Visibles
+    */
+
+    /// Copiar la Plantilla y Parchar cada Hueco con su Carta
+    size_t base = appendBlob(BOARD_SCREEN);
+    for (int k = 0; k < CARD_COUNT; k++) screen.data[base + BOARD_SLOTS[k]] = visibleCards[k / 6][k % 6][0];
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer 1era Carta de Fila.
+ * @param rowCard1 (int): La Primera Carta de Fila.
+ * @param onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada.
+ * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ */
+void rowCard1(int& rowCard1, bool onlyPrint){
+
+    /*
+       - Función: Leer 1era Carta de Fila
+       - Argumentos:
+            - rowCard1 (int): Primera Carta de Fila 
+       - Retorno: Ninguno
+       - Objetivo: Leer 1era Carta de Fila del Usuario
+    */
+
+    /// Validación de Argumento
+    validatePositiveInt(rowCard1);                             // Entero Positivo
+    
+    ///Impresión y Lectura de Primera Carta de Fila
+    screen << "                      ********************************************************************************** \n";
+    if (onlyPrint) screen << "                      *                  Elige la fila de la primera carta (0-5): " << rowCard1 << "                    *   \n";
+    else{
+    
+        screen << "                      *                  Elige la fila de la primera carta (0-5): ";
+        presentFrame();
+        readCoordinate(rowCard1);
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer 1era Carta de Columna.
+ * @param columnCard2 (int): La Primera Carta de Columna.
+ * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ */
+void columnCard1(int& columnCard1){
+    
+    /*
+       - Función: Leer 1era Carta de Columna
+       - Argumentos:
+            - columnCard1 (int): Primera Carta de Columna
+       - Retorno: Ninguno
+       - Objetivo: Leer 1era Carta de Columna del Usuario
+    */
+
+    /// Validación de Argumento
+    validatePositiveInt(columnCard1);                             // Entero Positivo
+
+    ///Impresión y Lectura de Primera Carta de Columna
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                  Elige la columna de la primera carta (0-5): ";
+    presentFrame();
+    readCoordinate(columnCard1);
+
+}
+
+
+
+
+/**
+ * @brief Función de Impresión de una Pista.
+ * @param hint (Hint): La Sugerencia a Imprimir.
+ */
+void printHint(const Hint& hint){
+
+    /*
+       - Función: Imprimir Pista
+       - Argumentos:
+            - hint (Hint): Sugerencia a Imprimir
+       - Retorno: Ninguno
+       - Objetivo: Imprimir la Carta Sugerida y la Probabilidad de Encontrar Pareja
+    */
+
+    /// Sin Cartas por Voltear no hay Pista
+    if (hint.first < 0) return;
+
+    /// Formatear Pista
+    char text[96];
+    if (hint.second >= 0) std::snprintf(text, sizeof(text), "Pista: voltea (%d,%d) y (%d,%d), pareja segura", hint.first / 6, hint.first % 6, hint.second / 6, hint.second % 6);
+    else std::snprintf(text, sizeof(text), "Pista: voltea (%d,%d), %.0f%% de encontrar pareja", hint.first / 6, hint.first % 6, hint.probability * 100.0);
+    if (!std::isnan(hint.advantage)){                                               // Ventaja según las Tablas (sin Pases)
+
+        size_t length = std::strlen(text);
+        std::snprintf(text + length, sizeof(text) - length, ", ventaja %+.2f", hint.advantage);
+
+    }
+
+    /// Impresión de Pista
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                  " << text << std::string(62 - std::strlen(text), ' ') << "* \n";
+
+}
+
+
+
+
+/**
+ * @brief Función para Imprimir los Relojes de los Jugadores.
+ * @param clock (TurnClock): El Reloj de la Mesa.
+ * @param playersNames (std::vector<std::string>): Nombres de los Jugadores.
+ */
+void printClocks(const TurnClock& clock, const std::vector<std::string>& playersNames){
+
+    /// Tiempo Restante (el del Jugador en Turno Descuenta lo que Lleva Pensando)
+    char shown[2][16];
+    long long now = monotonicNanos();
+    for (int p = 0; p < 2; p++){
+
+        long long left = clock.bankNanos[p] - (clock.running == p + 1 ? now - clock.startedAt : 0);
+        long long tenths = std::max(0LL, left) / 100000000LL;
+        std::snprintf(shown[p], sizeof(shown[p]), "%lld:%02lld.%lld", tenths / 600, (tenths / 10) % 60, tenths % 10);
+
+    }
+
+    /// Impresión de Relojes (una Flecha Marca el que Corre)
+    char text[96];
+    std::snprintf(text, sizeof(text), "Reloj: %.14s %s%s  %.14s %s%s", playersNames[0].c_str(), shown[0], clock.running == 1 ? " <" : "", playersNames[1].c_str(), shown[1], clock.running == 2 ? " <" : "");
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                  " << text << std::string(62 - std::min<size_t>(62, std::strlen(text)), ' ') << "* \n";
+
+}
+
+
+
+
+/**
+ * @brief Función de Impresión de Elementos Visuales del Juego.
+ * @param player1Points (int): Puntos del Jugador 1
+ * @param player2Points (int): Puntos del Jugador 2
+ * @param turn (int): Número de Turno
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas con las Cartas Visibles.
+ * @param playersName (std::vector<std::string>): El Vector de Cadenas donde que Almacenan los Nombres de los Jugadores.
+ * @param hints (const CardTracker*): El Rastreo para Mostrar Pistas (nullptr si las Pistas están Apagadas).
+ * @throw std::out_of_range (int): Si algún Entero es Negativo
+ */
+void printGame(
+    
+    int& player1Points, 
+    int& player2Points, 
+    int& turn, 
+    const std::vector<std::vector<std::string>>& visibleCards, 
+    const std::vector<std::string>& playersNames,
+    const CardTracker* hints
+
+){
+    
+    /*
+       - Función: Impresión de Elementos Visuales del Juego
+       - Argumentos:
+            - player1Points (int): Puntos del Jugador 1
+            - player2Points (int): Puntos del Jugador 2
+            - turn (int): Número de Turno
+            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cadenas con las Cartas Visibles.
+            - playersName (std::vector<std::string>): El Vector de Cadenas donde que Almacenan los Nombres de los Jugadores.
+            - hints (const CardTracker*): El Rastreo para Mostrar Pistas (nullptr si las Pistas están Apagadas).
+       - Retorno: Ninguno
+       - Objetivo: Impresión de Elementos Visuales del Juego para la visualización del Usuario
+    */
+
+    /// Imprimir Portada del Juego (en Vista Compacta solo el Borde Superior)
+    if (layout.compact) screen << "                      ********************************************************************************** \n";
+    else titleCover();
+
+    /// Imprimir la Información General del Juego
+    printGeneralData(player1Points, player2Points, turn, playersNames);
+
+    /// Mostrar Tablero Visible con Coordenadas
+    printBoard(visibleCards);
+
+    /// Mostrar Pista si están Activadas
+    if (hints) printHint(queryHint(*hints));
+
+    /// Mostrar Relojes si se Juega con Control de Tiempo
+    if (matchClock) printClocks(matchClock->clock, playersNames);
+
+    /// Publicar el Cuadro a los Espectadores (si se Transmite)
+    publishFrame(visibleCards, player1Points, player2Points, turn);
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer 2da Carta de Fila.
+ * @param aMatch (bool): Indica si las Cartas Hicieron Pareja.
+ */
+void cardMessage(bool aMatch){
+   
+    /*
+       - Función: Mensaje de Carta
+       - Argumentos:
+            - aMatch (bool): Indica si las Cartas Hicieron Pareja
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Mensaje de Carta (Pareja Encontrada o No Son Iguales)
+    */
+
+    
+    /// Impresión de Mensaje de Carta
+    if (aMatch){
+    
+        appendBlob(MATCH_SCREEN);
+        playBeep();
+
+    }
+    else appendBlob(NO_MATCH_SCREEN);
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer 2da Carta de Fila.
+ * @param rowCard2 (int): La Segunda Carta de Fila.
+ * @param onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada.
+ * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ */
+void rowCard2(int& rowCard2, bool onlyPrint){
+
+    /*
+       - Función: Leer 2da Carta de Fila
+       - Argumentos:
+            - rowCard2 (int): Segunda Carta de Fila
+            - onlyPrint (bool): Indica si solo se debe Imprimir el Valor sin Leer Entrada. 
+       - Retorno: Ninguno
+       - Objetivo: Leer 2da Carta de Fila del Usuario
+    */
+
+    /// Validación de Argumento
+    validatePositiveInt(rowCard2);                             // Entero Positivo
+
+    ///Impresión y Lectura de Segunda Carta de Fila    
+    screen << "                      ********************************************************************************** \n";
+    if (onlyPrint) screen << "                      *                  Elige la fila de la segunda carta (0-5): " << rowCard2 << "                    *   \n";
+    else{
+    
+        screen << "                      *                  Elige la fila de la segunda carta (0-5): ";
+        presentFrame();
+        readCoordinate(rowCard2);
+    
+    }
+}
+
+
+
+
+/**
+ * @brief Función para Leer 2da Carta de Columna.
+ * @param columnCard2 (int): La Segunda Carta de Columna.
+ * @throw std::out_of_range (int): Si el Valor de la Carta no es Positivo.
+ */
+void columnCard2(int& columnCard2){
+    
+    /*
+       - Función: Leer 2da Carta de Columna
+       - Argumentos:
+            - columnCard2 (int): Primera Carta de Columna 
+       - Retorno: Ninguno
+       - Objetivo: Leer 2da Carta de Columna del Usuario
+    */
+
+    /// Validación de Argumento
+    validatePositiveInt(columnCard2);                             // Entero Positivo
+
+    ///Impresión y Lectura de Segunda Carta de Columna
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                  Elige la columna de la segunda carta (0-5): ";
+    presentFrame();
+    readCoordinate(columnCard2);
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Partidas Guardadas ----------------------------------------------------------
+
+const char* const SAVE_PATH = "memorama.sav";                                     /// Archivo de Guardado Automático
+
+/// Estructura: Instantánea Binaria de una Partida en Curso
+struct GameSnapshot {
+
+    char magic[8];                               // Firma "MEMSAV01"
+    uint32_t version;                            // Versión del Formato
+    char board[36];                              // Letra de cada Carta del Tablero
+    char visible[36];                            // Carta Visible ('X' si está Oculta)
+    int32_t player1Points;                       // Puntos del Jugador 1
+    int32_t player2Points;                       // Puntos del Jugador 2
+    int32_t turn;                                // Turno del Jugador Actual
+    int32_t movesCounter;                        // Contador de Movimientos
+    int32_t errorCounter;                        // Contador de Errores
+    int64_t elapsedMilliseconds;                 // Tiempo de Juego Transcurrido
+    uint16_t nameLengths[2];                     // Longitud de cada Nombre (los Nombres van Después)
+
+};
+
+
+
+
+/**
+ * @brief Función para Guardar la Partida en Curso.
+ * @param path (const char*): El Archivo de Guardado.
+ * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param movesCounter (int): Contador de Movimientos.
+ * @param errorCounter (int): Contador de Errores.
+ * @param elapsedMilliseconds (long long): Tiempo de Juego Transcurrido.
+ * @return (bool) Verdadero si se Guardó Correctamente.
+ */
+bool saveGame(
+
+    const char* path,
+    const std::vector<std::vector<std::string>>& board,
+    const std::vector<std::vector<std::string>>& visibleCards,
+    const std::vector<std::string>& playerNames,
+    int player1Points,
+    int player2Points,
+    int turn,
+    int movesCounter,
+    int errorCounter,
+    long long elapsedMilliseconds
+
+){
+
+    /*
+       - Función: Guardar Partida
+       - Argumentos:
+            - path (const char*): Archivo de Guardado
+            - board (std::vector<std::vector<std::string>>): Tablero con las Cartas
+            - visibleCards (std::vector<std::vector<std::string>>): Cartas Visibles
+            - playerNames (std::vector<std::string>): Nombres de los Jugadores
+            - player1Points (int): Puntos del Jugador 1
+            - player2Points (int): Puntos del Jugador 2
+            - turn (int): Turno del Jugador Actual
+            - movesCounter (int): Contador de Movimientos
+            - errorCounter (int): Contador de Errores
+            - elapsedMilliseconds (long long): Tiempo Transcurrido
+       - Retorno: Verdadero si se Guardó
+       - Objetivo: Escribir una Instantánea de ~150 Bytes con una sola Escritura Bufferizada (sin fsync)
+                   en un Temporal que luego se Renombra, para no Dejar Nunca un Guardado a Medias
+    */
+
+    /// Armar la Instantánea
+    GameSnapshot snapshot = {};
+    std::memcpy(snapshot.magic, "MEMSAV01", 8);
+    snapshot.version = 1;
+    for (int i = 0; i < 6; i++){
+
+        for (int j = 0; j < 6; j++){
+
+            snapshot.board[i * 6 + j] = board[i][j][0];
+            snapshot.visible[i * 6 + j] = visibleCards[i][j][0];
+
+        }
+
+    }
+    snapshot.player1Points = player1Points;
+    snapshot.player2Points = player2Points;
+    snapshot.turn = turn;
+    snapshot.movesCounter = movesCounter;
+    snapshot.errorCounter = errorCounter;
+    snapshot.elapsedMilliseconds = elapsedMilliseconds;
+    snapshot.nameLengths[0] = static_cast<uint16_t>(std::min<size_t>(playerNames[0].size(), 0xFFFF));
+    snapshot.nameLengths[1] = static_cast<uint16_t>(std::min<size_t>(playerNames[1].size(), 0xFFFF));
+
+    /// Escribir Temporal y Renombrar
+    std::string temporaryPath = std::string(path) + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&snapshot), sizeof(snapshot));
+        file.write(playerNames[0].data(), snapshot.nameLengths[0]);
+        file.write(playerNames[1].data(), snapshot.nameLengths[1]);
+        if (!file) return false;
+    }
+    try { replaceFile(temporaryPath, path); }
+    catch (const std::runtime_error&) { return false; }
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función para Cargar una Partida Guardada.
+ * @param path (const char*): El Archivo de Guardado.
+ * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero Restaurada.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles Restaurada.
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores Restaurados.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param movesCounter (int): Contador de Movimientos.
+ * @param errorCounter (int): Contador de Errores.
+ * @param elapsedMilliseconds (long long): Tiempo de Juego Transcurrido.
+ * @return (bool) Verdadero si había una Partida Válida.
+ */
+bool loadGame(
+
+    const char* path,
+    std::vector<std::vector<std::string>>& board,
+    std::vector<std::vector<std::string>>& visibleCards,
+    std::vector<std::string>& playerNames,
+    int& player1Points,
+    int& player2Points,
+    int& turn,
+    int& movesCounter,
+    int& errorCounter,
+    long long& elapsedMilliseconds
+
+){
+
+    /*
+       - Función: Cargar Partida
+       - Argumentos:
+            - path (const char*): Archivo de Guardado
+            - board (std::vector<std::vector<std::string>>): Tablero Restaurado
+            - visibleCards (std::vector<std::vector<std::string>>): Cartas Visibles Restauradas
+            - playerNames (std::vector<std::string>): Nombres Restaurados
+            - player1Points (int): Puntos del Jugador 1
+            - player2Points (int): Puntos del Jugador 2
+            - turn (int): Turno del Jugador Actual
+            - movesCounter (int): Contador de Movimientos
+            - errorCounter (int): Contador de Errores
+            - elapsedMilliseconds (long long): Tiempo Transcurrido
+       - Retorno: Verdadero si había una Partida Válida
+       - Objetivo: Restaurar la Posición Exacta Guardada por saveGame, Rechazando un Archivo Truncado o Editado
+                   (el Tablero y los Contadores se Usan luego como Índices)
+    */
+
+    /// Leer y Validar la Instantánea
+    std::ifstream file(path, std::ios::binary);
+    GameSnapshot snapshot;
+    if (!file.read(reinterpret_cast<char*>(&snapshot), sizeof(snapshot))) return false;
+    if (std::memcmp(snapshot.magic, "MEMSAV01", 8) != 0 || snapshot.version != 1) return false;
+    if (snapshot.turn < 1 || snapshot.turn > 2 || snapshot.player1Points < 0 || snapshot.player2Points < 0) return false;
+    if (snapshot.movesCounter < 0 || snapshot.errorCounter < 0 || snapshot.elapsedMilliseconds < 0) return false;
+
+    /// Validar el Tablero: cada Letra A-R Dos Veces, cada Visible es 'X' o su Letra, y las Parejas se Ven Completas
+    int copies[PAIR_COUNT] = {}, shown[PAIR_COUNT] = {};                   // Apariciones y Cartas Visibles por Letra
+    for (int k = 0; k < CARD_COUNT; k++){
+
+        int letter = snapshot.board[k] - 'A';                                // Índice de la Letra
+        if (letter < 0 || letter >= PAIR_COUNT || ++copies[letter] > 2) return false;
+        if (snapshot.visible[k] != 'X' && snapshot.visible[k] != snapshot.board[k]) return false;
+        shown[letter] += snapshot.visible[k] != 'X';
+
+    }
+    int revealedPairs = 0;                                                   // Parejas Descubiertas
+    for (int letter = 0; letter < PAIR_COUNT; letter++){
+
+        if (shown[letter] == 1) return false;                                // Guardado a Mitad de un Movimiento
+        revealedPairs += shown[letter] / 2;
+
+    }
+    if (revealedPairs >= PAIR_COUNT || snapshot.player1Points + snapshot.player2Points != revealedPairs) return false;
+
+    /// Leer Nombres
+    std::string names[2];
+    for (int p = 0; p < 2; p++){
+
+        names[p].resize(snapshot.nameLengths[p]);
+        if (!file.read(&names[p][0], snapshot.nameLengths[p]) || names[p].empty()) return false;
+
+    }
+
+    /// Restaurar Estado
+    for (int i = 0; i < 6; i++){
+
+        for (int j = 0; j < 6; j++){
+
+            board[i][j] = std::string(1, snapshot.board[i * 6 + j]);
+            visibleCards[i][j] = std::string(1, snapshot.visible[i * 6 + j]);
+
+        }
+
+    }
+    playerNames[0] = names[0];
+    playerNames[1] = names[1];
+    player1Points = snapshot.player1Points;
+    player2Points = snapshot.player2Points;
+    turn = snapshot.turn;
+    movesCounter = snapshot.movesCounter;
+    errorCounter = snapshot.errorCounter;
+    elapsedMilliseconds = snapshot.elapsedMilliseconds;
+    return true;
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Funciones Core --------------------------------------------------------------
+
+/**
+ * @brief Función de Creación de Arreglo de Pares.
+ * @param letters (std::vector<std::string>): El Vector de Cadenas con las Letras Base.
+ * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenarán los Pares.
+ */
+void createPairs(const std::vector<std::string>& letters, std::vector<std::string>& pairs){
+    
+    /*
+       - Función: Creación de Arreglo
+       - Argumentos:
+            - letters (std::vector<std::string>): El Vector de Cadenas con las Letras Base.
+            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenarán los Pares.
+       - Retorno: Ninguno
+       - Objetivo: Crear un Arreglo de Pares de Letras
+    */
+
+    /// Creación de Arreglo de Pares
+    for (int i = 0; i < 18; i++){          /// Repetir 18 Veces
+        
+        pairs[i * 2] = letters[i];         /// Asignar Letra a la Posición Par
+        pairs[i * 2 + 1] = letters[i];     /// Asignar Letra a la Posición Impar
+    
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Barajear.
+ * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+ */
+void shuffleCards(std::vector<std::string>& pairs){
+    
+    /*
+       - Función: Barajear Arreglo
+       - Argumentos:
+            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+       - Retorno: Ninguno
+       - Objetivo: Barajear un Arreglo de Pares de Letras
+    */
+
+    /// Barajear Arreglo de Pares
+    for (int i = 0; i < 36; i++){
+
+        int azar = rand() % 36;               // Generación de número aleatorio entre 0 y 36
+        std::string temp = pairs[i];          // Variable Temporal para Intercambio
+        pairs[i] = pairs[azar];               // Intercambio de Valores
+        pairs[azar] = temp;                   // Asignación del Valor Temporal
+    
+    }
+}
+
+
+
+
+/**
+ * @brief Función para Crear Tablero.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+ * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+ * @param pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+ */
+void createBoard(
+    
+    std::vector<std::vector<std::string>>& visibleCards, 
+    std::vector<std::vector<std::string>>& board, 
+    const std::vector<std::string>& pairs
+
+){
+    
+    /*
+       - Función: Crear Tablero
+       - Argumentos:
+            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+            - board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+            - pairs (std::vector<std::string>): El Vector de Cadenas donde se almacenan los Pares.
+       - Retorno: Ninguno
+       - Objetivo: Crear el Tablero del Juego
+    */
+
+    /// Creación del Tablero y Ocultación de Cartas
+    int k = 0;                                            // Índice para el Arreglo de Pares
+    for (int i = 0; i < 6; i++){                          // Filas
+  
+        for (int j = 0; j < 6; j++){                      // Columnas
+
+            board[i][j] = pairs[k];                       // Asignar Par al Tablero
+            visibleCards[i][j] = "X";                     // Ocultar Carta
+            k++;                                          // Incrementar Índice de Pares
+        }
+    }
+}
+
+
+
+
+/**
+ * @brief Función para Iniciar el Rastreo con las Parejas ya Descubiertas.
+ * @param tracker (CardTracker): El Rastreo a Iniciar.
+ * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+ */
+void trackVisibleBoard(
+
+    CardTracker& tracker,
+    const std::vector<std::vector<std::string>>& board,
+    const std::vector<std::vector<std::string>>& visibleCards
+
+){
+
+    /*
+       - Función: Iniciar Rastreo
+       - Argumentos:
+            - tracker (CardTracker): Rastreo a Iniciar
+            - board (std::vector<std::vector<std::string>>): Tablero con las Cartas
+            - visibleCards (std::vector<std::vector<std::string>>): Cartas Visibles
+       - Retorno: Ninguno
+       - Objetivo: Registrar como Emparejadas las Cartas Visibles (Tablero Nuevo o Partida Continuada)
+    */
+
+    /// Registrar Cartas Visibles y Resolverlas como Parejas
+    resetTracker(tracker);
+    for (int i = 0; i < CARD_COUNT; i++){
+
+        if (visibleCards[i / 6][i % 6] != "X") trackReveal(tracker, i, board[i / 6][i % 6][0] - 'A');
+
+    }
+    while (tracker.pairCount > 0){
+
+        int letter = tracker.pairs[tracker.pairCount - 1];
+        trackResolve(tracker, tracker.seen[letter][0], tracker.seen[letter][1], true);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función de Bucle Principal.
+ * @param minutes (int): Minutos Transcurridos.
+ * @param seconds (int): Segundos Transcurridos.
+ * @param errorCounter (int): Contador de Errores.
+ * @param movesCounter (int): Contador de Movimientos.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param card1Row (int): Fila de la Primera Carta.
+ * @param card1Column (int): Columna de la Primera Carta.
+ * @param card2Row (int): Fila de la Segunda Carta.
+ * @param card2Column (int): Columna de la Segunda Carta.
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @param board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+ * @param visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+ * @param elapsedMilliseconds (long long): Tiempo ya Jugado (Partida Continuada).
+ * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ */
+void mainLoop(
+    
+    int& minutes, 
+    int& seconds,
+    int& errorCounter,
+    int& movesCounter, 
+    int& player1Points, 
+    int& player2Points, 
+    int& turn,
+    int& card1Row, 
+    int& card1Column, 
+    int& card2Row, 
+    int& card2Column,
+    const std::vector<std::string>& playerNames, 
+    const std::vector<std::vector<std::string>>& board,
+    std::vector<std::vector<std::string>>& visibleCards,
+    long long elapsedMilliseconds
+ 
+){
+    
+    /*
+       - Función: Bucle Principal
+       - Argumentos:
+            - minutes (int): Minutos Transcurridos.
+            - seconds (int): Segundos Transcurridos.
+            - errorCounter (int): Contador de Errores.
+            - movesCounter (int): Contador de Movimientos.
+            - player1Points (int): Puntos del Jugador 1.
+            - player2Points (int): Puntos del Jugador 2.
+            - turn (int): Turno del Jugador Actual.
+            - card1Row (int): Fila de la Primera Carta.
+            - card1Column (int): Columna de la Primera Carta.
+            - card2Row (int): Fila de la Segunda Carta.
+            - card2Column (int): Columna de la Segunda Carta.
+            - playerNames (std::vector<std::string>): Nombres de los Jugadores.
+            - board (std::vector<std::vector<std::string>>): La Matriz del Tablero con las Cartas.
+            - visibleCards (std::vector<std::vector<std::string>>): La Matriz de Cartas Visibles.
+            - elapsedMilliseconds (long long): Tiempo ya Jugado (Partida Continuada).
+       - Retorno: Ninguno
+       - Objetivo: Crear el Tablero del Juego
+    */
+
+    /// Rastreo de Cartas para Pistas (Tecla 'p' Alterna las Pistas)
+    CardTracker tracker;                                                                      // Memoria de Cartas Vistas
+    const CardTracker* hints = nullptr;                                                       // Pistas Apagadas al Inicio
+    trackVisibleBoard(tracker, board, visibleCards);                                          // Parejas ya Descubiertas (Partida Continuada)
+
+    /// Flujo de Turnos: Reglas y Estado Fuera de la Terminal (esta Función solo Lee, Dibuja y Espera)
+    std::array<uint8_t, CARD_COUNT> cards;                                                    // Letra de cada Posición
+    uint64_t hidden = 0;                                                                      // Cartas Boca Abajo
+    for (int k = 0; k < CARD_COUNT; k++){
+
+        cards[k] = static_cast<uint8_t>(board[k / 6][k % 6][0] - 'A');
+        hidden |= static_cast<uint64_t>(visibleCards[k / 6][k % 6] == "X") << k;
+
+    }
+    TurnFlow flow;                                                                            // Marco de la Partida
+    FlowStep step = startFlow(flow, cards, hidden, turn, player1Points, player2Points, movesCounter, errorCounter);
+
+    /// Bucle Principal del Juego
+    auto start_time = std::chrono::steady_clock::now() - chrono::milliseconds(elapsedMilliseconds);  // Empezamos un cronometro (Descontando lo ya Jugado)
+    bool askRow = true;                                                                       // Pedir Fila (tras Rango de Columna solo se Pide la Columna)
+
+    /// Telemetría de Volteos (Reloj Monótono; solo se Registra si está Activa)
+    FlipSample sample{};                                                                  // Muestra del Intento en Curso
+    sample.game = static_cast<uint32_t>(time(0));                                         // Identificador de la Partida
+    auto askedAt = std::chrono::steady_clock::now(), rowAt = askedAt, firstAt = askedAt;  // Momentos de Pedido, Fila y Primera Carta
+
+    /// Con Control de Tiempo, la Bandera Interrumpe la Partida desde Cualquier Espera
+    try {
+
+        while (step.await != AWAIT_DONE){                                                         // Mientras no se acabe el Juego
+
+            /// Esperar lo que Pida el Flujo
+            if (step.await == AWAIT_TIMER){
+
+                waitMilliseconds(step.milliseconds);                                              // Esperar la Pausa
+                step = flowTimer(flow);                                                           // Reanudar el Flujo
+
+            }
+            else{
+
+                if (matchClock && !matchClock->clock.running) armClock(matchClock->clock, flow.guard.turn, monotonicNanos()); // Corre el Reloj de quien Elige
+                bool second = flow.state == FLOW_SECOND;                                          // Carta que se Pide
+                int& row = second ? card2Row : card1Row;                                          // Fila de esa Carta
+                int& column = second ? card2Column : card1Column;                                 // Columna de esa Carta
+                if (askRow){
+
+                    askedAt = std::chrono::steady_clock::now();                               // Se Pide una Carta Nueva
+                    sample.inputErrors = 0;                                                   // Sin Errores de Entrada Aún
+                    clearScreen();                                                                // Limpiar Pantalla
+                    printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                    while (true){                                                                 // Mientras
+
+                        second ? rowCard2(row, false) : rowCard1(row, false);                     // Leer Fila de la Carta
+                        if (std::cin.fail()){                                                     // Si se ingresa un Tipo Incorrecto
+
+                            std::cin.clear();                                                     // Limpiar Estado de Fallo
+                            if (hintKeyPressed()){                                                // Tecla de Pista
+
+                                hints = hints ? nullptr : &tracker;                               // Alternar Pistas
+                                clearScreen();                                                    // Limpiar Pantalla
+
+                            }
+                            else{                                                                 // Entrada Inválida
+
+                                std::cin.ignore(MAX_LIMIT, '\n');                                 // Ignorar Entrada Inválida
+                                printError(typeError);                                            // Imprimir Error de Tipo
+                                sample.inputErrors += sample.inputErrors < 255;               // Contar Error de Entrada
+
+                            }
+                            printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                            continue;                                                             // Continuar Bucle
+
+                        }
+                        if (row < 0 || row > 5){                                                  // Si el Valor está Fuera de Rango
+
+                            sample.inputErrors += sample.inputErrors < 255;                   // Contar Error de Entrada
+                            printError(rangeError);                                               // Imprimir Error de Rango
+                            printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                            continue;                                                             // Continuar Bucle
+
+                        }
+                        break;                                                                    // Salir del Bucle si la Entrada es Válida
+
+                    }
+                    rowAt = std::chrono::steady_clock::now();                                 // Fila Ingresada
+                    if (!second){                                                                 // La Primera Carta Muestra la Fila Elegida
+
+                        clearScreen();                                                            // Limpiar Pantalla
+                        printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                        rowCard1(row, true);                                                      // Imprimir Fila de la Primera Carta
+
+                    }
+
+                }
+                while (true){                                                                     // Mientras
+
+                    second ? columnCard2(column) : columnCard1(column);                           // Leer Columna de la Carta
+                    if (!std::cin.fail()) break;                                                  // Salir del Bucle si es un Número
+                    std::cin.clear();                                                             // Limpiar Estado de Fallo
+                    if (hintKeyPressed()){                                                        // Tecla de Pista
+
+                        hints = hints ? nullptr : &tracker;                                       // Alternar Pistas
+                        clearScreen();                                                            // Limpiar Pantalla
+
+                    }
+                    else{                                                                         // Entrada Inválida
+
+                        std::cin.ignore(MAX_LIMIT, '\n');                                         // Ignorar Entrada Inválida
+                        printError(typeError);                                                    // Imprimir Error de Tipo
+                        sample.inputErrors += sample.inputErrors < 255;                       // Contar Error de Entrada
+
+                    }
+                    printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                    second ? rowCard2(row, true) : rowCard1(row, true);                           // Imprimir Fila de la Carta
+
+                }
+                auto pickedAt = std::chrono::steady_clock::now();                                 // Columna Ingresada
+                sample.player = flow.guard.turn;                                                  // Jugador que Elige
+                long long pickedNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(pickedAt.time_since_epoch()).count();
+                if (matchClock && clockOverdrawn(matchClock->clock, pickedNanos)){                // Carta Ingresada ya sin Tiempo
+
+                    chargeClock(matchClock->clock, pickedNanos);                                  // Cobrar Hasta la Bandera
+                    throw TimeForfeit(sample.player);                                             // El Movimiento no Cuenta
+
+                }
+                step = flowPick(flow, row, column);                                               // Reanudar el Flujo con la Carta
+                if (matchClock && (step.event == EVENT_MATCH || step.event == EVENT_NO_MATCH)){   // Movimiento Completo
+
+                    chargeClock(matchClock->clock, pickedNanos);                                  // Cobrar Hasta la Segunda Carta
+                    matchClock->clock.bankNanos[sample.player - 1] += matchClock->clock.incrementNanos; // Incremento
+
+                }
+                if (telemetry){                                                                   // Registrar el Intento
+
+                    sample.atMillis = static_cast<uint32_t>(chrono::duration_cast<chrono::milliseconds>(pickedAt - start_time).count());
+                    sample.rowMicros = elapsedMicros(askedAt, rowAt);
+                    sample.thinkMicros = elapsedMicros(askedAt, pickedAt);
+                    sample.betweenMicros = second ? elapsedMicros(firstAt, pickedAt) : 0;
+                    sample.row = static_cast<int8_t>(std::max(-128, std::min(127, row)));
+                    sample.column = static_cast<int8_t>(std::max(-128, std::min(127, column)));
+                    sample.stage = second ? 2 : 1;
+                    sample.event = step.event;
+                    recordFlip(sample);
+
+                }
+                if (step.event == EVENT_FIRST) firstAt = pickedAt;                                // Inicio del Tiempo entre Volteos
+                askRow = step.event != EVENT_RANGE;                                               // Rango de Columna: Pedir solo la Columna
+
+            }
+
+            /// Reflejar el Marco en el Tablero y los Contadores
+            for (int k = 0; k < CARD_COUNT; k++) visibleCards[k / 6][k % 6] = (flow.guard.hidden >> k) & 1 ? "X" : board[k / 6][k % 6];
+            turn = flow.guard.turn;                                                               // Turno
+            player1Points = flow.points[0];                                                       // Puntos del Jugador 1
+            player2Points = flow.points[1];                                                       // Puntos del Jugador 2
+            movesCounter = flow.moves;                                                            // Movimientos
+            errorCounter = flow.errors;                                                           // Errores
+
+            /// Mostrar lo Ocurrido
+            switch (step.event){
+
+                case EVENT_RANGE:                                                                 // Columna fuera de Rango
+                    printError(rangeError);                                                       // Imprimir Error de Rango
+                    printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                    flow.state == FLOW_SECOND ? rowCard2(card2Row, true) : rowCard1(card1Row, true); // Imprimir Fila de la Carta
+                    break;
+
+                case EVENT_REVEALED:                                                              // Carta ya Descubierta
+                case EVENT_SAME_CARD:                                                             // Misma Carta
+                    clearScreen();                                                                // Limpiar Pantalla
+                    cardDiscoveredError(step.event == EVENT_SAME_CARD);                           // Imprimir Error de Carta ya Descubierta
+                    break;
+
+                case EVENT_FIRST:                                                                 // Primera Carta Volteada
+                    trackFirst(tracker, flow.guard.pendingFirst, flow.cards[flow.guard.pendingFirst]); // Registrar Primera Carta (Movimiento en Curso)
+                    break;
+
+                case EVENT_MATCH:                                                                 // Segunda Carta Volteada
+                case EVENT_NO_MATCH:
+                    trackReveal(tracker, flow.second, flow.cards[flow.second]);                   // Registrar Segunda Carta
+                    trackResolve(tracker, flow.guard.pendingFirst, flow.second, step.event == EVENT_MATCH); // Registrar Resultado del Movimiento
+                    clearScreen();                                                                // Limpiar Pantalla
+                    printGame(player1Points, player2Points, turn, visibleCards, playerNames, hints); // Reimprimir Juego
+                    cardMessage(step.event == EVENT_MATCH);                                       // Imprimir Mensaje de Pareja o No
+                    break;
+
+                case EVENT_MOVE:                                                                  // Movimiento Completo
+                    saveGame(                                                                     // Guardado Automático tras cada Movimiento
+
+                        SAVE_PATH, board, visibleCards, playerNames, player1Points, player2Points, turn, movesCounter, errorCounter,
+                        chrono::duration_cast<chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count()
+
+                    );
+                    break;
+
+            }
+
+        }
+
+    }
+    catch (const TimeForfeit&){}                                                              // Bandera Caída: el Reloj ya Registró quién Perdió
+
+    std::remove(SAVE_PATH);                                                                   // Partida Terminada: Nada que Continuar
+    auto end_time = std::chrono::steady_clock::now();                                         // Pausamos el Cronómetro
+    auto game_duration = chrono::duration_cast<chrono::seconds>(end_time - start_time);       // Tiempo en Juego en Segundos
+    int totalSeconds = game_duration.count();                                                 // Asignar Minutos
+    if (matchClock) totalSeconds = static_cast<int>((matchClock->clock.usedNanos[0] + matchClock->clock.usedNanos[1]) / 1000000000LL); // Con Relojes: lo que Pensaron Ambos
+    minutes = totalSeconds / 60;                                                              // Convertir a Minutos
+    seconds = totalSeconds % 60;                                                              // Convertir a Segundos
+
+}
+
+
+
+
+/**
+ * @brief Función de Imprimir Resultados Finales.
+ * @param minutes (int): Minutos Transcurridos.
+ * @param seconds (int): Segundos Transcurridos.
+ * @param movesCounter (int): Contador de Movimientos.
+ * @param errorCounter (int): Contador de Errores.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ */
+void printFinalResults(
+    
+    int minutes, 
+    int seconds,
+    int movesCounter, 
+    int errorCounter, 
+    int player1Points, 
+    int player2Points, 
+    const std::vector<std::string>& playerNames
+
+){
+
+    /*
+       - Función: Imprimir Resultados Finales
+       - Argumentos:
+            - minutes (int): Minutos Transcurridos.
+            - seconds (int): Segundos Transcurridos.
+            - movesCounter (int): Contador de Movimientos.
+            - errorCounter (int): Contador de Errores.
+            - player1Points (int): Puntos del Jugador 1.
+            - player2Points (int): Puntos del Jugador 2.
+            - playerNames (std::vector<std::string>): Nombres de los Jugadores.
+       - Retorno: Ninguno
+       - Objetivo: Imprimir los Resultados Finales del Juego
+    */
+
+    /// Validación de Argumentos Enteros
+    validatePositiveInt(minutes);                      // Minutos
+    validatePositiveInt(seconds);                      // Segundos
+    validatePositiveInt(movesCounter);                 // Contador de Movimientos
+    validatePositiveInt(errorCounter);                 // Contador de Errores
+    validatePositiveInt(player1Points);                // Puntos del Jugador 1
+    validatePositiveInt(player2Points);                // Puntos del Jugador 2
+
+    /// Limpiar Pantalla e Imprimir Resultados Finales
+    clearScreen();
+    
+    /// Imprimir Resultados Finales
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                                ¡Juego terminado!                               * \n";
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                                                                                * \n";
+    screen << "                      *                          " << playerNames[0] << " : " << player1Points << " puntos                  \n";
+    screen << "                      *                                                                                * \n";
+    screen << "                      *                          " << playerNames[1] << " : " << player2Points << " puntos                  \n";
+    screen << "                      *                                                                                * \n";
+    screen << "                      *                          Movimientos totales : " << movesCounter<< "                              *\n";
+    screen << "                      *                          Errores             : " << errorCounter << "                              *\n";
+    screen << "                      *                          Tiempo consumido    : " << minutes << " min, con " << seconds << " seg     \n";
+    screen << "                      ********************************************************************************** \n";
+    screen << "                                                         ";
+    
+    // Esperar a que el Usuario presione una Tecla para Continuar
+    pauseExecution();
+
+}
+
+
+
+
+/**
+ * @brief Función de Imprimir al Gandor.
+ * @param player1Points (int): Puntos del Jugador 1.
+ * @param player2Points (int): Puntos del Jugador 2.
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @param flagged (int): Jugador que Perdió por Tiempo (0 = Ninguno).
+ * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ */
+void printWinner(int player1Points, int player2Points, const std::vector<std::string>& playerNames, int flagged)
+{
+    
+
+    /// Validar Argumentos Enteros
+    validatePositiveInt(player1Points);                // Puntos del Jugador 1
+    validatePositiveInt(player2Points);                // Puntos del Jugador 2
+ 
+    /// Limpiar Pantalla
+    clearScreen();
+
+    /// Impresión de Ganador (Perder por Tiempo Decide sin Importar los Puntos)
+    if (flagged){
+
+        win();
+        screen << "                      *                                 " << playerNames[2 - flagged] << "  Gana por Tiempo! \n";
+        screen << "                      *                                 " << playerNames[flagged - 1] << "  se quedo sin tiempo \n";
+        screen << "                      ********************************************************************************** \n";
+
+    }
+    else if (player1Points > player2Points || player1Points < player2Points){
+        
+        win();
+        int winner;
+        player1Points > player2Points ? winner = 0 : winner = 1;
+        screen << "                      *                                 " << playerNames[winner] << "  Gana! \n";
+        screen << "                      ********************************************************************************** \n";
+    
+    }
+    else{
+
+        tie();
+        screen << "                      *                                     Empate!                                    *\n";
+        screen << "                      ********************************************************************************** \n";
+    
+    }
+    screen << "\n";
+
+    // Esperar a que el Usuario presione una Tecla para Continuar
+    pauseExecution();
+
+}
+
+
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Estadísticas ----------------------------------------------------------------
+
+const int HISTOGRAM_BUCKETS = 64;                                                 /// Número de Cubetas de cada Histograma
+const double DURATION_FLOOR = 1.0;                                                /// Microsegundos donde Empieza el Histograma de Duración
+const double DURATION_CEILING = 1e7;                                              /// Microsegundos donde Termina (10 Segundos)
+
+/// Estructura: Media, Varianza y Extremos en Línea (Algoritmo de Welford)
+struct RunningStats {
+
+    long long count = 0;                         // Número de Muestras
+    double mean = 0.0;                           // Media Acumulada
+    double m2 = 0.0;                             // Suma de Cuadrados de las Diferencias a la Media
+    double minValue = 0.0;                       // Valor Mínimo Observado
+    double maxValue = 0.0;                       // Valor Máximo Observado
+
+};
+
+
+
+
+/// Estructura: Histograma de Cubetas Fijas (Memoria Constante y Combinable)
+struct Histogram {
+
+    double lower = 0.0;                          // Límite Inferior de la Primera Cubeta
+    double width = 1.0;                          // Ancho de cada Cubeta (Logarítmico: Logaritmo de la Razón entre Cubetas)
+    bool logarithmic = false;                    // Cubetas Geométricas (Error Relativo Constante, como HdrHistogram)
+    long long underflow = 0;                     // Muestras por Debajo del Límite Inferior
+    long long overflow = 0;                      // Muestras por Encima de la Última Cubeta
+    long long buckets[HISTOGRAM_BUCKETS] = {};   // Conteo de Muestras por Cubeta
+
+};
+
+
+
+
+/// Estructura: Resumen de una Métrica (Momentos + Distribución)
+struct MetricSummary {
+
+    RunningStats stats;                          // Media, Varianza y Extremos
+    Histogram histogram;                         // Distribución para Cuantiles
+
+};
+
+
+
+
+/// Estructura: Resumen Agregado de Muchas Partidas
+struct GameSummary {
+
+    MetricSummary length;                        // Duración de la Partida en Turnos
+    MetricSummary moves;                         // Contador de Movimientos
+    MetricSummary errors;                        // Contador de Errores
+    MetricSummary duration;                      // Tiempo de Cómputo por Partida (Microsegundos)
+    MetricSummary margin;                        // Margen de Puntos (Jugador 1 - Jugador 2)
+    long long winsPlayer1 = 0;                   // Victorias del Jugador 1
+    long long winsPlayer2 = 0;                   // Victorias del Jugador 2
+    long long ties = 0;                          // Empates
+
+};
+
+
+
+
+/**
+ * @brief Función para Agregar una Muestra a las Estadísticas en Línea.
+ * @param runningStats (RunningStats): Las Estadísticas a Actualizar.
+ * @param value (double): El Valor de la Muestra.
+ */
+void addSample(RunningStats& runningStats, double value){
+
+    /*
+       - Función: Agregar Muestra
+       - Argumentos:
+            - runningStats (RunningStats): Estadísticas a Actualizar
+            - value (double): Valor de la Muestra
+       - Retorno: Ninguno
+       - Objetivo: Actualizar Media y Varianza en O(1) sin Guardar las Muestras (Welford)
+    */
+
+    /// Actualizar Extremos
+    if (runningStats.count == 0 || value < runningStats.minValue) runningStats.minValue = value;
+    if (runningStats.count == 0 || value > runningStats.maxValue) runningStats.maxValue = value;
+
+    /// Actualizar Media y Suma de Cuadrados
+    runningStats.count++;                                                    // Incrementar Muestras
+    double delta = value - runningStats.mean;                                // Diferencia con la Media Anterior
+    runningStats.mean += delta / runningStats.count;                         // Nueva Media
+    runningStats.m2 += delta * (value - runningStats.mean);                  // Nueva Suma de Cuadrados
+
+}
+
+
+
+
+/**
+ * @brief Función para Combinar dos Estadísticas en Línea.
+ * @param target (RunningStats): Las Estadísticas que Reciben la Combinación.
+ * @param source (RunningStats): Las Estadísticas a Combinar.
+ */
+void mergeStats(RunningStats& target, const RunningStats& source){
+
+    /*
+       - Función: Combinar Estadísticas
+       - Argumentos:
+            - target (RunningStats): Estadísticas Destino
+            - source (RunningStats): Estadísticas Origen
+       - Retorno: Ninguno
+       - Objetivo: Combinar Medias y Varianzas Parciales (Fórmula de Chan)
+    */
+
+    /// Casos Triviales
+    if (source.count == 0) return;                                           // Nada que Combinar
+    if (target.count == 0){ target = source; return; }                       // Copiar Directamente
+
+    /// Combinación de Momentos
+    long long total = target.count + source.count;                           // Muestras Totales
+    double delta = source.mean - target.mean;                                // Diferencia de Medias
+    target.m2 += source.m2 + delta * delta * target.count * source.count / total;
+    target.mean += delta * source.count / total;
+    target.count = total;
+
+    /// Combinación de Extremos
+    target.minValue = std::min(target.minValue, source.minValue);
+    target.maxValue = std::max(target.maxValue, source.maxValue);
+
+}
+
+
+
+
+/**
+ * @brief Función que Calcula la Desviación Estándar Muestral.
+ * @param runningStats (RunningStats): Las Estadísticas en Línea.
+ * @return (double) La Desviación Estándar (0 con menos de 2 Muestras).
+ */
+double standardDeviation(const RunningStats& runningStats){
+
+    /// Desviación Estándar Muestral
+    if (runningStats.count < 2) return 0.0;
+    return std::sqrt(runningStats.m2 / (runningStats.count - 1));
+
+}
+
+
+
+
+/**
+ * @brief Función para Agregar una Muestra al Histograma.
+ * @param histogram (Histogram): El Histograma a Actualizar.
+ * @param value (double): El Valor de la Muestra.
+ */
+void addSample(Histogram& histogram, double value){
+
+    /// Ubicar la Cubeta de la Muestra
+    double position = histogram.logarithmic                                  // Posición Relativa en Cubetas
+                    ? (value > 0 ? std::log(value / histogram.lower) / histogram.width : -1.0)
+                    : (value - histogram.lower) / histogram.width;
+    if (position < 0) histogram.underflow++;                                 // Por Debajo del Rango
+    else if (position >= HISTOGRAM_BUCKETS) histogram.overflow++;            // Por Encima del Rango
+    else histogram.buckets[static_cast<int>(position)]++;                    // Dentro del Rango
+
+}
+
+
+
+
+/**
+ * @brief Función para Combinar dos Histogramas con la Misma Geometría.
+ * @param target (Histogram): El Histograma que Recibe la Combinación.
+ * @param source (Histogram): El Histograma a Combinar.
+ */
+void mergeHistogram(Histogram& target, const Histogram& source){
+
+    /// Sumar Cubeta por Cubeta
+    target.underflow += source.underflow;
+    target.overflow += source.overflow;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) target.buckets[i] += source.buckets[i];
+
+}
+
+
+
+
+/**
+ * @brief Función que Estima un Cuantil a partir del Histograma.
+ * @param metric (MetricSummary): El Resumen de la Métrica.
+ * @param quantile (double): El Cuantil Deseado (0.0 - 1.0).
+ * @return (double) El Valor Estimado del Cuantil.
+ */
+double estimateQuantile(const MetricSummary& metric, double quantile){
+
+    /*
+       - Función: Estimar Cuantil
+       - Argumentos:
+            - metric (MetricSummary): Resumen de la Métrica
+            - quantile (double): Cuantil Deseado
+       - Retorno: Valor Estimado del Cuantil
+       - Objetivo: Interpolar el Cuantil dentro de la Cubeta que lo Contiene (Acotado por Mínimo y Máximo)
+    */
+
+    /// Sin Muestras no hay Cuantil
+    const Histogram& histogram = metric.histogram;
+    if (metric.stats.count == 0) return 0.0;
+
+    /// Recorrer Cubetas hasta Alcanzar el Rango Objetivo
+    double target = quantile * metric.stats.count;                           // Rango Objetivo
+    double cumulative = static_cast<double>(histogram.underflow);            // Muestras Acumuladas
+    if (target <= cumulative) return metric.stats.minValue;                  // Cuantil por Debajo del Rango
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++){
+
+        if (histogram.buckets[i] == 0) continue;                             // Cubeta Vacía
+        if (cumulative + histogram.buckets[i] >= target){                    // Cuantil dentro de esta Cubeta
+
+            double fraction = (target - cumulative) / histogram.buckets[i];  // Fracción dentro de la Cubeta
+            double value = histogram.logarithmic ? histogram.lower * std::exp((i + fraction) * histogram.width) : histogram.lower + (i + fraction) * histogram.width;
+            return std::min(std::max(value, metric.stats.minValue), metric.stats.maxValue);
+
+        }
+        cumulative += histogram.buckets[i];
+
+    }
+    return metric.stats.maxValue;                                            // Cuantil por Encima del Rango
+
+}
+
+
+
+
+/**
+ * @brief Función para Preparar la Geometría de un Resumen de Métrica.
+ * @param metric (MetricSummary): El Resumen a Preparar.
+ * @param lower (double): Límite Inferior del Histograma.
+ * @param width (double): Ancho de cada Cubeta.
+ */
+void initMetric(MetricSummary& metric, double lower, double width){
+
+    /// Establecer Geometría del Histograma
+    metric.histogram.lower = lower;
+    metric.histogram.width = width;
+
+}
+
+
+
+
+/**
+ * @brief Función para Preparar una Geometría Logarítmica (Cubetas que Crecen en la Misma Razón).
+ * @param metric (MetricSummary): El Resumen a Preparar.
+ * @param lower (double): Límite Inferior de la Primera Cubeta (Mayor que 0).
+ * @param upper (double): Límite Superior de la Última Cubeta.
+ */
+void initLogMetric(MetricSummary& metric, double lower, double upper){
+
+    /// Razón Constante entre Cubetas Consecutivas
+    metric.histogram.lower = lower;
+    metric.histogram.width = std::log(upper / lower) / HISTOGRAM_BUCKETS;
+    metric.histogram.logarithmic = true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Indica si dos Histogramas se Pueden Combinar.
+ * @param first (Histogram): El Primer Histograma.
+ * @param second (Histogram): El Segundo Histograma.
+ * @return (bool) Verdadero si Tienen la Misma Geometría.
+ */
+inline bool sameGeometry(const Histogram& first, const Histogram& second){return first.lower == second.lower && first.width == second.width && first.logarithmic == second.logarithmic;}
+
+
+
+
+/**
+ * @brief Función para Preparar un Resumen de Partidas Vacío.
+ * @param summary (GameSummary): El Resumen a Preparar.
+ * @param reach (int): El Mayor Margen Posible en Valor Absoluto (según la Variante de Reglas).
+ */
+void initSummary(GameSummary& summary, int reach = PAIR_COUNT){
+
+    /// Geometrías Fijas para que Cualquier Par de Resúmenes de la Misma Variante sea Combinable
+    initMetric(summary.length, 0.0, 2.0);             // Turnos: 0 - 128
+    initMetric(summary.moves, 0.0, 4.0);              // Movimientos: 0 - 256
+    initMetric(summary.errors, 0.0, 4.0);             // Errores: 0 - 256
+    initLogMetric(summary.duration, DURATION_FLOOR, DURATION_CEILING); // Microsegundos: 1 - 10^7, cada Cubeta ~29% más Ancha
+
+    /// Margen: Cubetas Enteras mientras Quepan (-18 a 18 Clásico), Más Anchas si la Variante Amplía los Puntos
+    int width = (2 * reach + HISTOGRAM_BUCKETS) / HISTOGRAM_BUCKETS;         // Techo de (2 * reach + 1) / Cubetas
+    initMetric(summary.margin, -reach - 0.5, width);
+
+}
+
+
+
+
+/**
+ * @brief Función para Agregar una Muestra a un Resumen de Métrica.
+ * @param metric (MetricSummary): El Resumen a Actualizar.
+ * @param value (double): El Valor de la Muestra.
+ */
+void addSample(MetricSummary& metric, double value){
+
+    /// Actualizar Momentos y Distribución
+    addSample(metric.stats, value);
+    addSample(metric.histogram, value);
+
+}
+
+
+
+
+/**
+ * @brief Función para Combinar dos Resúmenes de Partidas.
+ * @param target (GameSummary): El Resumen que Recibe la Combinación.
+ * @param source (GameSummary): El Resumen a Combinar.
+ */
+void mergeSummary(GameSummary& target, const GameSummary& source){
+
+    /// Combinar cada Métrica
+    MetricSummary* targets[] = {&target.length, &target.moves, &target.errors, &target.duration, &target.margin};
+    const MetricSummary* sources[] = {&source.length, &source.moves, &source.errors, &source.duration, &source.margin};
+    for (int i = 0; i < 5; i++){
+
+        mergeStats(targets[i]->stats, sources[i]->stats);
+        mergeHistogram(targets[i]->histogram, sources[i]->histogram);
+
+    }
+
+    /// Combinar Resultados
+    target.winsPlayer1 += source.winsPlayer1;
+    target.winsPlayer2 += source.winsPlayer2;
+    target.ties += source.ties;
+
+}
+
+
+
+
+/**
+ * @brief Función para Imprimir una Fila de Métrica del Resumen.
+ * @param label (const char*): Nombre de la Métrica.
+ * @param metric (MetricSummary): El Resumen de la Métrica.
+ */
+void printMetricRow(const char* label, const MetricSummary& metric){
+
+    /// Formatear Fila con Ancho Fijo
+    char row[160];
+    std::snprintf(
+
+        row, sizeof(row), "%-13s %8.2f %7.2f %6.0f %7.1f %7.1f %7.1f %6.0f",
+        label,
+        metric.stats.mean,
+        standardDeviation(metric.stats),
+        metric.stats.minValue,
+        estimateQuantile(metric, 0.50),
+        estimateQuantile(metric, 0.90),
+        estimateQuantile(metric, 0.99),
+        metric.stats.maxValue
+
+    );
+    screen << "                      *   " << row << "       * \n";
+
+}
+
+
+
+
+/**
+ * @brief Función para Imprimir las Muestras de una Métrica que Cayeron Fuera de su Histograma.
+ * @param label (const char*): Nombre de la Métrica.
+ * @param metric (MetricSummary): El Resumen de la Métrica.
+ */
+void printOutlierRow(const char* label, const MetricSummary& metric){
+
+    /// Solo las Métricas con Muestras Fuera
+    const Histogram& histogram = metric.histogram;
+    if (histogram.underflow + histogram.overflow == 0) return;
+    char row[160];
+    std::snprintf(row, sizeof(row), "%-13s %12lld por Debajo  %12lld por Encima", label, histogram.underflow, histogram.overflow);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+}
+
+
+
+
+/**
+ * @brief Función para Imprimir el Resumen Agregado de Partidas.
+ * @param summary (GameSummary): El Resumen a Imprimir.
+ */
+void printSummary(const GameSummary& summary){
+
+    /*
+       - Función: Imprimir Resumen
+       - Argumentos:
+            - summary (GameSummary): Resumen a Imprimir
+       - Retorno: Ninguno
+       - Objetivo: Imprimir Media, Desviación, Extremos y Cuantiles de cada Métrica
+    */
+
+    /// Encabezado del Resumen
+    char totals[160];
+    std::snprintf(totals, sizeof(totals), "Partidas: %-10lld  J1: %-10lld  J2: %-10lld  Empates: %-8lld", summary.moves.stats.count, summary.winsPlayer1, summary.winsPlayer2, summary.ties);
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                            Resumen de Simulacion                               * \n";
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *   " << totals << "  * \n";
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *   Metrica          Media    Desv    Min     p50     p90     p99    Max       * \n";
+
+    /// Filas de Métricas
+    printMetricRow("Turnos", summary.length);
+    printMetricRow("Movimientos", summary.moves);
+    printMetricRow("Errores", summary.errors);
+    printMetricRow("Duracion(us)", summary.duration);
+    printMetricRow("Margen", summary.margin);
+    screen << "                      ********************************************************************************** \n";
+
+    /// Muestras Fuera del Histograma (sus Cuantiles se Acotan al Mínimo o al Máximo)
+    bool outliers = false;
+    for (const MetricSummary* metric : {&summary.length, &summary.moves, &summary.errors, &summary.duration, &summary.margin})
+        outliers = outliers || metric->histogram.underflow + metric->histogram.overflow > 0;
+    if (!outliers) return;
+    screen << "                      *   Fuera del Histograma (Cuantiles en esa Cola = Min o Max)                     * \n";
+    printOutlierRow("Turnos", summary.length);
+    printOutlierRow("Movimientos", summary.moves);
+    printOutlierRow("Errores", summary.errors);
+    printOutlierRow("Duracion(us)", summary.duration);
+    printOutlierRow("Margen", summary.margin);
+    screen << "                      ********************************************************************************** \n";
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Motor de Simulación ---------------------------------------------------------
+
+/// Estructura: Estado Completo de una Partida sin Interfaz (Copiable y sin Memoria Dinámica)
+struct SimGame {
+
+    std::array<uint8_t, CARD_COUNT> cards;       // Letra de cada Posición (0-17)
+    CardTracker tracker;                         // Cartas Vistas y Emparejadas (Ambos Jugadores ven cada Volteo)
+    int points[2];                               // Puntos de cada Jugador
+    int turn;                                    // Jugador en Turno (0 o 1)
+    int firstPlayer;                             // Jugador que Abrió la Partida
+    int moves;                                   // Contador de Movimientos
+    int errors;                                  // Contador de Errores
+    int turns;                                   // Número de Turnos Jugados
+
+};
+
+
+
+
+/// Estructura: Estrategia de un Jugador Automático
+struct Strategy {
+
+    const char* name;                                                              // Nombre de la Estrategia
+    int (*pickFirst)(const SimGame& game, std::mt19937_64& rng);                   // Elegir Primera Carta
+    int (*pickSecond)(const SimGame& game, int first, std::mt19937_64& rng);       // Elegir Segunda Carta
+
+};
+
+
+
+
+/// Estructura: Resultado de una Partida Simulada
+struct GameResult {
+
+    uint64_t seed;                               // Semilla de la Partida
+    int firstPlayer;                             // Jugador que Abrió la Partida
+    int moves;                                   // Movimientos Totales
+    int errors;                                  // Errores Totales
+    int turns;                                   // Turnos Totales
+    int points[2];                               // Puntos Finales
+    double micros;                               // Tiempo de Cómputo (Microsegundos)
+
+};
+
+
+
+
+/**
+ * @brief Función que Mezcla los Bits de un Entero (SplitMix64).
+ * @param value (uint64_t): El Valor a Mezclar.
+ * @return (uint64_t) El Valor Mezclado.
+ */
+inline uint64_t mixSeed(uint64_t value){
+
+    /// Pasos de SplitMix64
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+
+}
+
+
+
+
+/**
+ * @brief Función para Repartir las Cartas de una Partida Simulada.
+ * @param game (SimGame): La Partida a Inicializar.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ */
+void dealCards(SimGame& game, std::mt19937_64& rng){
+
+    /*
+       - Función: Repartir Cartas
+       - Argumentos:
+            - game (SimGame): Partida a Inicializar
+            - rng (std::mt19937_64): Generador de la Partida
+       - Retorno: Ninguno
+       - Objetivo: Crear los Pares y Barajearlos con el mismo Intercambio que shuffleCards
+    */
+
+    /// Crear Pares y Barajear
+    for (int i = 0; i < CARD_COUNT; i++) game.cards[i] = static_cast<uint8_t>(i / 2);
+    for (int i = 0; i < CARD_COUNT; i++) std::swap(game.cards[i], game.cards[rng() % CARD_COUNT]);
+
+    /// Estado Inicial
+    resetTracker(game.tracker);
+    game.points[0] = game.points[1] = 0;
+    game.firstPlayer = static_cast<int>(rng() & 1);
+    game.turn = game.firstPlayer;
+    game.moves = game.errors = 0;
+    game.turns = 1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Elige una Posición Oculta al Azar.
+ * @param game (SimGame): La Partida.
+ * @param onlyUnknown (bool): Indica si solo se Consideran Posiciones Nunca Vistas.
+ * @param exclude (int): Posición a Excluir (-1 para Ninguna).
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida o -1 si no hay Candidatas.
+ */
+int randomHidden(const SimGame& game, bool onlyUnknown, int exclude, std::mt19937_64& rng){
+
+    /// Desconocidas: Directo de la Lista del Rastreo (la Excluida ya se Vio)
+    const CardTracker& tracker = game.tracker;
+    if (onlyUnknown && tracker.unknownCount > 0) return tracker.unknown[rng() % tracker.unknownCount];
+    if (onlyUnknown) return -1;
+
+    /// Reunir Candidatas
+    int candidates[CARD_COUNT];
+    int count = 0;
+    for (int i = 0; i < CARD_COUNT; i++){
+
+        if (tracker.matched[i] || i == exclude) continue;                    // Ya Emparejada o Excluida
+        candidates[count++] = i;
+
+    }
+
+    /// Elegir una al Azar
+    if (count == 0) return -1;
+    return candidates[rng() % count];
+
+}
+
+
+
+
+/// Estrategia Aleatoria: Primera Carta
+int randomFirst(const SimGame& game, std::mt19937_64& rng){return randomHidden(game, false, -1, rng);}
+
+/// Estrategia Aleatoria: Segunda Carta
+int randomSecond(const SimGame& game, int first, std::mt19937_64& rng){return randomHidden(game, false, first, rng);}
+
+
+
+
+/**
+ * @brief Función que Busca la Pareja Conocida de una Posición.
+ * @param game (SimGame): La Partida.
+ * @param position (int): La Posición de Referencia.
+ * @return (int) La Posición de la Pareja Vista y no Emparejada, o -1.
+ */
+int knownPartner(const SimGame& game, int position){
+
+    /// Otra Posición Vista con la Misma Letra
+    const CardTracker& tracker = game.tracker;
+    int letter = game.cards[position];
+    for (int k = 0; k < tracker.seenCount[letter]; k++) if (tracker.seen[letter][k] != position) return tracker.seen[letter][k];
+    return -1;
+
+}
+
+
+
+
+/**
+ * @brief Estrategia de Memoria Perfecta: Primera Carta.
+ * @param game (SimGame): La Partida.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int memoryFirst(const SimGame& game, std::mt19937_64& rng){
+
+    /// Si hay un Par Completo Conocido, Abrirlo
+    const CardTracker& tracker = game.tracker;
+    if (tracker.pairCount > 0) return tracker.seen[tracker.pairs[tracker.pairCount - 1]][0];
+
+    /// Si no, Descubrir una Carta Nueva
+    int position = randomHidden(game, true, -1, rng);
+    return position >= 0 ? position : randomHidden(game, false, -1, rng);
+
+}
+
+
+
+
+/**
+ * @brief Estrategia de Memoria Perfecta: Segunda Carta.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Primera Carta Abierta.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int memorySecond(const SimGame& game, int first, std::mt19937_64& rng){
+
+    /// Si la Pareja ya se Vio, Abrirla
+    int partner = knownPartner(game, first);
+    if (partner >= 0) return partner;
+
+    /// Si no, Descubrir otra Carta Nueva
+    int position = randomHidden(game, true, first, rng);
+    return position >= 0 ? position : randomHidden(game, false, first, rng);
+
+}
+
+
+
+
+/**
+ * @brief Estrategia de Inferencia: Segunda Carta.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Primera Carta Abierta.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int inferenceSecond(const SimGame& game, int first, std::mt19937_64& rng){
+
+    /*
+       - Función: Segunda Carta por Inferencia
+       - Argumentos:
+            - game (SimGame): Partida
+            - first (int): Primera Carta Abierta
+            - rng (std::mt19937_64): Generador de la Partida
+       - Retorno: Posición Elegida
+       - Objetivo: Con la Pareja Desconocida, Voltear otra Desconocida solo si Acertar (1/u) es más
+                   Probable que Regalarle al Rival el Par de una Suelta ((s-1)/u); si no, Voltear una
+                   Suelta ya Vista, que no Revela Nada Nuevo
+    */
+
+    /// Si la Pareja ya se Vio, Abrirla
+    int partner = knownPartner(game, first);
+    if (partner >= 0) return partner;
+
+    /// Comparar Ganancia y Riesgo de Voltear una Desconocida
+    const CardTracker& tracker = game.tracker;
+    int otherSingles = tracker.knownSingles - 1;                             // Sueltas Distintas de la Primera
+    if (otherSingles > 1 || tracker.unknownCount == 0){
+
+        for (int k = 0; k < tracker.knownSingles; k++){
+
+            int letter = tracker.singles[k];
+            if (tracker.seen[letter][0] != first) return tracker.seen[letter][0];
+
+        }
+
+    }
+    return memorySecond(game, first, rng);
+
+}
+
+
+
+/**
+ * @brief Estrategia de Tablas de Finales: Primera Carta.
+ * @param game (SimGame): La Partida.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int tablebaseFirst(const SimGame& game, std::mt19937_64& rng){
+
+    /// Si hay un Par Completo Conocido, Abrirlo
+    const CardTracker& tracker = game.tracker;
+    if (tracker.pairCount > 0) return tracker.seen[tracker.pairs[tracker.pairCount - 1]][0];
+
+    /// Abrir con una Suelta solo si su Valor en las Tablas Supera al de una Desconocida
+    int pairs = (tracker.unknownCount + tracker.knownSingles) / 2;
+    const TablebaseEntry& entry = tablebase[tablebaseIndex(pairs, tracker.knownSingles)];
+    if (tracker.knownSingles > 0 && entry.firstSingle > entry.firstUnknown) return tracker.seen[tracker.singles[0]][0];
+    return memoryFirst(game, rng);
+
+}
+
+
+
+
+/**
+ * @brief Estrategia de Tablas de Finales: Segunda Carta.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Primera Carta Abierta.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int tablebaseSecond(const SimGame& game, int first, std::mt19937_64& rng){
+
+    /// Pareja Conocida, o Primera ya Vista: Abrir la Pareja o una Desconocida
+    const CardTracker& tracker = game.tracker;
+    if (knownPartner(game, first) >= 0 || tracker.pendingSeen) return memorySecond(game, first, rng);
+
+    /// Primera Nueva: Comparar Desconocida contra Suelta en la Posición Previa al Volteo
+    int pairs = (tracker.unknownCount + tracker.knownSingles) / 2;
+    const TablebaseEntry& entry = tablebase[tablebaseIndex(pairs, tracker.knownSingles - 1)];
+    if (entry.secondSingle > entry.secondUnknown){
+
+        for (int s = 0; s < tracker.knownSingles; s++){
+
+            int position = tracker.seen[tracker.singles[s]][0];
+            if (position != first) return position;
+
+        }
+
+    }
+    return memorySecond(game, first, rng);
+
+}
+
+
+
+
+
+/**
+ * @brief Función que Revela la Primera Carta de un Movimiento.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Posición de la Primera Carta.
+ */
+inline void revealFirst(SimGame& game, int first){
+
+    /// Registrar la Carta y el Movimiento en Curso
+    trackFirst(game.tracker, first, game.cards[first]);
+
+}
+
+
+
+
+/**
+ * @brief Función que Revela la Segunda Carta y Resuelve el Movimiento.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Posición de la Primera Carta.
+ * @param second (int): La Posición de la Segunda Carta.
+ */
+inline void finishMove(SimGame& game, int first, int second){
+
+    /// Revelar y Comparar
+    trackReveal(game.tracker, second, game.cards[second]);
+    bool isMatch = game.cards[first] == game.cards[second];
+    trackResolve(game.tracker, first, second, isMatch);
+    game.moves++;                                                            // Incrementar Movimientos
+
+    /// Misma Regla que mainLoop: Pareja Conserva el Turno
+    if (isMatch) game.points[game.turn]++;                                   // Pareja Encontrada
+    else{                                                                    // Sin Pareja
+
+        game.errors++;
+        game.turn ^= 1;
+        game.turns++;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Juega una Partida Completa sin Interfaz.
+ * @param game (SimGame): La Partida Repartida.
+ * @param players (const Strategy*[2]): Las Estrategias de cada Jugador.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ */
+void playSimGame(SimGame& game, const Strategy* const players[2], std::mt19937_64& rng){
+
+    /*
+       - Función: Jugar Partida Simulada
+       - Argumentos:
+            - game (SimGame): Partida Repartida
+            - players (const Strategy*[2]): Estrategias de cada Jugador
+            - rng (std::mt19937_64): Generador de la Partida
+       - Retorno: Ninguno
+       - Objetivo: Aplicar las mismas Reglas que mainLoop (Pareja Conserva el Turno)
+    */
+
+    /// Bucle de la Partida
+    while (game.points[0] + game.points[1] < PAIR_COUNT){
+
+        const Strategy* player = players[game.turn];                         // Estrategia en Turno
+        int first = player->pickFirst(game, rng);                            // Primera Carta
+        revealFirst(game, first);                                            // Revelar Primera Carta
+        finishMove(game, first, player->pickSecond(game, first, rng));       // Segunda Carta y Resultado
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Agregar el Resultado de una Partida al Resumen.
+ * @param summary (GameSummary): El Resumen a Actualizar.
+ * @param result (GameResult): El Resultado de la Partida.
+ */
+void addResult(GameSummary& summary, const GameResult& result){
+
+    /// Métricas de la Partida
+    addSample(summary.length, result.turns);
+    addSample(summary.moves, result.moves);
+    addSample(summary.errors, result.errors);
+    addSample(summary.duration, result.micros);
+    addSample(summary.margin, result.points[0] - result.points[1]);
+
+    /// Resultado Final
+    if (result.points[0] > result.points[1]) summary.winsPlayer1++;
+    else if (result.points[0] < result.points[1]) summary.winsPlayer2++;
+    else summary.ties++;
+
+}
+
+
+
+
+/**
+ * @brief Función que Simula una Partida a partir de su Semilla.
+ * @param seed (uint64_t): La Semilla de la Partida.
+ * @param players (const Strategy*[2]): Las Estrategias de cada Jugador.
+ * @return (GameResult) El Resultado de la Partida.
+ */
+GameResult simulateGame(uint64_t seed, const Strategy* const players[2]){
+
+    /// Partida Reproducible a partir de la Semilla
+    auto start = std::chrono::steady_clock::now();
+    std::mt19937_64 rng(seed);
+    SimGame game;
+    dealCards(game, rng);
+    playSimGame(game, players, rng);
+    auto end = std::chrono::steady_clock::now();
+
+    /// Resultado
+    GameResult result;
+    result.seed = seed;
+    result.firstPlayer = game.firstPlayer;
+    result.moves = game.moves;
+    result.errors = game.errors;
+    result.turns = game.turns;
+    result.points[0] = game.points[0];
+    result.points[1] = game.points[1];
+    result.micros = chrono::duration<double, std::micro>(end - start).count();
+    return result;
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Búsqueda --------------------------------------------------------------------
+
+/// Estructura: Parámetros del Jugador por Búsqueda
+struct SearchSettings {
+
+    int budgetMilliseconds = 5;                  // Tiempo de Búsqueda por Decisión
+    int playouts = 0;                            // Simulaciones Fijas por Decisión (0 = Usar el Tiempo)
+    int threads = 1;                             // Hilos para Simulaciones en Paralelo
+    int tableMegabytes = 0;                      // Tamaño de la Tabla de Transposición (0 = Apagada)
+
+};
+
+SearchSettings searchSettings;                                                    /// Parámetros Globales de la Búsqueda
+std::atomic<long long> searchPlayouts(0);                                         /// Simulaciones Jugadas (para Medición)
+
+/// Política de las Simulaciones: Memoria Perfecta sin Regalar Información
+const Strategy ROLLOUT_POLICY = {"inferencia", memoryFirst, inferenceSecond};
+
+/// Jugadas Abstractas que Compara la Búsqueda (las Desconocidas son Intercambiables entre sí)
+enum SearchAction {
+
+    ACTION_UNKNOWN,                              // Voltear una Carta Nunca Vista
+    ACTION_SINGLE                                // Voltear una Carta Suelta ya Vista
+
+};
+
+
+
+
+/// Estructura: Espacio de Trabajo Reutilizable de un Hilo de Búsqueda
+struct SearchWorkspace {
+
+    SimGame sample;                              // Reparto Muestreado Consistente con lo Visto
+    SimGame rollout;                             // Copia que se Juega hasta el Final
+    std::mt19937_64 rng;                         // Generador Propio del Hilo
+
+};
+
+
+
+
+/**
+ * @brief Función que Muestrea las Cartas Ocultas Consistentes con lo Visto.
+ * @param game (SimGame): La Partida (sus Cartas no Vistas se Reemplazan).
+ * @param rng (std::mt19937_64): El Generador.
+ */
+void sampleHidden(SimGame& game, std::mt19937_64& rng){
+
+    /*
+       - Función: Muestrear Cartas Ocultas
+       - Argumentos:
+            - game (SimGame): Partida a Muestrear
+            - rng (std::mt19937_64): Generador
+       - Retorno: Ninguno
+       - Objetivo: Repartir al Azar entre las Posiciones Nunca Vistas las Letras que aún Faltan por Ver
+    */
+
+    /// Letras que Faltan: Dos por Letra menos las Vistas o Emparejadas
+    const CardTracker& tracker = game.tracker;
+    int missing[PAIR_COUNT];
+    std::fill(missing, missing + PAIR_COUNT, 2);
+    for (int i = 0; i < CARD_COUNT; i++) if (tracker.matched[i] || tracker.letterAt[i] >= 0) missing[game.cards[i]]--;
+
+    /// Barajear las Letras Faltantes sobre las Desconocidas
+    uint8_t letters[CARD_COUNT];
+    int count = 0;
+    for (int l = 0; l < PAIR_COUNT; l++) for (int k = 0; k < missing[l]; k++) letters[count++] = static_cast<uint8_t>(l);
+    for (int i = count - 1; i > 0; i--) std::swap(letters[i], letters[rng() % (i + 1)]);
+    for (int k = 0; k < count; k++) game.cards[tracker.unknown[k]] = letters[k];
+
+}
+
+
+
+
+/**
+ * @brief Función que Devuelve la Posición de una Suelta Distinta de una Letra.
+ * @param tracker (CardTracker): El Rastreo.
+ * @param exclude (int): Posición a Evitar (-1 para Ninguna).
+ * @return (int) La Posición o -1 si no Existe.
+ */
+int singlePosition(const CardTracker& tracker, int exclude){
+
+    /// Primera Suelta que no sea la Excluida
+    for (int k = 0; k < tracker.knownSingles; k++){
+
+        int position = tracker.seen[tracker.singles[k]][0];
+        if (position != exclude) return position;
+
+    }
+    return -1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Simula una Jugada Abstracta y Juega el Resto de la Partida.
+ * @param workspace (SearchWorkspace): El Espacio de Trabajo (sample ya Muestreado).
+ * @param first (int): Primera Carta ya Abierta (-1 si la Decisión es la Primera Carta).
+ * @param action (SearchAction): La Jugada a Evaluar.
+ * @return (int) El Margen Final desde el Punto de Vista del Jugador en Turno.
+ */
+int playoutAction(SearchWorkspace& workspace, int first, SearchAction action){
+
+    /*
+       - Función: Simular Jugada
+       - Argumentos:
+            - workspace (SearchWorkspace): Espacio de Trabajo
+            - first (int): Primera Carta ya Abierta
+            - action (SearchAction): Jugada a Evaluar
+       - Retorno: Margen Final del Jugador en Turno
+       - Objetivo: Copiar el Reparto Muestreado, Aplicar la Jugada y Terminar con la Política Base
+    */
+
+    /// Copia Barata del Estado (sin Memoria Dinámica)
+    SimGame& game = workspace.rollout;
+    game = workspace.sample;
+    int me = game.turn;
+
+    /// Completar el Movimiento con la Jugada Evaluada
+    if (first < 0){                                                                           // Decisión de Primera Carta
+
+        if (action == ACTION_UNKNOWN){
+
+            first = game.tracker.unknown[workspace.rng() % game.tracker.unknownCount];
+            revealFirst(game, first);
+            finishMove(game, first, inferenceSecond(game, first, workspace.rng));
+
+        }
+        else{
+
+            first = singlePosition(game.tracker, -1);
+            revealFirst(game, first);
+            finishMove(game, first, memorySecond(game, first, workspace.rng));
+
+        }
+
+    }
+    else{                                                                                     // Decisión de Segunda Carta
+
+        int second = action == ACTION_UNKNOWN ? game.tracker.unknown[workspace.rng() % game.tracker.unknownCount] : singlePosition(game.tracker, first);
+        finishMove(game, first, second);
+
+    }
+
+    /// Terminar la Partida con la Política Base
+    const Strategy* const players[2] = {&ROLLOUT_POLICY, &ROLLOUT_POLICY};
+    playSimGame(game, players, workspace.rng);
+    return game.points[me] - game.points[1 - me];
+
+}
+
+
+
+
+/// Tabla de Transposición Compartida: Cubetas de una Línea de Caché con 4 Entradas de Dos Palabras
+const int TT_WAYS = 4;                                                            /// Entradas por Cubeta
+const long long TT_ROUNDS_LIMIT = (1 << 24) - 1;                                  /// Rondas que Caben en una Entrada (24 Bits)
+const long long TT_ROUND_SPREAD = 2 * PAIR_COUNT;                                 /// Mayor |Diferencia| de una Ronda: Margen de +18 contra -18
+static_assert(TT_ROUNDS_LIMIT * TT_ROUND_SPREAD <= INT32_MAX, "La Diferencia de Rondas Saturadas Debe Caber en 32 Bits");
+const int ZOBRIST_KEYS = (CARD_COUNT + 1) + 4 * (PAIR_COUNT + 1) + 2;             /// Claves Aleatorias de Zobrist
+
+/// Estructura: Cubeta de la Tabla (Palabra 0 = Clave XOR Datos, Palabra 1 = Datos)
+struct alignas(64) TranspositionBucket {
+
+    std::atomic<uint64_t> words[2 * TT_WAYS];    // Entradas Verificadas por XOR (sin Candados)
+
+};
+
+/// Estructura: Contadores de la Tabla
+struct TranspositionStats {
+
+    std::atomic<long long> probes{0};            // Consultas
+    std::atomic<long long> hits{0};              // Consultas que Encontraron su Estado
+    std::atomic<long long> stores{0};            // Escrituras
+    std::atomic<long long> evictions{0};         // Escrituras que Desplazaron a Otro Estado (Colisión de Índice)
+
+};
+
+std::vector<TranspositionBucket> transpositionTable;                              /// Cubetas (Vacía = Tabla Apagada)
+std::atomic<uint8_t> transpositionAge(0);                                         /// Generación Actual (Reemplazo por Edad)
+TranspositionStats transpositionStats;                                            /// Contadores Globales
+
+
+
+
+/**
+ * @brief Función que Genera las Claves de Zobrist.
+ * @return (std::array<uint64_t, ZOBRIST_KEYS>) Claves Fijas (Derivadas de mixSeed).
+ */
+std::array<uint64_t, ZOBRIST_KEYS> makeZobrist(){
+
+    /// Claves Reproducibles entre Ejecuciones
+    std::array<uint64_t, ZOBRIST_KEYS> keys;
+    for (int i = 0; i < ZOBRIST_KEYS; i++) keys[i] = mixSeed(0x5A0B7157ULL + i);
+    return keys;
+
+}
+
+const std::array<uint64_t, ZOBRIST_KEYS> ZOBRIST = makeZobrist();                 /// [Desconocidas] [Sueltas] [Pares] [Puntos x 2] [Pendiente] [Turno]
+
+
+
+
+/**
+ * @brief Función que Calcula la Clave de un Estado de Información.
+ * @param game (SimGame): La Partida (solo se usa lo Visto).
+ * @param first (int): Primera Carta ya Abierta (-1 si la Decisión es la Primera Carta).
+ * @return (uint64_t) Clave de Zobrist.
+ */
+uint64_t knowledgeKey(const SimGame& game, int first){
+
+    /*
+       - Función: Clave de Conocimiento
+       - Argumentos:
+            - game (SimGame): Partida
+            - first (int): Primera Carta Abierta
+       - Retorno: Clave
+       - Objetivo: XOR de una Clave por Rasgo de lo que se Sabe del Tablero (Desconocidas, Sueltas y Pares
+                   Conocidos), Puntos, Carta Pendiente y Turno; chooseAction solo Compara Jugadas Abstractas, cuyo
+                   Valor no Depende de qué Posiciones ni qué Letras son, así que Partidas con Repartos y Órdenes
+                   Distintos Comparten Entrada
+    */
+
+    /// Desplazamientos de cada Grupo de Claves
+    const int SINGLES = CARD_COUNT + 1, PAIRS = SINGLES + PAIR_COUNT + 1, SCORES = PAIRS + PAIR_COUNT + 1;
+    const int PENDING = SCORES + 2 * (PAIR_COUNT + 1), TURN = PENDING + 1;
+
+    /// Conocimiento del Tablero, Puntos, Carta Pendiente y Turno
+    const CardTracker& tracker = game.tracker;
+    uint64_t key = ZOBRIST[tracker.unknownCount] ^ ZOBRIST[SINGLES + tracker.knownSingles] ^ ZOBRIST[PAIRS + tracker.pairCount];
+    key ^= ZOBRIST[SCORES + game.points[0]] ^ ZOBRIST[SCORES + PAIR_COUNT + 1 + game.points[1]];
+    if (first >= 0) key ^= ZOBRIST[PENDING];
+    if (game.turn) key ^= ZOBRIST[TURN];
+    return key;
+
+}
+
+
+
+
+/**
+ * @brief Función que Reserva (o Apaga) la Tabla de Transposición.
+ * @param megabytes (int): Tamaño en MB (0 Apaga la Tabla); se Redondea a una Potencia de 2 de Cubetas.
+ */
+void resizeTranspositions(int megabytes){
+
+    /// Cubetas Nuevas en Cero (una Palabra de Datos en Cero es una Entrada Vacía)
+    size_t buckets = 0;
+    if (megabytes > 0){
+
+        buckets = 1;
+        while (buckets * 2 * sizeof(TranspositionBucket) <= static_cast<size_t>(megabytes) << 20) buckets *= 2;
+
+    }
+    std::vector<TranspositionBucket> table(buckets);
+    transpositionTable.swap(table);
+    transpositionAge = 0;
+
+}
+
+
+
+
+/**
+ * @brief Función que Empaqueta los Datos de una Entrada.
+ * @param rounds (long long): Rondas Acumuladas (Profundidad de la Entrada).
+ * @param difference (long long): Suma de Márgenes de Suelta menos los de Desconocida.
+ * @param age (uint8_t): Generación de la Escritura.
+ * @return (uint64_t) 24 Bits de Rondas, 32 de Diferencia y 8 de Edad.
+ */
+inline uint64_t packTransposition(long long rounds, long long difference, uint8_t age){
+
+    /*
+       - Función: Empaquetar Entrada
+       - Argumentos:
+            - rounds (long long): Rondas Acumuladas
+            - difference (long long): Suma de Diferencias
+            - age (uint8_t): Generación
+       - Retorno: Palabra de Datos
+       - Objetivo: Ambas Jugadas se Evalúan sobre el mismo Reparto desde la misma Raíz, así que los Puntos ya
+                   Ganados se Cancelan y cada Ronda Aporta como Mucho TT_ROUND_SPREAD en Valor Absoluto. Al
+                   Saturarse las Rondas, la Diferencia se Escala en la misma Proporción (Conserva la Media), y
+                   entonces |Diferencia| <= TT_ROUNDS_LIMIT * TT_ROUND_SPREAD Cabe en 32 Bits sin Saturar Nunca
+    */
+
+    /// Escalar la Diferencia si las Rondas no Caben (la Media por Ronda es lo que Decide)
+    if (rounds > TT_ROUNDS_LIMIT){
+
+        difference = static_cast<long long>(static_cast<double>(difference) * TT_ROUNDS_LIMIT / rounds);
+        rounds = TT_ROUNDS_LIMIT;
+
+    }
+    int32_t packedDifference = static_cast<int32_t>(std::max<long long>(-TT_ROUNDS_LIMIT * TT_ROUND_SPREAD, std::min<long long>(TT_ROUNDS_LIMIT * TT_ROUND_SPREAD, difference)));
+    return static_cast<uint64_t>(rounds) | static_cast<uint64_t>(static_cast<uint32_t>(packedDifference)) << 24 | static_cast<uint64_t>(age) << 56;
+
+}
+
+
+
+
+/**
+ * @brief Función que Consulta la Tabla de Transposición.
+ * @param key (uint64_t): Clave del Estado.
+ * @param rounds (long long): Rondas Guardadas (Salida).
+ * @param difference (long long): Diferencia Guardada (Salida).
+ * @return (bool) Verdadero si el Estado Estaba en la Tabla.
+ */
+bool probeTransposition(uint64_t key, long long& rounds, long long& difference){
+
+    /*
+       - Función: Consultar Tabla
+       - Argumentos:
+            - key (uint64_t): Clave
+            - rounds (long long): Rondas Guardadas
+            - difference (long long): Diferencia Guardada
+       - Retorno: Si Hubo Acierto
+       - Objetivo: Una Entrada solo Vale si Clave XOR Datos Coincide con las Palabras Leídas: una Escritura a
+                   Medias de otro Hilo no Pasa la Verificación y se Trata como Fallo
+    */
+
+    /// Recorrer las Entradas de la Cubeta
+    transpositionStats.probes.fetch_add(1, std::memory_order_relaxed);
+    TranspositionBucket& bucket = transpositionTable[key & (transpositionTable.size() - 1)];
+    for (int way = 0; way < TT_WAYS; way++){
+
+        uint64_t check = bucket.words[way * 2].load(std::memory_order_relaxed);
+        uint64_t data = bucket.words[way * 2 + 1].load(std::memory_order_relaxed);
+        if (data == 0 || (check ^ data) != key) continue;
+        rounds = static_cast<long long>(data & TT_ROUNDS_LIMIT);
+        difference = static_cast<int32_t>(static_cast<uint32_t>(data >> 24));
+        transpositionStats.hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+
+    }
+    return false;
+
+}
+
+
+
+
+/**
+ * @brief Función que Guarda un Estado en la Tabla de Transposición.
+ * @param key (uint64_t): Clave del Estado.
+ * @param rounds (long long): Rondas Acumuladas.
+ * @param difference (long long): Diferencia Acumulada.
+ */
+void storeTransposition(uint64_t key, long long rounds, long long difference){
+
+    /*
+       - Función: Guardar en Tabla
+       - Argumentos:
+            - key (uint64_t): Clave
+            - rounds (long long): Rondas
+            - difference (long long): Diferencia
+       - Retorno: Ninguno
+       - Objetivo: Reusar la Entrada del mismo Estado o una Vacía; si no, Reemplazar la de Menor Profundidad
+                   (Rondas), Restando Profundidad a las de Generaciones Anteriores para que Envejezcan
+    */
+
+    /// Elegir Entrada
+    transpositionStats.stores.fetch_add(1, std::memory_order_relaxed);
+    TranspositionBucket& bucket = transpositionTable[key & (transpositionTable.size() - 1)];
+    uint8_t age = transpositionAge.load(std::memory_order_relaxed);
+    int victim = 0;
+    long long victimScore = std::numeric_limits<long long>::max();
+    for (int way = 0; way < TT_WAYS; way++){
+
+        uint64_t check = bucket.words[way * 2].load(std::memory_order_relaxed);
+        uint64_t data = bucket.words[way * 2 + 1].load(std::memory_order_relaxed);
+        if (data == 0 || (check ^ data) == key){victim = way; victimScore = -1; break;}
+        long long depth = static_cast<long long>(data & TT_ROUNDS_LIMIT);
+        long long score = depth - (static_cast<uint8_t>(age - static_cast<uint8_t>(data >> 56)) << 20);
+        if (score < victimScore){victim = way; victimScore = score;}
+
+    }
+    if (victimScore >= 0) transpositionStats.evictions.fetch_add(1, std::memory_order_relaxed);
+
+    /// Escribir las Dos Palabras (un Lector que las Vea Mezcladas Fallará la Verificación)
+    uint64_t data = packTransposition(std::max(1LL, rounds), difference, age);
+    bucket.words[victim * 2].store(key ^ data, std::memory_order_relaxed);
+    bucket.words[victim * 2 + 1].store(data, std::memory_order_relaxed);
+
+}
+
+
+
+
+/// Estructura: Hilos Ayudantes Persistentes (cada Hilo que Decide y cada Lote de Entornos Tiene los Suyos)
+struct HelperThreads {
+
+    std::mutex lock;                                   // Protege Trabajo, Generación y Pendientes
+    std::condition_variable wake;                      // Avisa a los Ayudantes de una Decisión Nueva
+    std::condition_variable done;                      // Avisa al que Decide que Terminaron
+    const std::function<void(int)>* job = nullptr;     // Trabajo en Curso (Recibe el Número de Hilo)
+    uint64_t generation = 0;                           // Trabajos Repartidos
+    int pending = 0;                                   // Ayudantes sin Terminar el Trabajo en Curso
+    bool stopping = false;                             // Terminar los Hilos
+    std::vector<std::thread> threads;                  // Hilos 1..N-1 (el 0 es quien Reparte)
+
+    ~HelperThreads();                                  // Detiene los Hilos (al Terminar el Dueño)
+
+};
+
+
+
+
+/**
+ * @brief Función que Detiene los Hilos Ayudantes y Espera que Terminen.
+ * @param helpers (HelperThreads): Los Ayudantes (Quedan sin Hilos).
+ */
+void stopHelperThreads(HelperThreads& helpers){
+
+    /// Avisar y Esperar
+    {
+
+        std::lock_guard<std::mutex> guard(helpers.lock);
+        helpers.stopping = true;
+
+    }
+    helpers.wake.notify_all();
+    for (std::thread& thread : helpers.threads) thread.join();
+    helpers.threads.clear();
+    helpers.stopping = false;
+
+}
+
+HelperThreads::~HelperThreads(){stopHelperThreads(*this);}
+
+
+
+
+/**
+ * @brief Función del Hilo Ayudante: Espera cada Trabajo y Hace su Parte.
+ * @param helpers (HelperThreads): Los Ayudantes.
+ * @param index (int): Número de Hilo (1..N-1).
+ * @param seen (uint64_t): Último Trabajo ya Repartido al Crearse.
+ */
+void helperThreadLoop(HelperThreads& helpers, int index, uint64_t seen){
+
+    while (true){
+
+        /// Esperar un Trabajo Nuevo (o el Aviso de Terminar)
+        const std::function<void(int)>* job;
+        {
+
+            std::unique_lock<std::mutex> guard(helpers.lock);
+            helpers.wake.wait(guard, [&]{return helpers.stopping || helpers.generation != seen;});
+            if (helpers.stopping) return;
+            seen = helpers.generation;
+            job = helpers.job;
+
+        }
+
+        /// Parte del Hilo y Aviso al Terminar
+        (*job)(index);
+        std::lock_guard<std::mutex> guard(helpers.lock);
+        if (--helpers.pending == 0) helpers.done.notify_one();
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Reparte un Trabajo entre el Hilo Actual y sus Ayudantes.
+ * @param helpers (HelperThreads): Los Ayudantes (se Crean o Ajustan al Número Pedido).
+ * @param threads (int): Hilos en Total (el Actual Incluido).
+ * @param job (std::function<void(int)>): Parte de un Hilo (Recibe su Número, de 0 a threads - 1).
+ */
+void runHelperThreads(HelperThreads& helpers, int threads, const std::function<void(int)>& job){
+
+    /*
+       - Función: Repartir Trabajo
+       - Argumentos:
+            - helpers (HelperThreads): Ayudantes
+            - threads (int): Hilos en Total
+            - job (std::function<void(int)>): Parte de un Hilo
+       - Retorno: Ninguno
+       - Objetivo: Los Ayudantes se Crean la Primera Vez y Esperan Dormidos entre Trabajos, así que Repartir
+                   no Crea Hilos; solo se Vuelven a Crear si Cambia el Número de Hilos
+    */
+
+    if (threads <= 1){job(0); return;}
+
+    /// Ayudantes del Tamaño Pedido
+    if (static_cast<int>(helpers.threads.size()) != threads - 1){
+
+        stopHelperThreads(helpers);
+        for (int t = 1; t < threads; t++) helpers.threads.emplace_back(helperThreadLoop, std::ref(helpers), t, helpers.generation);
+
+    }
+
+    /// Repartir, Hacer la Parte Propia y Esperar al Resto
+    {
+
+        std::lock_guard<std::mutex> guard(helpers.lock);
+        helpers.job = &job;
+        helpers.pending = threads - 1;
+        helpers.generation++;
+
+    }
+    helpers.wake.notify_all();
+    job(0);
+    std::unique_lock<std::mutex> guard(helpers.lock);
+    helpers.done.wait(guard, [&]{return helpers.pending == 0;});
+
+}
+
+
+
+
+/**
+ * @brief Función que Reparte las Rondas de una Decisión entre el Hilo Actual y sus Ayudantes.
+ * @param threads (int): Hilos en Total (el Actual Incluido).
+ * @param job (std::function<void(int)>): Rondas de un Hilo (Recibe su Número, de 0 a threads - 1).
+ */
+void runSearchThreads(int threads, const std::function<void(int)>& job){
+
+    /*
+       - Función: Repartir Rondas
+       - Argumentos:
+            - threads (int): Hilos en Total
+            - job (std::function<void(int)>): Rondas de un Hilo
+       - Retorno: Ninguno
+       - Objetivo: Cada Hilo que Decide Tiene sus Propios Ayudantes, así que el Espacio de Trabajo
+                   thread_local de cada Ayudante Sigue Vivo de una Decisión a la Siguiente
+    */
+
+    static thread_local HelperThreads helpers;
+    runHelperThreads(helpers, threads, job);
+
+}
+
+
+
+
+/**
+ * @brief Función que Elige la Mejor Jugada Abstracta por Muestreo.
+ * @param game (SimGame): La Partida Real (solo se usa lo Visto).
+ * @param first (int): Primera Carta ya Abierta (-1 si la Decisión es la Primera Carta).
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (SearchAction) La Jugada con Mayor Margen Esperado.
+ */
+SearchAction chooseAction(const SimGame& game, int first, std::mt19937_64& rng){
+
+    /*
+       - Función: Elegir Jugada
+       - Argumentos:
+            - game (SimGame): Partida Real
+            - first (int): Primera Carta ya Abierta
+            - rng (std::mt19937_64): Generador de la Partida
+       - Retorno: Jugada Elegida
+       - Objetivo: Expectimax por Muestreo: en cada Ronda se Muestrea un Reparto Oculto y se Evalúan
+                   Ambas Jugadas sobre el mismo Reparto, hasta Agotar el Tiempo o las Simulaciones; con Tabla de
+                   Transposición se Parte de las Rondas ya Hechas sobre el mismo Estado (por esta u otra Partida)
+    */
+
+    /// Rondas ya Acumuladas en la Tabla de Transposición (si está Encendida)
+    bool shared = !transpositionTable.empty();
+    uint64_t key = shared ? knowledgeKey(game, first) : 0;
+    long long storedRounds = 0, storedDifference = 0;
+    if (shared && !probeTransposition(key, storedRounds, storedDifference)) storedRounds = storedDifference = 0;
+    if (searchSettings.playouts > 0 && storedRounds >= searchSettings.playouts) return storedDifference > 0 ? ACTION_SINGLE : ACTION_UNKNOWN;
+
+    /// Límites de la Búsqueda (con Simulaciones Fijas solo Faltan las no Guardadas)
+    auto deadline = std::chrono::steady_clock::now() + chrono::milliseconds(searchSettings.budgetMilliseconds);
+    int threads = std::max(1, searchSettings.threads);
+    long long rounds = searchSettings.playouts > 0 ? (searchSettings.playouts - storedRounds + threads - 1) / threads : -1;
+
+    /// Semillas de cada Hilo Tomadas del Generador de la Partida (Búferes del Hilo que Decide: sin Memoria Dinámica por Decisión)
+    static thread_local std::vector<uint64_t> deciderSeeds;
+    static thread_local std::vector<long long> deciderTotals;
+    std::vector<uint64_t>& seeds = deciderSeeds;                                            // Referencias: los Ayudantes ven los del que Decide
+    std::vector<long long>& totals = deciderTotals;
+    seeds.resize(threads);
+    for (int t = 0; t < threads; t++) seeds[t] = rng();
+
+    /// Rondas de Muestreo (en Paralelo si se Pide)
+    totals.assign(threads * 3, 0);
+    auto search = [&](int t){
+
+        static thread_local SearchWorkspace workspace;                                       // Del Hilo (Ayudantes Persistentes): Vive entre Decisiones
+        workspace.rng.seed(seeds[t]);
+        long long round = 0;
+        for (; rounds < 0 || round < rounds; round++){
+
+            if (rounds < 0 && (round & 7) == 0 && std::chrono::steady_clock::now() >= deadline) break;
+            workspace.sample = game;
+            sampleHidden(workspace.sample, workspace.rng);
+            totals[t * 3 + ACTION_UNKNOWN] += playoutAction(workspace, first, ACTION_UNKNOWN);
+            totals[t * 3 + ACTION_SINGLE] += playoutAction(workspace, first, ACTION_SINGLE);
+            searchPlayouts += 2;
+
+        }
+        totals[t * 3 + 2] = round;
+
+    };
+    runSearchThreads(threads, std::ref(search));                                            // Por Referencia: std::function no Reserva
+
+    /// Sumar Márgenes (Mismo Número de Rondas para Ambas Jugadas) y los ya Guardados
+    long long unknownTotal = 0, singleTotal = 0, roundsDone = 0;
+    for (int t = 0; t < threads; t++){
+
+        unknownTotal += totals[t * 3 + ACTION_UNKNOWN];
+        singleTotal += totals[t * 3 + ACTION_SINGLE];
+        roundsDone += totals[t * 3 + 2];
+
+    }
+    if (shared) storeTransposition(key, storedRounds + roundsDone, storedDifference + singleTotal - unknownTotal);
+    return storedDifference + singleTotal > unknownTotal ? ACTION_SINGLE : ACTION_UNKNOWN;
+
+}
+
+
+
+
+/**
+ * @brief Estrategia por Búsqueda: Primera Carta.
+ * @param game (SimGame): La Partida.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int searchFirst(const SimGame& game, std::mt19937_64& rng){
+
+    /// Decisiones Forzadas: Par Conocido, o sin Sueltas que Comparar
+    const CardTracker& tracker = game.tracker;
+    if (tracker.pairCount > 0 || tracker.knownSingles == 0 || tracker.unknownCount == 0) return memoryFirst(game, rng);
+
+    /// Comparar Abrir con Desconocida o con Suelta
+    if (chooseAction(game, -1, rng) == ACTION_SINGLE) return singlePosition(tracker, -1);
+    return tracker.unknown[rng() % tracker.unknownCount];
+
+}
+
+
+
+
+/**
+ * @brief Estrategia por Búsqueda: Segunda Carta.
+ * @param game (SimGame): La Partida.
+ * @param first (int): La Primera Carta Abierta.
+ * @param rng (std::mt19937_64): El Generador de la Partida.
+ * @return (int) La Posición Elegida.
+ */
+int searchSecond(const SimGame& game, int first, std::mt19937_64& rng){
+
+    /// Decisiones Forzadas: Pareja Conocida, sin otra Suelta o sin Desconocidas
+    const CardTracker& tracker = game.tracker;
+    if (knownPartner(game, first) >= 0 || singlePosition(tracker, first) < 0 || tracker.unknownCount == 0) return memorySecond(game, first, rng);
+
+    /// Comparar Cerrar con Desconocida o con Suelta
+    if (chooseAction(game, first, rng) == ACTION_SINGLE) return singlePosition(tracker, first);
+    return tracker.unknown[rng() % tracker.unknownCount];
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Registro de Estrategias -----------------------------------------------------
+
+/// Registro de Estrategias Disponibles
+const Strategy STRATEGIES[] = {
+
+    {"aleatoria", randomFirst, randomSecond},    // Sin Memoria
+    {"memoria", memoryFirst, memorySecond},      // Memoria Perfecta
+    {"inferencia", memoryFirst, inferenceSecond},// Memoria Perfecta sin Regalar Información
+    {"busqueda", searchFirst, searchSecond},     // Expectimax por Muestreo de Repartos
+    {"tablas", tablebaseFirst, tablebaseSecond}  // Valores de las Tablas de Finales (Óptimos sin Pases)
+
+};
+const int STRATEGY_COUNT = sizeof(STRATEGIES) / sizeof(STRATEGIES[0]);
+
+
+
+
+/**
+ * @brief Función que Busca una Estrategia por Nombre.
+ * @param name (std::string): El Nombre de la Estrategia.
+ * @return (int) El Índice de la Estrategia.
+ * @throw std::invalid_argument Si la Estrategia no Existe.
+ */
+int findStrategy(const std::string& name){
+
+    /// Buscar en el Registro
+    for (int i = 0; i < STRATEGY_COUNT; i++) if (name == STRATEGIES[i].name) return i;
+    throw std::invalid_argument("Estrategia Desconocida: " + name);
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Variantes de Reglas ---------------------------------------------------------
+
+/// Políticas de Turno: ¿Encontrar Pareja Conserva el Turno?
+struct KeepTurnOnMatch {static constexpr bool keepsTurn = true;};                 /// Regla de mainLoop
+struct PassTurnAlways {static constexpr bool keepsTurn = false;};                 /// Cada Movimiento Pasa el Turno
+
+/// Políticas de Penalización: Puntos que Pierde quien Falla Volteando una Carta ya Vista
+template <int Points> struct KnownFlipPenalty {static constexpr int points = Points;};
+
+/// Políticas de Comodines: Puntos Extra por el Par Comodín (la Letra JOKER_LETTER)
+template <int Bonus> struct JokerPair {static constexpr int bonus = Bonus;};
+const int JOKER_LETTER = 0;                                                       /// Letra del Par Comodín
+
+/// Políticas de Límite: Movimientos Máximos por Turno (0 = sin Límite)
+template <int Moves> struct FlipLimit {static constexpr int moves = Moves;};
+
+const int OPEN_MARGIN_REACH = HISTOGRAM_BUCKETS / 2 - 1;                          /// Margen sin Cota (Penalizaciones): Cubetas de 1 Punto, -31 a 32
+
+/// Conjunto de Reglas: Cada Política es un Parámetro, Resuelto al Compilar
+template <class Turn, class Penalty, class Joker, class Limit>
+struct RuleSet {
+
+    using TurnPolicy = Turn;                     // Conservar o Pasar el Turno
+    using PenaltyPolicy = Penalty;               // Penalización por Fallar con Cartas Vistas
+    using JokerPolicy = Joker;                   // Puntos Extra del Par Comodín
+    using LimitPolicy = Limit;                   // Movimientos Máximos por Turno
+
+    static constexpr int scoreCeiling = PAIR_COUNT + Joker::bonus;                 // Todos los Pares y el Comodín
+
+    /// Peor Margen: sin Penalización, uno lo Gana Todo y el Otro Queda en 0; con ella los Fallos no
+    /// Tienen Tope, así que no hay Peor Margen y el Histograma Cubre lo que Cabe en Cubetas de 1 Punto
+    static constexpr int marginReach = Penalty::points == 0 ? scoreCeiling : OPEN_MARGIN_REACH;
+
+};
+
+using ClassicRules = RuleSet<KeepTurnOnMatch, KnownFlipPenalty<0>, JokerPair<0>, FlipLimit<0>>;
+using PassTurnRules = RuleSet<PassTurnAlways, KnownFlipPenalty<0>, JokerPair<0>, FlipLimit<0>>;
+using PenaltyRules = RuleSet<KeepTurnOnMatch, KnownFlipPenalty<1>, JokerPair<0>, FlipLimit<0>>;
+using JokerRules = RuleSet<KeepTurnOnMatch, KnownFlipPenalty<0>, JokerPair<2>, FlipLimit<0>>;
+using LimitRules = RuleSet<KeepTurnOnMatch, KnownFlipPenalty<0>, JokerPair<0>, FlipLimit<3>>;
+
+/// Estructura: Variante de Reglas Registrada (Motor ya Instanciado)
+struct RuleVariant {
+
+    const char* name;                                                              // Nombre para --rules
+    const char* description;                                                       // Descripción Corta
+    GameResult (*simulate)(uint64_t seed, const Strategy* const players[2]);       // Motor de la Variante
+    int marginReach;                                                               // Margen que Cubre el Histograma (Exacto si la Variante lo Acota)
+
+};
+
+
+
+
+/**
+ * @brief Función que Resuelve un Movimiento según un Conjunto de Reglas.
+ * @param game (SimGame): La Partida (game.points Cuenta Pares, como en el Motor Clásico).
+ * @param first (int): La Posición de la Primera Carta.
+ * @param second (int): La Posición de la Segunda Carta.
+ * @param score (int[2]): Puntos de cada Jugador según la Variante.
+ * @param streak (int): Movimientos Hechos en el Turno Actual.
+ */
+template <class Rules>
+inline void finishRuledMove(SimGame& game, int first, int second, int score[2], int& streak){
+
+    /*
+       - Función: Resolver Movimiento con Reglas
+       - Argumentos:
+            - game (SimGame): Partida
+            - first (int): Primera Carta
+            - second (int): Segunda Carta
+            - score (int[2]): Puntos de la Variante
+            - streak (int): Movimientos del Turno
+       - Retorno: Ninguno
+       - Objetivo: Mismo Movimiento que finishMove; las Reglas son Constantes del Tipo, así que con las
+                   Políticas Clásicas el Compilador Elimina cada Rama y Queda el mismo Código. Los Pares
+                   Siguen en game.points para que las Estrategias y el Fin de Partida no Cambien; los Puntos
+                   de la Variante (Penalizaciones y Comodines) van Aparte en score
+    */
+
+    /// Revelar y Comparar (la Penalización Mira lo Visto antes de este Movimiento)
+    bool known = Rules::PenaltyPolicy::points != 0 && (game.tracker.pendingSeen || game.tracker.letterAt[second] >= 0);
+    trackReveal(game.tracker, second, game.cards[second]);
+    bool isMatch = game.cards[first] == game.cards[second];
+    trackResolve(game.tracker, first, second, isMatch);
+    game.moves++;
+
+    /// Puntos
+    if (isMatch){
+
+        game.points[game.turn]++;
+        score[game.turn] += 1 + (Rules::JokerPolicy::bonus != 0 && game.cards[first] == JOKER_LETTER ? Rules::JokerPolicy::bonus : 0);
+
+    }
+    else{
+
+        game.errors++;
+        if (known) score[game.turn] -= Rules::PenaltyPolicy::points;
+
+    }
+
+    /// Turno: Pasa al Fallar, y al Acertar si la Variante lo Pide o se Agotó el Límite (salvo al Terminar)
+    streak++;
+    bool pass = !isMatch || !Rules::TurnPolicy::keepsTurn || (Rules::LimitPolicy::moves > 0 && streak >= Rules::LimitPolicy::moves);
+    if (pass && (!isMatch || game.points[0] + game.points[1] < PAIR_COUNT)){
+
+        game.turn ^= 1;
+        game.turns++;
+        streak = 0;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Simula una Partida con un Conjunto de Reglas.
+ * @param seed (uint64_t): La Semilla de la Partida.
+ * @param players (const Strategy*[2]): Las Estrategias de cada Jugador.
+ * @return (GameResult) El Resultado (Puntos según la Variante).
+ */
+template <class Rules>
+GameResult simulateRuled(uint64_t seed, const Strategy* const players[2]){
+
+    /// Partida Reproducible a partir de la Semilla (mismo Reparto y Azar que simulateGame)
+    auto start = std::chrono::steady_clock::now();
+    std::mt19937_64 rng(seed);
+    SimGame game;
+    dealCards(game, rng);
+    int score[2] = {0, 0}, streak = 0;
+    while (game.points[0] + game.points[1] < PAIR_COUNT){
+
+        const Strategy* player = players[game.turn];                         // Estrategia en Turno
+        int first = player->pickFirst(game, rng);                            // Primera Carta
+        revealFirst(game, first);                                            // Revelar Primera Carta
+        finishRuledMove<Rules>(game, first, player->pickSecond(game, first, rng), score, streak);
+
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    /// Resultado
+    GameResult result;
+    result.seed = seed;
+    result.firstPlayer = game.firstPlayer;
+    result.moves = game.moves;
+    result.errors = game.errors;
+    result.turns = game.turns;
+    result.points[0] = score[0];
+    result.points[1] = score[1];
+    result.micros = chrono::duration<double, std::micro>(end - start).count();
+    return result;
+
+}
+
+/// Registro de Variantes (la Primera es la Regla de mainLoop)
+const RuleVariant RULE_VARIANTS[] = {
+
+    {"clasica", "Pareja conserva el turno", simulateRuled<ClassicRules>, ClassicRules::marginReach},
+    {"pasa-turno", "Cada movimiento pasa el turno", simulateRuled<PassTurnRules>, PassTurnRules::marginReach},
+    {"penalizada", "Fallar con una carta ya vista resta 1", simulateRuled<PenaltyRules>, PenaltyRules::marginReach},
+    {"comodines", "El par comodin vale 3 puntos", simulateRuled<JokerRules>, JokerRules::marginReach},
+    {"limite", "Maximo 3 movimientos por turno", simulateRuled<LimitRules>, LimitRules::marginReach}
+
+};
+const int RULE_VARIANT_COUNT = sizeof(RULE_VARIANTS) / sizeof(RULE_VARIANTS[0]);
+
+
+
+
+/**
+ * @brief Función que Busca una Variante de Reglas por Nombre.
+ * @param name (std::string): El Nombre de la Variante.
+ * @return (int) El Índice de la Variante.
+ * @throw std::invalid_argument Si la Variante no Existe.
+ */
+int findRuleVariant(const std::string& name){
+
+    /// Buscar en el Registro
+    for (int i = 0; i < RULE_VARIANT_COUNT; i++) if (name == RULE_VARIANTS[i].name) return i;
+    throw std::invalid_argument("Variante de Reglas Desconocida: " + name);
+
+}
+
+
+
+
+/**
+ * @brief Función que Devuelve el Margen que Cubre una Variante (Geometría de su Histograma de Margen).
+ * @param rules (int): El Índice de la Variante.
+ * @return (int) El Margen Máximo en Valor Absoluto (los Márgenes Mayores se Cuentan Fuera del Histograma).
+ */
+int marginReach(int rules){
+
+    /// Peor Margen de la Variante, o el Tope de las Cubetas de 1 Punto si no lo Tiene
+    return RULE_VARIANTS[rules].marginReach;
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Exportación Columnar --------------------------------------------------------
+
+/// Estructura: Archivo Proyectado en Memoria (Multiplataforma)
+struct MappedFile {
+
+    void* data = nullptr;                        // Inicio de la Proyección
+    size_t size = 0;                             // Tamaño en Bytes
+    #ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;      // Handle del Archivo
+        HANDLE mapping = nullptr;                // Handle de la Proyección
+    #else
+        int descriptor = -1;                     // Descriptor del Archivo
+    #endif
+
+};
+
+
+
+
+/// Estructura: Descripción de una Columna de Resultados
+struct ColumnSpec {
+
+    const char* name;                            // Nombre de la Columna (y de su Archivo)
+    uint32_t width;                              // Ancho Fijo en Bytes
+    int32_t bias;                                // Desplazamiento Sumado al Guardar (Valores con Signo)
+
+};
+
+
+
+
+/// Índices de las Columnas de Resultados
+enum ResultColumn {
+
+    COLUMN_SEED,                                 // Semilla de la Partida
+    COLUMN_STRATEGY1,                            // Estrategia del Jugador 1 (Diccionario)
+    COLUMN_STRATEGY2,                            // Estrategia del Jugador 2 (Diccionario)
+    COLUMN_FIRST_PLAYER,                         // Jugador que Abrió la Partida
+    COLUMN_MOVES,                                // Movimientos
+    COLUMN_ERRORS,                               // Errores
+    COLUMN_TURNS,                                // Turnos
+    COLUMN_POINTS1,                              // Puntos del Jugador 1
+    COLUMN_POINTS2,                              // Puntos del Jugador 2
+    RESULT_COLUMN_COUNT                          // Número de Columnas
+
+};
+
+
+
+
+/// Esquema de las Columnas de Resultados
+const ColumnSpec RESULT_COLUMNS[RESULT_COLUMN_COUNT] = {
+
+    {"seed", 8, 0},
+    {"strategy1", 1, 0},
+    {"strategy2", 1, 0},
+    {"first_player", 1, 0},
+    {"moves", 2, 0},
+    {"errors", 2, 0},
+    {"turns", 2, 0},
+    {"points1", 2, 32768},                       // Las Variantes con Penalización dan Puntos Negativos
+    {"points2", 2, 32768}
+
+};
+
+
+
+
+/// Estructura: Encabezado del Esquema Columnar (schema.bin)
+struct ColumnarHeader {
+
+    char magic[8];                               // Firma "MEMCOL01"
+    uint32_t version;                            // Versión del Formato
+    uint32_t columnCount;                        // Número de Columnas
+    uint64_t rows;                               // Número de Filas
+
+};
+
+
+
+
+/// Estructura: Entrada del Esquema por Columna
+struct ColumnarEntry {
+
+    char name[16];                               // Nombre de la Columna
+    uint32_t width;                              // Ancho en Bytes
+    int32_t bias;                                // Desplazamiento de los Valores Guardados
+
+};
+
+
+
+
+/// Estructura: Conjunto de Columnas Proyectadas
+struct ResultColumns {
+
+    MappedFile files[RESULT_COLUMN_COUNT];       // Un Archivo por Columna
+    uint64_t rows = 0;                           // Número de Filas
+
+};
+
+
+
+
+/**
+ * @brief Función para Liberar una Proyección de Archivo.
+ * @param mapped (MappedFile): La Proyección a Liberar.
+ */
+void unmapFile(MappedFile& mapped){
+
+    /// Liberar Proyección y Cerrar Archivo
+    #ifdef _WIN32
+        if (mapped.data) UnmapViewOfFile(mapped.data);
+        if (mapped.mapping) CloseHandle(mapped.mapping);
+        if (mapped.file != INVALID_HANDLE_VALUE) CloseHandle(mapped.file);
+        mapped.mapping = nullptr;
+        mapped.file = INVALID_HANDLE_VALUE;
+    #else
+        if (mapped.data) munmap(mapped.data, mapped.size);
+        if (mapped.descriptor >= 0) close(mapped.descriptor);
+        mapped.descriptor = -1;
+    #endif
+    mapped.data = nullptr;
+    mapped.size = 0;
+
+}
+
+
+
+
+/**
+ * @brief Función para Proyectar un Archivo en Memoria.
+ * @param mapped (MappedFile): La Proyección Resultante.
+ * @param path (std::string): La Ruta del Archivo.
+ * @param size (size_t): Tamaño del Archivo en Escritura (Conserva el Contenido Existente), se Ignora en Lectura.
+ * @param writable (bool): Indica si el Archivo se Crea para Escritura.
+ * @throw std::runtime_error Si el Archivo no se puede Abrir o Proyectar.
+ */
+void mapFile(MappedFile& mapped, const std::string& path, size_t size, bool writable){
+
+    /*
+       - Función: Proyectar Archivo
+       - Argumentos:
+            - mapped (MappedFile): Proyección Resultante
+            - path (std::string): Ruta del Archivo
+            - size (size_t): Tamaño a Crear en Escritura
+            - writable (bool): Crear para Escritura
+       - Retorno: Ninguno
+       - Objetivo: Acceder al Archivo sin Copias (mmap / MapViewOfFile); si un Paso Falla se Cierra lo
+                   ya Abierto antes de Lanzar, así que un Error no Deja Descriptores ni Handles Abiertos
+    */
+
+    /// Error: Liberar lo Abierto hasta Ahora y Lanzar
+    auto fail = [&](const char* what){
+
+        unmapFile(mapped);
+        throw std::runtime_error(what + path);
+
+    };
+
+    /// Proyectar Archivo
+    #ifdef _WIN32                                                                           // Windows
+
+        mapped.file = CreateFileA(path.c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mapped.file == INVALID_HANDLE_VALUE) fail("No se pudo Abrir ");
+        if (writable){
+
+            LARGE_INTEGER fileSize;
+            fileSize.QuadPart = static_cast<LONGLONG>(size);
+            if (!SetFilePointerEx(mapped.file, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(mapped.file)) fail("No se pudo Reservar ");
+
+        }
+        else{
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(mapped.file, &fileSize)) fail("No se pudo Medir ");
+            size = static_cast<size_t>(fileSize.QuadPart);
+
+        }
+        mapped.size = size;
+        if (size == 0) return;                                                              // Archivo Vacío: Nada que Proyectar
+        mapped.mapping = CreateFileMappingA(mapped.file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, static_cast<DWORD>(static_cast<uint64_t>(size) >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+        if (mapped.mapping == nullptr) fail("No se pudo Proyectar ");
+        mapped.data = MapViewOfFile(mapped.mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+
+    #else                                                                                   // POSIX (Linux, macOS)
+
+        mapped.descriptor = open(path.c_str(), writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+        if (mapped.descriptor < 0) fail("No se pudo Abrir ");
+        if (writable){
+
+            if (ftruncate(mapped.descriptor, static_cast<off_t>(size)) != 0) fail("No se pudo Reservar ");
+
+        }
+        else{
+
+            struct stat fileStat;
+            if (fstat(mapped.descriptor, &fileStat) != 0) fail("No se pudo Medir ");
+            size = static_cast<size_t>(fileStat.st_size);
+
+        }
+        mapped.size = size;
+        if (size == 0) return;                                                              // Archivo Vacío: Nada que Proyectar
+        void* data = mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, mapped.descriptor, 0);
+        if (data != MAP_FAILED) mapped.data = data;
+
+    #endif
+
+    if (mapped.data == nullptr) fail("No se pudo Proyectar ");
+
+}
+
+
+
+
+/**
+ * @brief Función para Forzar a Disco las Páginas Modificadas de una Proyección.
+ * @param mapped (MappedFile): La Proyección a Sincronizar.
+ */
+void flushMappedFile(MappedFile& mapped){
+
+    /// Sincronizar Páginas Modificadas
+    if (mapped.data == nullptr) return;
+    #ifdef _WIN32
+        FlushViewOfFile(mapped.data, mapped.size);
+        FlushFileBuffers(mapped.file);
+    #else
+        msync(mapped.data, mapped.size, MS_SYNC);
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función para Cerrar todas las Columnas.
+ * @param table (ResultColumns): Las Columnas a Cerrar.
+ */
+void closeResultColumns(ResultColumns& table){
+
+    /// Liberar cada Proyección
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++) unmapFile(table.files[c]);
+
+}
+
+
+
+
+/**
+ * @brief Función para Crear los Archivos Columnares de una Exportación.
+ * @param table (ResultColumns): Las Columnas a Crear.
+ * @param directory (std::string): El Directorio de Salida.
+ * @param rows (uint64_t): Número de Filas a Reservar.
+ * @throw std::runtime_error Si algún Archivo no se puede Crear.
+ */
+void createResultColumns(ResultColumns& table, const std::string& directory, uint64_t rows){
+
+    /*
+       - Función: Crear Columnas
+       - Argumentos:
+            - table (ResultColumns): Columnas a Crear
+            - directory (std::string): Directorio de Salida
+            - rows (uint64_t): Filas a Reservar
+       - Retorno: Ninguno
+       - Objetivo: Escribir Esquema y Diccionario, y Reservar un Archivo de Ancho Fijo por Columna
+    */
+
+    /// Directorio de Salida
+    std::filesystem::create_directories(directory);
+    table.rows = rows;
+
+    /// Encabezado del Esquema
+    std::ofstream schema(directory + "/schema.bin", std::ios::binary);
+    ColumnarHeader header = {{'M', 'E', 'M', 'C', 'O', 'L', '0', '1'}, 1, RESULT_COLUMN_COUNT, rows};
+    schema.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++){
+
+        ColumnarEntry entry = {};
+        std::strncpy(entry.name, RESULT_COLUMNS[c].name, sizeof(entry.name) - 1);
+        entry.width = RESULT_COLUMNS[c].width;
+        entry.bias = RESULT_COLUMNS[c].bias;
+        schema.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+
+    }
+    if (!schema) throw std::runtime_error("No se pudo Escribir " + directory + "/schema.bin");
+
+    /// Diccionario de Estrategias (Índice = Código en las Columnas)
+    std::ofstream dictionary(directory + "/strategies.dict");
+    for (int i = 0; i < STRATEGY_COUNT; i++) dictionary << STRATEGIES[i].name << "\n";
+
+    /// Un Archivo Proyectado por Columna (si una Falla se Liberan las ya Proyectadas)
+    try {
+
+        for (int c = 0; c < RESULT_COLUMN_COUNT; c++){
+
+            mapFile(table.files[c], directory + "/" + RESULT_COLUMNS[c].name + ".col", rows * RESULT_COLUMNS[c].width, true);
+
+        }
+
+    }
+    catch (...){
+
+        closeResultColumns(table);
+        throw;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función para Abrir una Exportación Columnar sin Copias.
+ * @param table (ResultColumns): Las Columnas Proyectadas.
+ * @param directory (std::string): El Directorio de la Exportación.
+ * @param strategyNames (std::vector<std::string>): Diccionario de Estrategias Leído.
+ * @throw std::runtime_error Si el Esquema no Coincide con los Archivos.
+ */
+void openResultColumns(ResultColumns& table, const std::string& directory, std::vector<std::string>& strategyNames){
+
+    /*
+       - Función: Abrir Columnas
+       - Argumentos:
+            - table (ResultColumns): Columnas Proyectadas
+            - directory (std::string): Directorio de la Exportación
+            - strategyNames (std::vector<std::string>): Diccionario de Estrategias
+       - Retorno: Ninguno
+       - Objetivo: Validar el Esquema y Proyectar cada Columna en Solo Lectura
+    */
+
+    /// Validar Encabezado
+    std::ifstream schema(directory + "/schema.bin", std::ios::binary);
+    ColumnarHeader header;
+    if (!schema.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "MEMCOL01", 8) != 0 || header.columnCount != RESULT_COLUMN_COUNT){
+
+        throw std::runtime_error("Esquema Invalido en " + directory);
+
+    }
+    table.rows = header.rows;
+
+    /// Proyectar cada Columna y Verificar su Tamaño (si una Falla se Liberan las ya Proyectadas)
+    try {
+
+        for (int c = 0; c < RESULT_COLUMN_COUNT; c++){
+
+            ColumnarEntry entry;
+            schema.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+            if (!schema || std::strncmp(entry.name, RESULT_COLUMNS[c].name, sizeof(entry.name)) != 0 || entry.width != RESULT_COLUMNS[c].width || entry.bias != RESULT_COLUMNS[c].bias){
+
+                throw std::runtime_error("Columna Inesperada en el Esquema: " + std::string(RESULT_COLUMNS[c].name));
+
+            }
+            mapFile(table.files[c], directory + "/" + RESULT_COLUMNS[c].name + ".col", 0, false);
+            if (table.files[c].size != table.rows * entry.width) throw std::runtime_error("Columna Truncada: " + std::string(entry.name));
+
+        }
+
+    }
+    catch (...){
+
+        closeResultColumns(table);
+        throw;
+
+    }
+
+    /// Leer Diccionario
+    std::ifstream dictionary(directory + "/strategies.dict");
+    std::string name;
+    while (std::getline(dictionary, name)) strategyNames.push_back(name);
+
+}
+
+
+
+
+/**
+ * @brief Función para Forzar a Disco todas las Columnas.
+ * @param table (ResultColumns): Las Columnas a Sincronizar.
+ */
+void flushResultColumns(ResultColumns& table){
+
+    /// Sincronizar cada Proyección
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++) flushMappedFile(table.files[c]);
+
+}
+
+
+
+
+/**
+ * @brief Función para Escribir una Fila de Resultados Directamente en las Columnas.
+ * @param table (ResultColumns): Las Columnas Proyectadas.
+ * @param row (uint64_t): El Índice de la Fila.
+ * @param result (GameResult): El Resultado de la Partida.
+ * @param strategy1 (uint8_t): Código de la Estrategia del Jugador 1.
+ * @param strategy2 (uint8_t): Código de la Estrategia del Jugador 2.
+ */
+void writeResultRow(ResultColumns& table, uint64_t row, const GameResult& result, uint8_t strategy1, uint8_t strategy2){
+
+    /// Valores de la Fila en el Orden del Esquema
+    uint64_t values[RESULT_COLUMN_COUNT] = {
+
+        result.seed,
+        strategy1,
+        strategy2,
+        static_cast<uint64_t>(result.firstPlayer),
+        static_cast<uint64_t>(result.moves),
+        static_cast<uint64_t>(result.errors),
+        static_cast<uint64_t>(result.turns),
+        static_cast<uint64_t>(result.points[0] + RESULT_COLUMNS[COLUMN_POINTS1].bias),
+        static_cast<uint64_t>(result.points[1] + RESULT_COLUMNS[COLUMN_POINTS2].bias)
+
+    };
+
+    /// Copiar los Bytes Bajos de cada Valor (Little Endian)
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++){
+
+        std::memcpy(static_cast<char*>(table.files[c].data) + row * RESULT_COLUMNS[c].width, &values[c], RESULT_COLUMNS[c].width);
+
+    }
+
+}
+
+
+
+
+/// Operadores de Comparación para Filtros
+enum CompareOperator {OP_LESS, OP_LESS_EQUAL, OP_GREATER, OP_GREATER_EQUAL, OP_EQUAL, OP_NOT_EQUAL};
+
+
+
+
+/// Estructura: Predicado "columna operador valor"
+struct ColumnPredicate {
+
+    int column;                                  // Índice de la Columna
+    CompareOperator op;                          // Operador
+    uint64_t value;                              // Valor de Comparación (Guardado, con el Desplazamiento de la Columna)
+    int saturated;                               // -1 Bajo el Rango de la Columna, 1 Sobre el Rango, 0 Cabe
+
+};
+
+
+
+
+/**
+ * @brief Función que Evalúa un Predicado sobre un Bloque de una Columna.
+ * @param column (const T*): Los Valores del Bloque.
+ * @param count (size_t): Número de Valores.
+ * @param op (CompareOperator): El Operador.
+ * @param value (T): El Valor de Comparación.
+ * @param mask (uint8_t*): La Máscara de Selección (se Combina con AND).
+ */
+template <typename T>
+void evaluatePredicate(const T* column, size_t count, CompareOperator op, T value, uint8_t* mask){
+
+    /*
+       - Función: Evaluar Predicado
+       - Argumentos:
+            - column (const T*): Valores del Bloque
+            - count (size_t): Número de Valores
+            - op (CompareOperator): Operador
+            - value (T): Valor de Comparación
+            - mask (uint8_t*): Máscara de Selección
+       - Retorno: Ninguno
+       - Objetivo: Bucles sin Saltos por Operador para que el Compilador los Vectorice (SIMD)
+    */
+
+    /// Un Bucle Plano por Operador (el Salto queda Fuera del Bucle)
+    switch (op){
+
+        case OP_LESS:          for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] < value);  break;
+        case OP_LESS_EQUAL:    for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] <= value); break;
+        case OP_GREATER:       for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] > value);  break;
+        case OP_GREATER_EQUAL: for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] >= value); break;
+        case OP_EQUAL:         for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] == value); break;
+        case OP_NOT_EQUAL:     for (size_t i = 0; i < count; i++) mask[i] &= static_cast<uint8_t>(column[i] != value); break;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Lee un Valor de Cualquier Columna.
+ * @param table (ResultColumns): Las Columnas Proyectadas.
+ * @param column (int): El Índice de la Columna.
+ * @param row (uint64_t): El Índice de la Fila.
+ * @return (uint64_t) El Valor Leído (Guardado, con el Desplazamiento de la Columna).
+ */
+inline uint64_t readColumnValue(const ResultColumns& table, int column, uint64_t row){
+
+    /// Copiar los Bytes de la Celda
+    uint64_t value = 0;
+    std::memcpy(&value, static_cast<const char*>(table.files[column].data) + row * RESULT_COLUMNS[column].width, RESULT_COLUMNS[column].width);
+    return value;
+
+}
+
+
+
+
+/**
+ * @brief Función que Busca una Columna por Nombre.
+ * @param name (std::string): El Nombre de la Columna.
+ * @return (int) El Índice de la Columna.
+ * @throw std::invalid_argument Si la Columna no Existe.
+ */
+int findColumn(const std::string& name){
+
+    /// Buscar en el Esquema
+    for (int c = 0; c < RESULT_COLUMN_COUNT; c++) if (name == RESULT_COLUMNS[c].name) return c;
+    throw std::invalid_argument("Columna Desconocida: " + name);
+
+}
+
+
+
+
+/**
+ * @brief Función que Interpreta una Lista de Predicados ("moves>30,first_player==0").
+ * @param text (std::string): El Texto del Filtro.
+ * @param strategyNames (std::vector<std::string>): Diccionario para Valores de Estrategia.
+ * @return (std::vector<ColumnPredicate>) Los Predicados (Conjunción).
+ * @throw std::invalid_argument Si algún Predicado es Inválido.
+ */
+std::vector<ColumnPredicate> parsePredicates(const std::string& text, const std::vector<std::string>& strategyNames){
+
+    /// Operadores Reconocidos (los de Dos Caracteres Primero)
+    const char* symbols[] = {"<=", ">=", "==", "!=", "<", ">"};
+    const CompareOperator operators[] = {OP_LESS_EQUAL, OP_GREATER_EQUAL, OP_EQUAL, OP_NOT_EQUAL, OP_LESS, OP_GREATER};
+
+    /// Separar por Comas
+    std::vector<ColumnPredicate> predicates;
+    size_t start = 0;
+    while (start < text.size()){
+
+        size_t end = text.find(',', start);
+        std::string term = text.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        start = end == std::string::npos ? text.size() : end + 1;
+
+        /// Ubicar el Operador
+        size_t at = std::string::npos;
+        int which = -1;
+        for (int k = 0; k < 6 && which < 0; k++){
+
+            at = term.find(symbols[k]);
+            if (at != std::string::npos) which = k;
+
+        }
+        if (which < 0) throw std::invalid_argument("Filtro Invalido: " + term);
+
+        /// Columna y Valor (los Nombres de Estrategia se Codifican con el Diccionario)
+        ColumnPredicate predicate;
+        predicate.column = findColumn(term.substr(0, at));
+        predicate.op = operators[which];
+        std::string value = term.substr(at + std::strlen(symbols[which]));
+        auto named = std::find(strategyNames.begin(), strategyNames.end(), value);
+        predicate.saturated = 0;
+        if ((predicate.column == COLUMN_STRATEGY1 || predicate.column == COLUMN_STRATEGY2) && named != strategyNames.end()) predicate.value = named - strategyNames.begin();
+        else if (RESULT_COLUMNS[predicate.column].width == 8){
+
+            predicate.value = std::stoull(value);
+            if (value.find('-') != std::string::npos) predicate.saturated = -1;   // stoull Acepta Negativos Envolviéndolos
+
+        }
+        else{
+
+            /// Columnas Angostas: un Valor que no Cabe no se Trunca, Satura la Comparación
+            long long stored = std::stoll(value) + RESULT_COLUMNS[predicate.column].bias;
+            long long top = (1LL << (8 * RESULT_COLUMNS[predicate.column].width)) - 1;
+            predicate.saturated = stored < 0 ? -1 : stored > top ? 1 : 0;
+            predicate.value = static_cast<uint64_t>(std::min(std::max(stored, 0LL), top));
+
+        }
+        predicates.push_back(predicate);
+
+    }
+    return predicates;
+
+}
+
+
+
+
+/**
+ * @brief Función que Aplica un Predicado a un Bloque de Filas según el Ancho de la Columna.
+ * @param table (ResultColumns): Las Columnas Proyectadas.
+ * @param predicate (ColumnPredicate): El Predicado.
+ * @param begin (uint64_t): Primera Fila del Bloque.
+ * @param count (size_t): Número de Filas.
+ * @param mask (uint8_t*): La Máscara de Selección.
+ */
+void applyPredicate(const ResultColumns& table, const ColumnPredicate& predicate, uint64_t begin, size_t count, uint8_t* mask){
+
+    /// Valor Fuera del Rango: el Resultado es el Mismo para Todas las Filas
+    if (predicate.saturated != 0){
+
+        bool below = predicate.saturated < 0;                                               // Todas las Filas Quedan por Encima del Valor
+        bool holds = predicate.op == OP_NOT_EQUAL || (below ? predicate.op == OP_GREATER || predicate.op == OP_GREATER_EQUAL : predicate.op == OP_LESS || predicate.op == OP_LESS_EQUAL);
+        if (!holds) std::fill(mask, mask + count, 0);
+        return;
+
+    }
+
+    /// Despachar al Núcleo del Tipo Correcto
+    const char* base = static_cast<const char*>(table.files[predicate.column].data);
+    switch (RESULT_COLUMNS[predicate.column].width){
+
+        case 1: evaluatePredicate(reinterpret_cast<const uint8_t*>(base) + begin, count, predicate.op, static_cast<uint8_t>(predicate.value), mask); break;
+        case 2: evaluatePredicate(reinterpret_cast<const uint16_t*>(base) + begin, count, predicate.op, static_cast<uint16_t>(predicate.value), mask); break;
+        default: evaluatePredicate(reinterpret_cast<const uint64_t*>(base) + begin, count, predicate.op, predicate.value, mask); break;
+
+    }
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Tablas de Finales en Disco --------------------------------------------------
+
+MappedFile tablebaseFile;                                                         /// Proyección del Archivo de Tablas
+std::vector<TablebaseEntry> tablebaseMemory;                                      /// Tablas Calculadas sin Archivo
+
+
+
+
+/**
+ * @brief Función que Calcula y Escribe el Archivo de Tablas.
+ * @param path (std::string): Ruta del Archivo.
+ * @throw std::runtime_error: Si el Archivo no se puede Escribir.
+ */
+void writeTablebase(const std::string& path){
+
+    /*
+       - Función: Escribir Tablas
+       - Argumentos:
+            - path (std::string): Ruta del Archivo
+       - Retorno: Ninguno
+       - Objetivo: Encabezado más Entradas en Orden de tablebaseIndex, Escritas en un Temporal Sincronizado y
+                   Renombrado: una Generación Interrumpida nunca Deja un Archivo a Medias y basta Volver a Correrla
+    */
+
+    /// Calcular
+    std::vector<TablebaseEntry> entries(TABLEBASE_ENTRIES);
+    buildTablebase(entries.data());
+    TablebaseHeader header = {{'M', 'E', 'M', 'T', 'B', '0', '0', '1'}, PAIR_COUNT, TABLEBASE_ENTRIES};
+
+    /// Escribir Temporal y Sincronizar
+    std::string temporaryPath = path + ".tmp";
+    std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+    if (file == nullptr) throw std::runtime_error("No se pudo Crear " + temporaryPath);
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(entries.data(), sizeof(TablebaseEntry), entries.size(), file) == entries.size() && std::fflush(file) == 0;
+    #ifdef _WIN32
+        written = written && FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file))));
+    #else
+        written = written && fsync(fileno(file)) == 0;
+    #endif
+    std::fclose(file);
+    if (!written) throw std::runtime_error("No se pudo Escribir " + temporaryPath);
+
+    /// Publicar
+    replaceFile(temporaryPath, path);
+
+}
+
+
+
+
+/**
+ * @brief Función que Carga las Tablas de Finales.
+ * @param path (std::string): Ruta del Archivo.
+ * @return (bool) Verdadero si se Proyectó el Archivo, Falso si se Calcularon en Memoria.
+ */
+bool openTablebase(const std::string& path){
+
+    /*
+       - Función: Cargar Tablas
+       - Argumentos:
+            - path (std::string): Ruta del Archivo
+       - Retorno: Si se Usó el Archivo
+       - Objetivo: Proyectar el Archivo (O(1), sin Leerlo) y Apuntar a sus Entradas; si no Existe o no es
+                   Válido, Calcular las Tablas en Memoria para que Bots y Pistas Siempre las Tengan
+    */
+
+    /// Proyectar y Validar el Archivo
+    std::error_code error;
+    if (std::filesystem::exists(path, error)){
+
+        try {
+
+            mapFile(tablebaseFile, path, 0, false);
+            const TablebaseHeader* header = static_cast<const TablebaseHeader*>(tablebaseFile.data);
+            if (tablebaseFile.size == sizeof(TablebaseHeader) + TABLEBASE_ENTRIES * sizeof(TablebaseEntry) && std::memcmp(header->magic, "MEMTB001", 8) == 0
+                && header->pairs == PAIR_COUNT && header->entries == TABLEBASE_ENTRIES){
+
+                tablebase = reinterpret_cast<const TablebaseEntry*>(header + 1);
+                return true;
+
+            }
+
+        }
+        catch (const std::runtime_error&) {}
+        unmapFile(tablebaseFile);
+
+    }
+
+    /// Calcular en Memoria
+    tablebaseMemory.resize(TABLEBASE_ENTRIES);
+    buildTablebase(tablebaseMemory.data());
+    tablebase = tablebaseMemory.data();
+    return false;
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Simulación en Paralelo ------------------------------------------------------
+
+/// Estructura: Trabajo de Simulación Reanudable
+struct SimulationJob {
+
+    long long games = 0;                         // Número Total de Partidas
+    uint64_t baseSeed = 0;                       // Semilla Base (Partida i usa mixSeed(baseSeed + i))
+    int strategies[2] = {0, 0};                  // Índices de Estrategia de cada Jugador
+    int rules = 0;                               // Índice de la Variante de Reglas
+    long long shardSize = 65536;                 // Partidas por Fragmento
+    long long completedShards = 0;               // Fragmentos ya Combinados (Siempre un Prefijo)
+    GameSummary summary;                         // Resumen de los Fragmentos Combinados
+
+};
+
+
+
+
+/// Estructura: Encabezado de un Punto de Control
+struct CheckpointHeader {
+
+    char magic[8];                               // Firma "MEMCHK01"
+    uint32_t version;                            // Versión del Formato (2: Histograma de Duración Logarítmico)
+    int32_t strategies[2];                       // Índices de Estrategia
+    uint32_t rules;                              // Índice de la Variante de Reglas (0 en Puntos de Control Anteriores)
+    int64_t games;                               // Número Total de Partidas
+    uint64_t baseSeed;                           // Semilla Base
+    int64_t shardSize;                           // Partidas por Fragmento
+    int64_t completedShards;                     // Fragmentos Combinados
+
+};
+
+
+
+
+/**
+ * @brief Función para Escribir un Punto de Control (Escribir y luego Renombrar).
+ * @param job (SimulationJob): El Trabajo a Guardar.
+ * @param path (std::string): La Ruta del Punto de Control.
+ * @throw std::runtime_error Si no se puede Escribir.
+ */
+void writeCheckpoint(const SimulationJob& job, const std::string& path){
+
+    /*
+       - Función: Escribir Punto de Control
+       - Argumentos:
+            - job (SimulationJob): Trabajo a Guardar
+            - path (std::string): Ruta del Punto de Control
+       - Retorno: Ninguno
+       - Objetivo: Guardar el Avance en un Temporal Sincronizado a Disco y Renombrarlo, para que
+                   un Corte a Mitad de Escritura Deje Intacto el Punto de Control Anterior
+    */
+
+    /// Encabezado
+    CheckpointHeader header = {{'M', 'E', 'M', 'C', 'H', 'K', '0', '1'}, 2, {job.strategies[0], job.strategies[1]}, static_cast<uint32_t>(job.rules), job.games, job.baseSeed, job.shardSize, job.completedShards};
+
+    /// Escribir Temporal y Sincronizar
+    std::string temporaryPath = path + ".tmp";
+    std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+    if (file == nullptr) throw std::runtime_error("No se pudo Crear " + temporaryPath);
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(&job.summary, sizeof(job.summary), 1, file) == 1 && std::fflush(file) == 0;
+    #ifdef _WIN32
+        written = written && FlushFileBuffers(reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file))));
+    #else
+        written = written && fsync(fileno(file)) == 0;
+    #endif
+    std::fclose(file);
+    if (!written) throw std::runtime_error("No se pudo Escribir " + temporaryPath);
+
+    /// Publicar
+    replaceFile(temporaryPath, path);
+
+}
+
+
+
+
+/**
+ * @brief Función para Leer un Punto de Control.
+ * @param job (SimulationJob): El Trabajo Restaurado.
+ * @param path (std::string): La Ruta del Punto de Control.
+ * @throw std::runtime_error Si el Archivo no es un Punto de Control Válido.
+ */
+void readCheckpoint(SimulationJob& job, const std::string& path){
+
+    /// Leer Encabezado y Resumen
+    std::ifstream file(path, std::ios::binary);
+    CheckpointHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "MEMCHK01", 8) != 0 || header.version != 2){
+
+        throw std::runtime_error("Punto de Control Invalido: " + path);
+
+    }
+    if (!file.read(reinterpret_cast<char*>(&job.summary), sizeof(job.summary))) throw std::runtime_error("Punto de Control Truncado: " + path);
+
+    /// Validar y Restaurar Parámetros
+    if (header.strategies[0] < 0 || header.strategies[0] >= STRATEGY_COUNT || header.strategies[1] < 0 || header.strategies[1] >= STRATEGY_COUNT || header.rules >= static_cast<uint32_t>(RULE_VARIANT_COUNT) || header.shardSize < 1){
+
+        throw std::runtime_error("Punto de Control Corrupto: " + path);
+
+    }
+    job.games = header.games;
+    job.baseSeed = header.baseSeed;
+    job.strategies[0] = header.strategies[0];
+    job.strategies[1] = header.strategies[1];
+    job.rules = static_cast<int>(header.rules);
+    job.shardSize = header.shardSize;
+    job.completedShards = header.completedShards;
+
+    /// El Resumen Guardado debe Tener la Geometría de su Variante para Combinarse con los Nuevos
+    GameSummary expected;
+    initSummary(expected, marginReach(job.rules));
+    if (!sameGeometry(job.summary.margin.histogram, expected.margin.histogram) || !sameGeometry(job.summary.duration.histogram, expected.duration.histogram)){
+
+        throw std::runtime_error("Punto de Control de otra Version: " + path);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Simula un Trabajo en Paralelo con Puntos de Control Periódicos.
+ * @param job (SimulationJob): El Trabajo (se Reanuda desde job.completedShards).
+ * @param threads (int): Número de Hilos.
+ * @param exportColumns (ResultColumns*): Columnas donde se Escribe cada Partida (nullptr para no Exportar).
+ * @param checkpointPath (std::string): Ruta del Punto de Control (Vacía para no Guardar).
+ * @param checkpointSeconds (int): Segundos entre Puntos de Control.
+ */
+void runSimulation(SimulationJob& job, int threads, ResultColumns* exportColumns, const std::string& checkpointPath, int checkpointSeconds){
+
+    /*
+       - Función: Ejecutar Simulación
+       - Argumentos:
+            - job (SimulationJob): Trabajo a Ejecutar
+            - threads (int): Número de Hilos
+            - exportColumns (ResultColumns*): Columnas de Exportación (Opcional)
+            - checkpointPath (std::string): Ruta del Punto de Control (Opcional)
+            - checkpointSeconds (int): Segundos entre Puntos de Control
+       - Retorno: Ninguno
+       - Objetivo: Los Hilos Toman Fragmentos de un Contador Atómico; el Hilo Principal Combina
+                   los Resúmenes en Orden de Fragmento, así el Resultado no Depende del Número
+                   de Hilos ni de las Interrupciones
+    */
+
+    /// Estrategias, Motor de la Variante y Fragmentos
+    const Strategy* players[2] = {&STRATEGIES[job.strategies[0]], &STRATEGIES[job.strategies[1]]};
+    GameResult (*simulate)(uint64_t, const Strategy* const[2]) = RULE_VARIANTS[job.rules].simulate;
+    uint8_t strategy1 = static_cast<uint8_t>(job.strategies[0]);
+    uint8_t strategy2 = static_cast<uint8_t>(job.strategies[1]);
+    long long shardCount = (job.games + job.shardSize - 1) / job.shardSize;
+
+    /// Fragmentos Terminados en Espera de ser Combinados
+    std::atomic<long long> nextShard(job.completedShards);
+    std::mutex pendingMutex;
+    std::condition_variable pendingReady;
+    std::map<long long, GameSummary> pending;
+    std::atomic<bool> stopping(false);                                       // Fallo del Hilo Principal: no Tomar más Fragmentos
+
+    /// Hilos de Simulación
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++){
+
+        workers.emplace_back([&, players, simulate, strategy1, strategy2](){
+
+            for (long long shard = nextShard++; shard < shardCount && !stopping; shard = nextShard++){
+
+                GameSummary partial;
+                initSummary(partial, marginReach(job.rules));
+                long long end = std::min(job.games, (shard + 1) * job.shardSize);
+                for (long long i = shard * job.shardSize; i < end; i++){
+
+                    GameResult result = simulate(mixSeed(job.baseSeed + i), players);
+                    addResult(partial, result);
+                    if (exportColumns) writeResultRow(*exportColumns, i, result, strategy1, strategy2);
+
+                }
+                std::lock_guard<std::mutex> lock(pendingMutex);
+                pending.emplace(shard, partial);
+                pendingReady.notify_one();
+
+            }
+
+        });
+
+    }
+
+    /// Combinar en Orden y Guardar Puntos de Control
+    auto lastCheckpoint = std::chrono::steady_clock::now();
+    try {
+
+        while (job.completedShards < shardCount){
+
+            {
+                std::unique_lock<std::mutex> lock(pendingMutex);
+                pendingReady.wait_for(lock, seconds(1), [&](){return pending.count(job.completedShards) > 0;});
+                for (auto next = pending.find(job.completedShards); next != pending.end(); next = pending.find(job.completedShards)){
+
+                    mergeSummary(job.summary, next->second);
+                    pending.erase(next);
+                    job.completedShards++;
+
+                }
+            }
+            if (!checkpointPath.empty() && std::chrono::steady_clock::now() - lastCheckpoint >= seconds(checkpointSeconds)){
+
+                if (exportColumns) flushResultColumns(*exportColumns);          // Filas Combinadas en Disco antes de Anunciarlas
+                writeCheckpoint(job, checkpointPath);
+                lastCheckpoint = std::chrono::steady_clock::now();
+
+            }
+
+        }
+
+    }
+    catch (...){
+
+        /// Un Hilo Unible Destruido Termina el Proceso: Detener y Esperar a los Hilos antes de Propagar el Error
+        stopping = true;
+        for (std::thread& worker : workers) worker.join();
+        throw;
+
+    }
+
+    /// Esperar Hilos y Guardar el Punto de Control Final
+    for (std::thread& worker : workers) worker.join();
+    if (exportColumns) flushResultColumns(*exportColumns);
+    if (!checkpointPath.empty()) writeCheckpoint(job, checkpointPath);
+
+}
+
+
+
+
+/**
+ * @brief Función que Conduce Muchas Partidas con Bots en un solo Hilo.
+ * @param games (long long): Partidas a Completar.
+ * @param tables (size_t): Partidas Simultáneas (Marcos en el Grupo).
+ * @param seed (uint64_t): Semilla de los Repartos y los Bots.
+ * @param steps (long long): Reanudaciones Realizadas (Salida).
+ * @param virtualMilliseconds (uint64_t): Tiempo de Juego Simulado por el Reloj (Salida).
+ */
+void driveFlows(long long games, size_t tables, uint64_t seed, long long& steps, uint64_t& virtualMilliseconds){
+
+    /*
+       - Función: Planificador de Flujos
+       - Argumentos:
+            - games (long long): Partidas a Completar
+            - tables (size_t): Partidas Simultáneas
+            - seed (uint64_t): Semilla
+            - steps (long long): Reanudaciones
+            - virtualMilliseconds (uint64_t): Tiempo Simulado
+       - Retorno: Ninguno
+       - Objetivo: Grupo Fijo de Marcos que se Reutilizan al Terminar cada Partida; las que Esperan Carta van a
+                   una Cola de Listas y las que Esperan Tiempo a un Montículo por Hora de Despertar (Reloj Virtual)
+    */
+
+    /// Grupo de Marcos, Cola de Listas y Montículo de Temporizadores
+    std::mt19937_64 rng(seed);
+    std::vector<TurnFlow> pool(tables);
+    std::vector<uint32_t> ready;
+    std::vector<std::pair<uint64_t, uint32_t>> timers;
+    ready.reserve(tables);
+    timers.reserve(tables);
+    auto later = std::greater<std::pair<uint64_t, uint32_t>>();
+    long long started = 0, finished = 0;
+    uint64_t now = 0;
+    steps = 0;
+
+    /// Arrancar una Partida en un Marco con un Reparto Nuevo
+    SimGame deal;
+    auto startGame = [&](uint32_t slot){
+
+        dealCards(deal, rng);
+        startFlow(pool[slot], deal.cards, (uint64_t(1) << CARD_COUNT) - 1, 1 + deal.firstPlayer, 0, 0, 0, 0);
+        ready.push_back(slot);
+        started++;
+
+    };
+    for (uint32_t slot = 0; slot < tables && started < games; slot++) startGame(slot);
+
+    /// Despachar: Listas Primero, luego el Temporizador más Próximo
+    while (finished < games){
+
+        uint32_t slot;
+        FlowStep step;
+        if (!ready.empty()){
+
+            /// Bot: una Carta Boca Abajo al Azar, y a veces Cualquiera (Ejercita los Rechazos)
+            slot = ready.back();
+            ready.pop_back();
+            TurnFlow& flow = pool[slot];
+            uint64_t bits = rng();
+            int position;
+            if ((bits & 15) == 0) position = static_cast<int>((bits >> 4) % 42);         // Incluye Fila 6 fuera de Rango
+            else {
+
+                int candidates[CARD_COUNT], count = 0;
+                for (int k = 0; k < CARD_COUNT; k++) if ((flow.guard.hidden >> k) & 1) candidates[count++] = k;
+                position = candidates[(bits >> 4) % count];
+
+            }
+            step = flowPick(flow, position / 6, position % 6);
+
+        }
+        else {
+
+            std::pop_heap(timers.begin(), timers.end(), later);
+            now = timers.back().first;
+            slot = timers.back().second;
+            timers.pop_back();
+            step = flowTimer(pool[slot]);
+
+        }
+        steps++;
+
+        /// Encolar según lo que Espera Ahora
+        if (step.await == AWAIT_PICK) ready.push_back(slot);
+        else if (step.await == AWAIT_TIMER){
+
+            timers.push_back({now + step.milliseconds, slot});
+            std::push_heap(timers.begin(), timers.end(), later);
+
+        }
+        else {
+
+            finished++;
+            if (started < games) startGame(slot);
+
+        }
+
+    }
+    virtualMilliseconds = now;
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Simulación Distribuida ------------------------------------------------------
+
+const uint32_t WORK_MAGIC = 0x4B524F57;                                           /// Firma "WORK" de cada Mensaje
+
+/// Tipos de Mensaje entre Coordinador y Trabajadores
+enum WorkMessage : uint32_t {
+
+    WORK_REQUEST = 1,                            // Trabajador: Pide una Unidad
+    WORK_LEASE = 2,                              // Coordinador: Presta una Unidad
+    WORK_WAIT = 3,                               // Coordinador: Todo Prestado, Volver a Pedir más Tarde
+    WORK_DONE = 4,                               // Coordinador: no Queda Trabajo
+    WORK_RESULT = 5                              // Trabajador: Resultado de la Unidad (le Sigue un GameSummary)
+
+};
+
+/// Estructura: Unidad de Trabajo (Rango de Semillas de un Enfrentamiento)
+struct WorkUnit {
+
+    int64_t id;                                  // Índice de la Unidad (Orden de Combinación)
+    int32_t matchup;                             // Enfrentamiento al que Pertenece
+    int32_t strategies[2];                       // Índices de Estrategia
+    int32_t rules;                               // Índice de la Variante de Reglas
+    int32_t playouts;                            // Simulaciones de busqueda por Decisión
+    int32_t budgetMilliseconds;                  // Tiempo de busqueda por Decisión
+    uint64_t baseSeed;                           // Semilla Base (Partida i usa mixSeed(baseSeed + i))
+    int64_t first;                               // Primera Partida de la Unidad
+    int64_t count;                               // Partidas de la Unidad
+
+};
+
+/// Estructura: Encabezado de un Mensaje (Tamaño Fijo; el Resultado Agrega el Resumen en Crudo)
+struct WorkHeader {
+
+    uint32_t magic;                              // WORK_MAGIC
+    uint32_t type;                               // WorkMessage
+    WorkUnit unit;                               // Unidad Prestada o Respondida
+
+};
+
+/// Estructura: Trabajo Distribuido
+struct DistributedJob {
+
+    long long games = 0;                         // Partidas por Enfrentamiento
+    uint64_t baseSeed = 0;                       // Semilla Base
+    long long unitSize = 65536;                  // Partidas por Unidad (como --shard-size)
+    int rules = 0;                               // Índice de la Variante de Reglas
+    int leaseSeconds = 30;                       // Segundos antes de Reasignar una Unidad sin Respuesta
+    std::vector<std::array<int, 2>> matchups;    // Pares de Estrategias
+    std::vector<GameSummary> summaries;          // Resumen Combinado de cada Enfrentamiento
+    long long releases = 0;                      // Unidades Reasignadas (Caída o Vencimiento)
+    long long duplicates = 0;                    // Resultados Repetidos Descartados
+    long long workers = 0;                       // Conexiones de Trabajadores Aceptadas
+
+};
+
+/// Estructura: Trabajador Conectado al Coordinador
+struct WorkerLink {
+
+    int descriptor = -1;                         // Socket del Trabajador
+    std::string inbox;                           // Bytes Recibidos sin Procesar
+    int64_t leased = -1;                         // Unidad Prestada (-1 si Ninguna)
+
+};
+
+
+
+
+#ifndef _WIN32
+
+/**
+ * @brief Función que Lee Exactamente una Cantidad de Bytes de un Socket.
+ * @param descriptor (int): El Socket.
+ * @param out (uint8_t*): Destino.
+ * @param size (size_t): Bytes a Leer.
+ * @return (bool) Falso si la Conexión se Cerró antes.
+ */
+bool readExactly(int descriptor, uint8_t* out, size_t size){
+
+    /// Leer hasta Completar (Reintentando si una Señal Interrumpe)
+    while (size > 0){
+
+        ssize_t received = read(descriptor, out, size);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        out += received;
+        size -= static_cast<size_t>(received);
+
+    }
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Escribe Exactamente una Cantidad de Bytes en un Socket.
+ * @param descriptor (int): El Socket.
+ * @param data (const void*): Origen.
+ * @param size (size_t): Bytes a Escribir.
+ * @return (bool) Falso si la Conexión se Cerró antes.
+ */
+bool writeExactly(int descriptor, const void* data, size_t size){
+
+    /// Escribir hasta Completar (sin SIGPIPE si el otro Extremo se Fue)
+    const char* cursor = static_cast<const char*>(data);
+    while (size > 0){
+
+        ssize_t sent = send(descriptor, cursor, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) return false;
+        cursor += sent;
+        size -= static_cast<size_t>(sent);
+
+    }
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Abre una Conexión TCP.
+ * @param address (std::string): Dirección "host:puerto".
+ * @return (int) El Socket Conectado (sin Retraso de Nagle).
+ * @throw std::runtime_error Si no se puede Conectar.
+ */
+int connectTcp(const std::string& address){
+
+    /// Separar Host y Puerto
+    size_t colon = address.rfind(':');
+    if (colon == std::string::npos) throw std::invalid_argument("Direccion sin Puerto: " + address);
+    std::string host = address.substr(0, colon), port = address.substr(colon + 1);
+
+    /// Probar cada Dirección Resuelta
+    addrinfo hints{}, *found = nullptr;
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &found) != 0) throw std::runtime_error("No se pudo Resolver " + address);
+    int descriptor = -1;
+    for (addrinfo* entry = found; entry && descriptor < 0; entry = entry->ai_next){
+
+        descriptor = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+        if (descriptor >= 0 && connect(descriptor, entry->ai_addr, entry->ai_addrlen) != 0){close(descriptor); descriptor = -1;}
+
+    }
+    freeaddrinfo(found);
+    if (descriptor < 0) throw std::runtime_error("No se pudo Conectar a " + address);
+
+    /// Mensajes Cortos de Pedido y Respuesta: Enviar sin Esperar
+    int enable = 1;
+    setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    return descriptor;
+
+}
+
+
+
+
+/**
+ * @brief Función que Abre un Socket TCP de Escucha.
+ * @param host (std::string): Dirección Local (127.0.0.1 para solo este Equipo).
+ * @param port (int): Puerto (0 para uno Libre).
+ * @param boundPort (int): Puerto Asignado (Salida).
+ * @param sharePort (bool): Permitir Otros Sockets de Escucha en el mismo Puerto (SO_REUSEPORT).
+ * @return (int) El Socket de Escucha.
+ * @throw std::runtime_error Si no se puede Abrir.
+ */
+int listenTcp(const std::string& host, int port, int& boundPort, bool sharePort = false){
+
+    /// Resolver la Dirección Local
+    addrinfo hints{}, *found = nullptr;
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &found) != 0 || found == nullptr) throw std::runtime_error("No se pudo Resolver " + host);
+
+    /// Abrir, Reusar y Escuchar
+    int descriptor = socket(found->ai_family, found->ai_socktype, found->ai_protocol);
+    int enable = 1;
+    if (descriptor >= 0) setsockopt(descriptor, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    #ifdef SO_REUSEPORT
+        if (descriptor >= 0 && sharePort && setsockopt(descriptor, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0){
+
+            close(descriptor);
+            freeaddrinfo(found);
+            throw std::runtime_error("El Sistema no Permite Compartir el Puerto entre Shards");
+
+        }
+    #else
+        if (sharePort){
+
+            if (descriptor >= 0) close(descriptor);
+            freeaddrinfo(found);
+            throw std::runtime_error("El Sistema no Permite Compartir el Puerto entre Shards");
+
+        }
+    #endif
+    bool opened = descriptor >= 0 && bind(descriptor, found->ai_addr, found->ai_addrlen) == 0 && listen(descriptor, 1024) == 0;
+    freeaddrinfo(found);
+    if (!opened){
+
+        if (descriptor >= 0) close(descriptor);
+        throw std::runtime_error("No se pudo Escuchar en " + host + ":" + std::to_string(port));
+
+    }
+
+    /// Puerto Real (si se Pidió uno Libre)
+    sockaddr_storage local{};
+    socklen_t length = sizeof(local);
+    getsockname(descriptor, reinterpret_cast<sockaddr*>(&local), &length);
+    boundPort = ntohs(local.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&local)->sin6_port : reinterpret_cast<sockaddr_in*>(&local)->sin_port);
+    fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+    return descriptor;
+
+}
+
+
+
+
+/**
+ * @brief Función que Coordina un Trabajo Distribuido hasta Combinar todas sus Unidades.
+ * @param job (DistributedJob): El Trabajo (Recibe los Resúmenes y Contadores).
+ * @param listener (int): Socket de Escucha de los Trabajadores.
+ */
+void coordinateJob(DistributedJob& job, int listener){
+
+    /*
+       - Función: Coordinar Trabajo
+       - Argumentos:
+            - job (DistributedJob): Trabajo
+            - listener (int): Socket de Escucha
+       - Retorno: Ninguno
+       - Objetivo: Prestar Unidades a quien las Pida; una Unidad Vuelve a la Cola si su Trabajador se
+                   Desconecta o si el Préstamo Vence. Cada Unidad se Acepta una sola Vez (el Primer Resultado
+                   Gana) y los Resúmenes se Combinan en Orden de Unidad, así el Resultado es el mismo que el de
+                   --simulate con --shard-size igual al Tamaño de Unidad, sin Importar Caídas ni Trabajadores
+    */
+
+    /// Unidades: Enfrentamiento Mayor, Rango de Semillas Menor
+    std::vector<WorkUnit> units;
+    long long perMatchup = (job.games + job.unitSize - 1) / job.unitSize;
+    for (size_t m = 0; m < job.matchups.size(); m++) for (long long u = 0; u < perMatchup; u++){
+
+        WorkUnit unit{};
+        unit.id = static_cast<int64_t>(units.size());
+        unit.matchup = static_cast<int32_t>(m);
+        unit.strategies[0] = job.matchups[m][0];
+        unit.strategies[1] = job.matchups[m][1];
+        unit.rules = job.rules;
+        unit.playouts = searchSettings.playouts;
+        unit.budgetMilliseconds = searchSettings.budgetMilliseconds;
+        unit.baseSeed = job.baseSeed;
+        unit.first = u * job.unitSize;
+        unit.count = std::min(job.unitSize, job.games - unit.first);
+        units.push_back(unit);
+
+    }
+    job.summaries.assign(job.matchups.size(), GameSummary());
+    for (GameSummary& summary : job.summaries) initSummary(summary, marginReach(job.rules));
+
+    /// Estado de los Préstamos
+    std::set<int64_t> queued;                                                // Unidades por Prestar (la Menor Primero)
+    for (const WorkUnit& unit : units) queued.insert(unit.id);
+    std::vector<char> done(units.size(), 0);
+    std::vector<chrono::steady_clock::time_point> deadline(units.size());
+    std::vector<int> owner(units.size(), -1);
+    std::map<int64_t, GameSummary> pending;                                  // Resultados en Espera de su Turno
+    int64_t merged = 0;
+
+    /// Devolver una Unidad a la Cola (si quien la Suelta aún es su Dueño)
+    auto release = [&](int64_t id, int descriptor){
+
+        if (id < 0 || done[id] || owner[id] != descriptor) return;
+        owner[id] = -1;
+        queued.insert(id);
+        job.releases++;
+
+    };
+
+    /// Responder a un Trabajador
+    auto reply = [&](WorkerLink& link, uint32_t type, const WorkUnit* unit){
+
+        WorkHeader header{};
+        header.magic = WORK_MAGIC;
+        header.type = type;
+        if (unit) header.unit = *unit;
+        return writeExactly(link.descriptor, &header, sizeof(header));
+
+    };
+
+    std::vector<WorkerLink> links;
+    std::vector<pollfd> descriptors;
+    while (merged < static_cast<int64_t>(units.size())){
+
+        /// Préstamos Vencidos Vuelven a la Cola (el Trabajador Lento aún Puede Responder Primero)
+        auto now = chrono::steady_clock::now();
+        for (size_t id = 0; id < units.size(); id++) if (owner[id] >= 0 && !done[id] && now >= deadline[id]) release(static_cast<int64_t>(id), owner[id]);
+
+        /// Esperar Conexiones y Mensajes
+        descriptors.clear();
+        descriptors.push_back({listener, POLLIN, 0});
+        for (const WorkerLink& link : links) descriptors.push_back({link.descriptor, POLLIN, 0});
+        if (poll(descriptors.data(), descriptors.size(), 250) < 0 && errno != EINTR) throw std::runtime_error("Fallo al Esperar a los Trabajadores");
+
+        /// Atender a cada Trabajador (de Atrás hacia Adelante para Poder Quitar)
+        for (size_t i = links.size(); i-- > 0;){
+
+            WorkerLink& link = links[i];
+            short events = descriptors[i + 1].revents;
+            bool closed = (events & (POLLERR | POLLNVAL)) != 0;
+            if (!closed && (events & (POLLIN | POLLHUP))){
+
+                char buffer[65536];
+                ssize_t received = recv(link.descriptor, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (received > 0) link.inbox.append(buffer, static_cast<size_t>(received));
+                else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) closed = true;
+
+            }
+
+            /// Mensajes Completos
+            size_t cursor = 0;
+            while (!closed && link.inbox.size() - cursor >= sizeof(WorkHeader)){
+
+                WorkHeader header;
+                std::memcpy(&header, link.inbox.data() + cursor, sizeof(header));
+                if (header.magic != WORK_MAGIC){closed = true; break;}
+                if (header.type == WORK_RESULT){
+
+                    /// Resultado: Aceptar solo la Primera Respuesta de cada Unidad, y Completa
+                    if (link.inbox.size() - cursor < sizeof(WorkHeader) + sizeof(GameSummary)) break;
+                    int64_t id = header.unit.id;
+                    GameSummary summary;
+                    std::memcpy(static_cast<void*>(&summary), link.inbox.data() + cursor + sizeof(WorkHeader), sizeof(summary));
+                    cursor += sizeof(WorkHeader) + sizeof(GameSummary);
+                    if (link.leased == id) link.leased = -1;
+                    if (id < 0 || id >= static_cast<int64_t>(units.size()) || summary.moves.stats.count != units[id].count){closed = true; break;}
+                    if (done[id]){job.duplicates++; continue;}
+                    done[id] = 1;
+                    owner[id] = -1;
+                    queued.erase(id);
+                    pending.emplace(id, summary);
+
+                }
+                else if (header.type == WORK_REQUEST){
+
+                    /// Pedido: Prestar la Menor Unidad en Cola, Esperar o Terminar
+                    cursor += sizeof(WorkHeader);
+                    release(link.leased, link.descriptor);                                    // Un Trabajador Tiene a lo más una Unidad
+                    link.leased = -1;
+                    if (!queued.empty()){
+
+                        int64_t id = *queued.begin();
+                        queued.erase(queued.begin());
+                        owner[id] = link.descriptor;
+                        deadline[id] = chrono::steady_clock::now() + seconds(job.leaseSeconds);
+                        link.leased = id;
+                        closed = !reply(link, WORK_LEASE, &units[id]);
+
+                    }
+                    else closed = !reply(link, merged + static_cast<int64_t>(pending.size()) == static_cast<int64_t>(units.size()) ? WORK_DONE : WORK_WAIT, nullptr);
+
+                }
+                else closed = true;
+
+            }
+            link.inbox.erase(0, cursor);
+
+            /// Desconexión: su Unidad Vuelve a la Cola de Inmediato
+            if (closed){
+
+                release(link.leased, link.descriptor);
+                close(link.descriptor);
+                links[i] = std::move(links.back());
+                links.pop_back();
+
+            }
+
+        }
+
+        /// Combinar el Prefijo de Unidades Terminadas
+        for (auto next = pending.find(merged); next != pending.end(); next = pending.find(merged)){
+
+            mergeSummary(job.summaries[units[merged].matchup], next->second);
+            pending.erase(next);
+            merged++;
+
+        }
+
+        /// Aceptar Trabajadores Nuevos
+        if (descriptors[0].revents & POLLIN){
+
+            int descriptor;
+            while ((descriptor = accept(listener, nullptr, nullptr)) >= 0){
+
+                int enable = 1;
+                setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                WorkerLink link;
+                link.descriptor = descriptor;
+                links.push_back(std::move(link));
+                job.workers++;
+
+            }
+
+        }
+
+    }
+
+    /// Despedir a los Trabajadores (Ven Fin de Archivo y Terminan)
+    for (WorkerLink& link : links) close(link.descriptor);
+
+}
+
+
+
+
+/**
+ * @brief Función del Trabajador: Pide Unidades, las Simula y Devuelve sus Resúmenes.
+ * @param address (std::string): Dirección "host:puerto" del Coordinador.
+ * @return (long long) Unidades Completadas.
+ */
+long long runWorker(const std::string& address){
+
+    /*
+       - Función: Trabajador
+       - Argumentos:
+            - address (std::string): Dirección del Coordinador
+       - Retorno: Unidades Completadas
+       - Objetivo: Un Pedido a la Vez; cada Unidad se Juega con el Motor de su Variante igual que un Fragmento
+                   de runSimulation y se Devuelve el GameSummary en Crudo (mismo Formato que los Puntos de
+                   Control). Termina al Recibir WORK_DONE o si el Coordinador Cierra la Conexión
+    */
+
+    int descriptor = connectTcp(address);
+    long long completed = 0;
+    WorkHeader request{};
+    request.magic = WORK_MAGIC;
+    request.type = WORK_REQUEST;
+    WorkHeader header;
+    while (writeExactly(descriptor, &request, sizeof(request)) && readExactly(descriptor, reinterpret_cast<uint8_t*>(&header), sizeof(header))){
+
+        /// Sin Trabajo por Ahora o Terminado
+        if (header.magic != WORK_MAGIC || header.type == WORK_DONE) break;
+        if (header.type == WORK_WAIT){std::this_thread::sleep_for(chrono::milliseconds(100)); continue;}
+        if (header.type != WORK_LEASE) break;
+
+        /// Jugar la Unidad
+        const WorkUnit& unit = header.unit;
+        if (unit.strategies[0] < 0 || unit.strategies[0] >= STRATEGY_COUNT || unit.strategies[1] < 0 || unit.strategies[1] >= STRATEGY_COUNT || unit.rules < 0 || unit.rules >= RULE_VARIANT_COUNT) break;
+        searchSettings.playouts = unit.playouts;
+        searchSettings.budgetMilliseconds = unit.budgetMilliseconds;
+        const Strategy* players[2] = {&STRATEGIES[unit.strategies[0]], &STRATEGIES[unit.strategies[1]]};
+        GameSummary partial;
+        initSummary(partial, marginReach(unit.rules));
+        for (int64_t i = unit.first; i < unit.first + unit.count; i++) addResult(partial, RULE_VARIANTS[unit.rules].simulate(mixSeed(unit.baseSeed + i), players));
+
+        /// Devolver el Resultado
+        WorkHeader result = header;
+        result.type = WORK_RESULT;
+        if (!writeExactly(descriptor, &result, sizeof(result)) || !writeExactly(descriptor, &partial, sizeof(partial))) break;
+        completed++;
+
+    }
+    close(descriptor);
+    return completed;
+
+}
+
+#endif
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Servidor Web ----------------------------------------------------------------
+
+const char* const WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";        /// Constante del Saludo WebSocket (RFC 6455)
+const size_t HTTP_REQUEST_LIMIT = 8192;                                           /// Bytes Máximos de un Encabezado de Petición
+const size_t WEBSOCKET_PAYLOAD_LIMIT = 1024;                                      /// Carga Máxima de un Mensaje del Navegador
+const int TIMER_SLOTS = 512;                                                      /// Ranuras de la Rueda de Pausas de cada Shard
+const int TIMER_TICK_MS = 4;                                                      /// Milisegundos por Ranura (una Vuelta Cubre la Pausa de 2 s)
+const size_t MATCH_QUEUE_SLOTS = 4096;                                            /// Boletos que Caben en la Cola de Emparejamiento
+const size_t MATCH_WAIT_SAMPLES = 1 << 20;                                        /// Tiempos en Cola que se Guardan (un Servidor Largo no Crece sin Límite)
+const size_t HANDOFF_SLOTS = 1024;                                                /// Parejas en Camino a cada Shard
+const size_t SEAT_NAME_BYTES = 24;                                                /// Bytes Máximos del Nombre de un Asiento
+const uint8_t MESSAGE_JOIN = 0xFE;                                                /// Saludo de Juego del Navegador: Asientos y Nombres
+
+/// Estructura: Archivo Estático Abierto (Compartido por las Respuestas en Curso)
+struct StaticAsset {
+
+    int descriptor = -1;                         // Archivo Abierto para sendfile
+    int64_t size = 0;                            // Tamaño en Bytes
+    int64_t modified = 0;                        // Fecha de Modificación (Segundos)
+    std::string etag;                            // Etiqueta de Versión (Tamaño y Fecha)
+    const char* type = "";                       // Tipo de Contenido
+    chrono::steady_clock::time_point checkedAt;  // Última Revisión en Disco
+
+};
+
+/// Asiento de una Conexión WebSocket
+enum SessionSeat : uint8_t {
+
+    SEAT_NONE,                                   // Aún sin Saludo de Juego (MESSAGE_JOIN)
+    SEAT_FIRST,                                  // Jugador 1 de una Partida con Rival
+    SEAT_SECOND,                                 // Jugador 2 de una Partida con Rival
+    SEAT_BOTH,                                   // Ambos Jugadores en el mismo Navegador
+    SEAT_QUEUED                                  // Esperando Rival en la Cola de Emparejamiento
+
+};
+
+/// Estructura: Conexión del Servidor Web (Petición HTTP o Sesión WebSocket)
+struct WebConnection {
+
+    int descriptor = -1;                         // Socket del Navegador
+    std::string inbox;                           // Bytes Recibidos sin Procesar
+    std::string outbox;                          // Bytes por Enviar (Encabezados y Mensajes)
+    size_t offset = 0;                           // Bytes de outbox ya Enviados
+    std::shared_ptr<StaticAsset> asset;          // Archivo en Envío (nullptr si Ninguno)
+    int64_t fileOffset = 0;                      // Siguiente Byte del Archivo por Enviar
+    bool keepAlive = true;                       // Mantener la Conexión tras la Respuesta
+    bool closing = false;                        // Cerrar al Vaciar outbox
+    bool websocket = false;                      // La Conexión ya es una Sesión de Juego
+    int session = -1;                            // Partida en el Depósito del Shard (-1 si Ninguna)
+    uint8_t seat = SEAT_NONE;                    // Asiento en la Partida (SessionSeat)
+    std::string name;                            // Nombre Pedido al Buscar Rival
+    char shown[CARD_COUNT];                      // Tablero que ya Tiene el Navegador
+    uint8_t shownTurn = 0;                       // Turno que ya Tiene el Navegador
+    uint8_t shownPoints[2] = {0, 0};             // Puntos que ya Tiene el Navegador
+    uint32_t sequence = 0;                       // Número del Próximo Mensaje
+
+};
+
+/// Estructura: Partida del Servidor Web (del Depósito de su Shard; la Juegan una o dos Conexiones)
+struct WebSession {
+
+    TurnFlow flow;                               // Partida
+    FlowStep step;                               // Lo que Espera la Partida
+    chrono::steady_clock::time_point wakeAt;     // Vencimiento de la Pausa (si step.await es AWAIT_TIMER)
+    chrono::steady_clock::time_point armedAt;    // Vencimiento ya Anotado en la Rueda de Pausas
+    RateLimiter limiters[2];                     // Ritmo de Volteo de cada Jugador
+    chrono::steady_clock::time_point openedAt;   // Apertura (Origen de los Momentos de Volteo)
+    std::string names[2];                        // Nombres de los Jugadores (del Saludo de Juego)
+    int members[2] = {-1, -1};                   // Descriptores de sus Conexiones (Uno si Juegan en el mismo Navegador)
+    bool active = false;                         // En Uso (si no, Está en la Lista Libre)
+
+};
+
+/// Estructura: Cola Acotada sin Candados de Varios Productores y Consumidores (cada Celda Lleva su Vuelta)
+template <typename T, size_t N>
+struct MpmcQueue {
+
+    static_assert((N & (N - 1)) == 0, "La Capacidad debe ser Potencia de 2");
+    struct Cell {
+
+        std::atomic<size_t> sequence;            // Posición que Espera (p para Escribir, p + 1 para Leer)
+        T value;                                 // Elemento
+
+    };
+    Cell cells[N];                               // Celdas en Anillo
+    alignas(64) std::atomic<size_t> head{0};     // Próxima Posición por Escribir
+    alignas(64) std::atomic<size_t> tail{0};     // Próxima Posición por Leer
+    MpmcQueue(){for (size_t i = 0; i < N; i++) cells[i].sequence.store(i, std::memory_order_relaxed);}
+
+};
+
+/// Estructura: Anillo sin Candados de un Productor y un Consumidor
+template <typename T, size_t N>
+struct SpscRing {
+
+    static_assert((N & (N - 1)) == 0, "La Capacidad debe ser Potencia de 2");
+    T items[N];                                  // Elementos en Anillo
+    alignas(64) std::atomic<size_t> head{0};     // Próxima Posición por Escribir (solo el Productor)
+    alignas(64) std::atomic<size_t> tail{0};     // Próxima Posición por Leer (solo el Consumidor)
+
+};
+
+/// Estructura: Boleto de una Conexión que Busca Rival
+struct MatchTicket {
+
+    WebConnection* link = nullptr;               // Conexión Separada de su Shard (Abierta)
+    chrono::steady_clock::time_point joinedAt;   // Entrada a la Cola
+    int shard = 0;                               // Shard de donde Salió
+
+};
+
+/// Estructura: Pareja que el Emparejador Entrega a un Shard
+struct MatchPair {
+
+    WebConnection* links[2] = {nullptr, nullptr};    // Jugador 1 y Jugador 2
+
+};
+
+/// Estructura: Emparejador Común a los Shards (los Shards Producen Boletos; un Hilo los Empareja)
+struct Matchmaker {
+
+    MpmcQueue<MatchTicket, MATCH_QUEUE_SLOTS> queue;   // Boletos por Emparejar
+    int wake[2] = {-1, -1};                            // Tubería para Despertar al Emparejador
+    std::atomic<bool> running{false};                  // El Hilo Sigue Activo
+    std::atomic<long long> depth{0};                   // Conexiones Esperando Rival Ahora
+    std::atomic<long long> deepest{0};                 // Mayor Espera Simultánea Vista
+    std::atomic<long long> matched{0};                 // Parejas Entregadas
+    std::atomic<long long> rejected{0};                // Boletos sin Lugar en la Cola (Cerrados con 1013)
+    std::atomic<long long> abandoned{0};               // Boletos cuyo Navegador se Fue antes de Emparejarse
+    std::vector<double> waits;                         // Tiempo en Cola de cada Jugador (ms; solo el Emparejador)
+
+};
+
+/// Estructura: Servidor Web
+struct WebServer {
+
+    int listener = -1;                                                 // Socket de Escucha
+    std::string root;                                                  // Directorio de los Archivos Estáticos
+    std::map<std::string, std::shared_ptr<StaticAsset>> assets;        // Archivos Abiertos por Ruta
+    std::mt19937_64 rng;                                               // Repartos de las Sesiones
+    std::atomic<bool> running{false};                                  // El Ciclo Sigue Activo
+    std::atomic<long long> responses{0};                               // Respuestas con Archivo (200)
+    std::atomic<long long> notModified{0};                             // Respuestas sin Cambios (304)
+    std::atomic<long long> sessions{0};                                // Sesiones WebSocket Abiertas en Total
+    std::atomic<long long> throttled{0};                               // Volteos Descartados por Ritmo no Humano
+    int shard = 0;                                                     // Número del Shard
+    std::vector<WebConnection> links;                                  // Conexiones del Shard
+    std::vector<int> slotOf;                                           // Índice en links por Descriptor (-1 si Ninguno)
+    std::vector<WebSession> pool;                                      // Depósito de Partidas (se Reusan)
+    std::vector<int> freeSessions;                                     // Partidas Libres del Depósito
+    Matchmaker* matchmaker = nullptr;                                  // Emparejador Común
+    SpscRing<MatchPair, HANDOFF_SLOTS> arrivals;                       // Parejas que el Emparejador Manda a este Shard
+    int wake[2] = {-1, -1};                                            // Tubería para Despertar al Shard
+
+};
+
+/// Estructura: Rueda de Pausas de un Shard (Cada Vencimiento se Redondea a la Ranura Siguiente)
+struct TimerWheel {
+
+    std::vector<std::pair<int, long long>> slots[TIMER_SLOTS];        // (Partida, Ranura de Vencimiento) en cada Ranura
+    chrono::steady_clock::time_point origin;                           // Momento de la Ranura 0
+    long long tick = 0;                                                // Próxima Ranura por Revisar
+    size_t armed = 0;                                                  // Entradas Anotadas
+
+};
+
+/// Estructura: Servidor Web Repartido en Shards (un serveLoop por Hilo, sin Estado Compartido)
+struct ShardedServer {
+
+    std::vector<std::unique_ptr<WebServer>> shards;                    // Un Servidor Completo por Shard
+    std::vector<std::thread> threads;                                  // Un Hilo por Shard
+    std::unique_ptr<Matchmaker> matchmaker;                            // Emparejador (Sigue Legible tras Detenerse)
+    std::thread matching;                                              // Hilo del Emparejador
+    int port = 0;                                                      // Puerto que Comparten
+
+};
+
+
+
+
+/**
+ * @brief Función que Agrega un Elemento a una Cola de Varios Productores sin Bloquear.
+ * @param queue (MpmcQueue<T, N>): La Cola.
+ * @param value (T): El Elemento.
+ * @return (bool) Falso si la Cola está Llena.
+ */
+template <typename T, size_t N>
+bool pushQueue(MpmcQueue<T, N>& queue, const T& value){
+
+    /// Reservar una Posición cuya Celda ya se Leyó en la Vuelta Anterior
+    size_t position = queue.head.load(std::memory_order_relaxed);
+    while (true){
+
+        typename MpmcQueue<T, N>::Cell& cell = queue.cells[position & (N - 1)];
+        intptr_t difference = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+        if (difference < 0) return false;                                                           // Llena
+        if (difference > 0){position = queue.head.load(std::memory_order_relaxed); continue;}       // Otro Productor la Tomó
+        if (!queue.head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) continue;
+
+        /// Escribir y Publicar la Celda
+        cell.value = value;
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Saca un Elemento de una Cola de Varios Consumidores sin Bloquear.
+ * @param queue (MpmcQueue<T, N>): La Cola.
+ * @param value (T): El Elemento (Salida).
+ * @return (bool) Falso si la Cola está Vacía.
+ */
+template <typename T, size_t N>
+bool popQueue(MpmcQueue<T, N>& queue, T& value){
+
+    /// Reservar una Posición ya Publicada
+    size_t position = queue.tail.load(std::memory_order_relaxed);
+    while (true){
+
+        typename MpmcQueue<T, N>::Cell& cell = queue.cells[position & (N - 1)];
+        intptr_t difference = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + 1);
+        if (difference < 0) return false;                                                           // Vacía
+        if (difference > 0){position = queue.tail.load(std::memory_order_relaxed); continue;}       // Otro Consumidor la Tomó
+        if (!queue.tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) continue;
+
+        /// Leer y Liberar la Celda para la Vuelta Siguiente
+        value = cell.value;
+        cell.sequence.store(position + N, std::memory_order_release);
+        return true;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Agrega un Elemento a un Anillo de un Productor.
+ * @param ring (SpscRing<T, N>): El Anillo.
+ * @param value (T): El Elemento.
+ * @return (bool) Falso si el Anillo está Lleno.
+ */
+template <typename T, size_t N>
+bool pushRing(SpscRing<T, N>& ring, const T& value){
+
+    /// Solo el Productor Mueve head
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) == N) return false;
+    ring.items[head & (N - 1)] = value;
+    ring.head.store(head + 1, std::memory_order_release);
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Saca un Elemento de un Anillo de un Consumidor.
+ * @param ring (SpscRing<T, N>): El Anillo.
+ * @param value (T): El Elemento (Salida).
+ * @return (bool) Falso si el Anillo está Vacío.
+ */
+template <typename T, size_t N>
+bool popRing(SpscRing<T, N>& ring, T& value){
+
+    /// Solo el Consumidor Mueve tail
+    size_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail == ring.head.load(std::memory_order_acquire)) return false;
+    value = ring.items[tail & (N - 1)];
+    ring.tail.store(tail + 1, std::memory_order_release);
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Calcula el Resumen SHA-1 de un Texto (solo para el Saludo WebSocket).
+ * @param text (std::string): El Texto.
+ * @return (std::array<uint8_t, 20>) El Resumen.
+ */
+std::array<uint8_t, 20> sha1Digest(const std::string& text){
+
+    /// Relleno: un Bit 1, Ceros y la Longitud en Bits (Big Endian)
+    std::string data = text;
+    uint64_t bits = static_cast<uint64_t>(text.size()) * 8;
+    data += static_cast<char>(0x80);
+    while (data.size() % 64 != 56) data += '\0';
+    for (int i = 7; i >= 0; i--) data += static_cast<char>(bits >> (8 * i));
+
+    /// Bloques de 64 Bytes
+    uint32_t state[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    auto rotate = [](uint32_t value, int shift){return (value << shift) | (value >> (32 - shift));};
+    for (size_t chunk = 0; chunk < data.size(); chunk += 64){
+
+        uint32_t words[80];
+        for (int i = 0; i < 16; i++){
+
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data() + chunk + 4 * i);
+            words[i] = static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 | static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+
+        }
+        for (int i = 16; i < 80; i++) words[i] = rotate(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+        for (int i = 0; i < 80; i++){
+
+            uint32_t mix, constant;
+            if (i < 20){mix = (b & c) | (~b & d); constant = 0x5A827999;}
+            else if (i < 40){mix = b ^ c ^ d; constant = 0x6ED9EBA1;}
+            else if (i < 60){mix = (b & c) | (b & d) | (c & d); constant = 0x8F1BBCDC;}
+            else {mix = b ^ c ^ d; constant = 0xCA62C1D6;}
+            uint32_t next = rotate(a, 5) + mix + e + constant + words[i];
+            e = d; d = c; c = rotate(b, 30); b = a; a = next;
+
+        }
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e;
+
+    }
+
+    /// Resumen en Big Endian
+    std::array<uint8_t, 20> digest;
+    for (int i = 0; i < 20; i++) digest[i] = static_cast<uint8_t>(state[i / 4] >> (24 - 8 * (i % 4)));
+    return digest;
+
+}
+
+
+
+
+/**
+ * @brief Función que Codifica Bytes en Base64.
+ * @param data (const uint8_t*): Los Bytes.
+ * @param size (size_t): Número de Bytes.
+ * @return (std::string) El Texto Codificado (con Relleno '=').
+ */
+std::string base64Encode(const uint8_t* data, size_t size){
+
+    /// Grupos de 3 Bytes a 4 Caracteres
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < size; i += 3){
+
+        uint32_t group = static_cast<uint32_t>(data[i]) << 16 | (i + 1 < size ? data[i + 1] << 8 : 0) | (i + 2 < size ? data[i + 2] : 0);
+        out += ALPHABET[(group >> 18) & 63];
+        out += ALPHABET[(group >> 12) & 63];
+        out += i + 1 < size ? ALPHABET[(group >> 6) & 63] : '=';
+        out += i + 2 < size ? ALPHABET[group & 63] : '=';
+
+    }
+    return out;
+
+}
+
+
+
+
+/**
+ * @brief Función que Deduce el Tipo de Contenido por la Extensión.
+ * @param path (std::string): La Ruta del Archivo.
+ * @return (const char*) El Tipo MIME.
+ */
+const char* contentType(const std::string& path){
+
+    /// Extensiones del Sitio
+    static const std::pair<const char*, const char*> TYPES[] = {
+
+        {".html", "text/html; charset=utf-8"}, {".css", "text/css; charset=utf-8"}, {".js", "text/javascript; charset=utf-8"},
+        {".json", "application/json"}, {".png", "image/png"}, {".jpg", "image/jpeg"}, {".jpeg", "image/jpeg"},
+        {".gif", "image/gif"}, {".svg", "image/svg+xml"}, {".webp", "image/webp"}, {".ico", "image/x-icon"}
+
+    };
+    for (const auto& type : TYPES){
+
+        size_t length = std::strlen(type.first);
+        if (path.size() >= length && path.compare(path.size() - length, length, type.first) == 0) return type.second;
+
+    }
+    return "application/octet-stream";
+
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Función que Indica si una Ruta es Parte del Sitio (index.html, css/, js/ o imgs/).
+ * @param target (std::string): Ruta Pedida (Empieza con '/').
+ * @return (bool) Verdadero si la Ruta se Puede Servir.
+ */
+bool isSitePath(const std::string& target){
+
+    /// Ningún Segmento Oculto ni Relativo ("." , "..", ".git") ni Separadores de Windows
+    if (target.empty() || target[0] != '/' || target.find('\\') != std::string::npos || target.find("/.") != std::string::npos) return false;
+
+    /// Solo la Página y sus Directorios de Recursos
+    const char* allowed[] = {"/css/", "/js/", "/imgs/"};
+    if (target == "/index.html") return true;
+    for (const char* prefix : allowed) if (target.rfind(prefix, 0) == 0 && target.size() > std::strlen(prefix)) return true;
+    return false;
+
+}
+
+
+
+
+/**
+ * @brief Función que Busca un Archivo Estático (Abierto una sola Vez y Revisado a lo más cada Segundo).
+ * @param server (WebServer): El Servidor.
+ * @param target (std::string): Ruta Pedida (Empieza con '/').
+ * @return (std::shared_ptr<StaticAsset>) El Archivo, o nullptr si no Existe.
+ */
+std::shared_ptr<StaticAsset> findAsset(WebServer& server, const std::string& target){
+
+    /*
+       - Función: Buscar Archivo
+       - Argumentos:
+            - server (WebServer): Servidor
+            - target (std::string): Ruta Pedida
+       - Retorno: Archivo Abierto
+       - Objetivo: El Descriptor y la Etiqueta se Guardan por Ruta; si el Archivo Cambia en Disco se Abre de
+                   Nuevo, y las Respuestas que aún Envían la Versión Anterior la Conservan hasta Terminar
+    */
+
+    /// Vigente en Caché
+    auto now = chrono::steady_clock::now();
+    auto found = server.assets.find(target);
+    if (found != server.assets.end() && now - found->second->checkedAt < seconds(1)) return found->second;
+
+    /// Revisar en Disco
+    std::string path = server.root + target;
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)){
+
+        if (found != server.assets.end()) server.assets.erase(found);
+        return nullptr;
+
+    }
+    if (found != server.assets.end() && found->second->size == info.st_size && found->second->modified == static_cast<int64_t>(info.st_mtime)){
+
+        found->second->checkedAt = now;
+        return found->second;
+
+    }
+
+    /// Abrir la Versión Nueva (el Descriptor se Cierra al Soltar la Última Referencia)
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) return nullptr;
+    std::shared_ptr<StaticAsset> asset(new StaticAsset(), [](StaticAsset* old){close(old->descriptor); delete old;});
+    asset->descriptor = descriptor;
+    asset->size = info.st_size;
+    asset->modified = info.st_mtime;
+    asset->type = contentType(target);
+    asset->checkedAt = now;
+    char tag[64];
+    std::snprintf(tag, sizeof(tag), "\"%llx-%llx\"", static_cast<unsigned long long>(asset->size), static_cast<unsigned long long>(asset->modified));
+    asset->etag = tag;
+    server.assets[target] = asset;
+    return asset;
+
+}
+
+
+
+
+/**
+ * @brief Función que Agrega un Mensaje WebSocket sin Máscara (Servidor a Navegador).
+ * @param out (std::string): Destino.
+ * @param opcode (uint8_t): Tipo de Mensaje (0x2 Binario, 0x8 Cierre, 0xA Pong).
+ * @param payload (const uint8_t*): Carga.
+ * @param size (size_t): Bytes de Carga (menos de 65536).
+ */
+void appendWebSocketFrame(std::string& out, uint8_t opcode, const uint8_t* payload, size_t size){
+
+    /// Encabezado: FIN + Código, Longitud Corta o de 16 Bits
+    out += static_cast<char>(0x80 | opcode);
+    if (size < 126) out += static_cast<char>(size);
+    else{
+
+        out += static_cast<char>(126);
+        out += static_cast<char>(size >> 8);
+        out += static_cast<char>(size & 0xFF);
+
+    }
+    out.append(reinterpret_cast<const char*>(payload), size);
+
+}
+
+
+
+
+/**
+ * @brief Función que Envía al Navegador lo que Cambió en su Partida.
+ * @param link (WebConnection): La Conexión.
+ * @param session (WebSession): Su Partida.
+ * @param type (SpectatorMessage): Estado Completo, Diferencias o Respuesta a un Volteo.
+ */
+void queueSessionFrame(WebConnection& link, const WebSession& session, SpectatorMessage type){
+
+    /*
+       - Función: Mensaje de Sesión
+       - Argumentos:
+            - link (WebConnection): Conexión
+            - session (WebSession): Partida
+            - type (SpectatorMessage): Tipo de Mensaje
+       - Retorno: Ninguno
+       - Objetivo: Mismo Formato que los Espectadores del Socket Unix, dentro de un Mensaje WebSocket Binario;
+                   una Respuesta se Envía aunque no Cambie Nada, para que el Navegador Sepa que su Volteo Llegó
+    */
+
+    /// Tablero Visible según la Máscara del Flujo
+    char visible[CARD_COUNT];
+    for (int k = 0; k < CARD_COUNT; k++) visible[k] = (session.flow.guard.hidden >> k) & 1 ? 'X' : static_cast<char>('A' + session.flow.cards[k]);
+
+    /// Carga: Estado Completo o Pares (Posición, Carta) que Cambiaron
+    uint8_t bytes[SPECTATOR_FRAME_BYTES];
+    size_t length = SPECTATOR_HEADER_BYTES;
+    if (type == MESSAGE_SNAPSHOT){
+
+        std::memcpy(bytes + length, visible, CARD_COUNT);
+        length += CARD_COUNT;
+        for (const std::string& name : session.names){
+
+            bytes[length++] = static_cast<uint8_t>(name.size());
+            std::memcpy(bytes + length, name.data(), name.size());
+            length += name.size();
+
+        }
+
+    }
+    else{
+
+        bytes[length++] = 0;
+        for (int k = 0; k < CARD_COUNT; k++){
+
+            if (visible[k] == link.shown[k]) continue;
+            bytes[length++] = static_cast<uint8_t>(k);
+            bytes[length++] = static_cast<uint8_t>(visible[k]);
+
+        }
+        bytes[SPECTATOR_HEADER_BYTES] = static_cast<uint8_t>((length - SPECTATOR_HEADER_BYTES - 1) / 2);
+        bool unchanged = bytes[SPECTATOR_HEADER_BYTES] == 0 && link.shownTurn == session.flow.guard.turn && std::memcmp(link.shownPoints, session.flow.points, 2) == 0;
+        if (type == MESSAGE_DIFF && unchanged) return;                       // Pausa sin Cambios Visibles
+
+    }
+
+    /// Encabezado (el Estado Completo Lleva el Número del Próximo Mensaje) y Marco WebSocket
+    std::memcpy(link.shown, visible, CARD_COUNT);
+    link.shownTurn = session.flow.guard.turn;
+    std::memcpy(link.shownPoints, session.flow.points, 2);
+    writeSpectatorHeader(bytes, type, link.shownTurn, link.shownPoints, type == MESSAGE_SNAPSHOT ? link.sequence : link.sequence++, length - SPECTATOR_HEADER_BYTES);
+    appendWebSocketFrame(link.outbox, 0x2, bytes, length);
+
+}
+
+
+
+
+/**
+ * @brief Función que Toma una Partida del Depósito del Shard.
+ * @param server (WebServer): El Shard.
+ * @return (int) Índice de la Partida (Limpia y Activa).
+ */
+int openSession(WebServer& server){
+
+    /// Reusar una Libre o Crecer el Depósito
+    int index = static_cast<int>(server.pool.size());
+    if (!server.freeSessions.empty()){
+
+        index = server.freeSessions.back();
+        server.freeSessions.pop_back();
+
+    }
+    else server.pool.emplace_back();
+    WebSession& session = server.pool[index];
+    session.limiters[0] = session.limiters[1] = RateLimiter();
+    session.members[0] = session.members[1] = -1;
+    session.armedAt = chrono::steady_clock::time_point();
+    session.openedAt = chrono::steady_clock::now();
+    session.active = true;
+    return index;
+
+}
+
+
+
+
+/**
+ * @brief Función que Envía a cada Conexión de una Partida lo que Cambió.
+ * @param server (WebServer): El Shard.
+ * @param index (int): La Partida.
+ * @param sender (const WebConnection*): Quien Volteó (Recibe Respuesta; nullptr si Fue una Pausa).
+ */
+void notifySession(WebServer& server, int index, const WebConnection* sender){
+
+    /// Respuesta a quien Volteó y Diferencias al Rival
+    for (int member : server.pool[index].members){
+
+        if (member < 0) continue;
+        WebConnection& link = server.links[server.slotOf[member]];
+        queueSessionFrame(link, server.pool[index], &link == sender ? MESSAGE_REPLY : MESSAGE_DIFF);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Empieza una Partida Nueva.
+ * @param server (WebServer): El Shard (Reparte con su Generador).
+ * @param index (int): La Partida.
+ */
+void startWebSession(WebServer& server, int index){
+
+    /// Reparto con las Reglas del Simulador y Flujo de mainLoop
+    WebSession& session = server.pool[index];
+    SimGame deal;
+    dealCards(deal, server.rng);
+    session.step = startFlow(session.flow, deal.cards, (uint64_t(1) << CARD_COUNT) - 1, 1 + deal.firstPlayer, 0, 0, 0, 0);
+
+    /// Estado Completo a cada Conexión (Antes, su Asiento si Juega contra un Rival)
+    for (int member : session.members){
+
+        if (member < 0) continue;
+        WebConnection& link = server.links[server.slotOf[member]];
+        if (link.seat == SEAT_FIRST || link.seat == SEAT_SECOND){
+
+            uint8_t bytes[SPECTATOR_HEADER_BYTES];
+            writeSpectatorHeader(bytes, MESSAGE_SEAT, link.seat, session.flow.points, link.sequence, 0);
+            appendWebSocketFrame(link.outbox, 0x2, bytes, sizeof(bytes));
+
+        }
+        queueSessionFrame(link, session, MESSAGE_SNAPSHOT);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Saca una Conexión de su Partida y la Devuelve al Depósito.
+ * @param server (WebServer): El Shard.
+ * @param link (WebConnection): La Conexión que se Va.
+ */
+void leaveSession(WebServer& server, WebConnection& link){
+
+    /// Sin su Rival la Partida no Sigue: se le Cierra con 1001 (la Otra Parte se Fue)
+    WebSession& session = server.pool[link.session];
+    for (int member : session.members){
+
+        if (member < 0 || member == link.descriptor) continue;
+        WebConnection& other = server.links[server.slotOf[member]];
+        const uint8_t away[2] = {0x03, 0xE9};
+        appendWebSocketFrame(other.outbox, 0x8, away, 2);
+        other.closing = true;
+        other.session = -1;
+
+    }
+    session.active = false;
+    server.freeSessions.push_back(link.session);
+    link.session = -1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Pasa una Conexión que Busca Rival a la Cola de Emparejamiento.
+ * @param server (WebServer): El Shard.
+ * @param link (WebConnection): La Conexión (Queda Vacía si Entró a la Cola).
+ * @return (bool) Verdadero si Entró; si la Cola está Llena se Queda y se Cierra con 1013.
+ */
+bool enqueueMatch(WebServer& server, WebConnection& link){
+
+    /// La Conexión Sale del Shard Abierta, con lo que Tenga Pendiente
+    Matchmaker& matchmaker = *server.matchmaker;
+    MatchTicket ticket;
+    ticket.link = new WebConnection(std::move(link));
+    ticket.joinedAt = chrono::steady_clock::now();
+    ticket.shard = server.shard;
+    if (pushQueue(matchmaker.queue, ticket)){
+
+        long long depth = ++matchmaker.depth, deepest = matchmaker.deepest;
+        while (depth > deepest && !matchmaker.deepest.compare_exchange_weak(deepest, depth)) {}
+        char notice = 1;
+        if (write(matchmaker.wake[1], &notice, 1) < 0) {}
+        return true;
+
+    }
+
+    /// Cola Llena: Intente más Tarde (1013)
+    link = std::move(*ticket.link);
+    delete ticket.link;
+    matchmaker.rejected++;
+    const uint8_t later[2] = {0x03, 0xF5};
+    appendWebSocketFrame(link.outbox, 0x8, later, 2);
+    link.seat = SEAT_NONE;
+    link.closing = true;
+    return false;
+
+}
+
+
+
+
+/**
+ * @brief Función que Procesa los Mensajes WebSocket Recibidos de una Sesión.
+ * @param server (WebServer): El Servidor.
+ * @param link (WebConnection): La Sesión.
+ * @return (bool) Falso si el Navegador Rompió el Protocolo.
+ */
+bool readWebSocketInput(WebServer& server, WebConnection& link){
+
+    /*
+       - Función: Entrada WebSocket
+       - Argumentos:
+            - server (WebServer): Servidor
+            - link (WebConnection): Sesión
+       - Retorno: Si la Sesión Sigue
+       - Objetivo: El Primer Mensaje es el Saludo de Juego (MESSAGE_JOIN, Asientos y Nombres): con 2 Asientos
+                   la Partida Empieza Aquí; con 1 la Conexión Pasa a Buscar Rival. Después, cada Mensaje de
+                   Datos es un Byte con la Posición Volteada (255 Reparte de Nuevo al Terminar); un Volteo
+                   durante una Pausa o en el Turno del Rival se Ignora, igual que en la Terminal. Antes de
+                   Llegar al Flujo Pasa por validateBatch: uno más Rápido que el Ritmo Humano se Descarta, y
+                   una Sesión Marcada se Cierra. Todo Cuadro del Navegador debe Venir Enmascarado (RFC 6455 §5.1)
+                   y sin Bits Reservados; los Mensajes son de un Solo Cuadro, así que uno Fragmentado se Cierra
+                   con 1003 en vez de Interpretarse a Medias
+    */
+
+    size_t cursor = 0;
+    while (link.inbox.size() - cursor >= 2){
+
+        /// Encabezado: Fin, Código, Máscara y Longitud
+        const uint8_t* frame = reinterpret_cast<const uint8_t*>(link.inbox.data() + cursor);
+        size_t available = link.inbox.size() - cursor;
+        bool last = (frame[0] & 0x80) != 0;                                   // Último Cuadro del Mensaje
+        uint8_t opcode = frame[0] & 0x0F;
+        bool masked = (frame[1] & 0x80) != 0;
+        size_t size = frame[1] & 0x7F, header = 2;
+        if (size == 127) return false;
+        if (size == 126){
+
+            if (available < 4) break;
+            size = static_cast<size_t>(frame[2]) << 8 | frame[3];
+            header = 4;
+
+        }
+        if (size > WEBSOCKET_PAYLOAD_LIMIT) return false;
+
+        /// Cuadro sin Máscara, con Bits Reservados, de Código Desconocido o de Control Fragmentado: Error de Protocolo (1002)
+        bool control = (opcode & 0x8) != 0;
+        bool known = opcode == 0x0 || opcode == 0x1 || opcode == 0x2 || opcode == 0x8 || opcode == 0x9 || opcode == 0xA;
+        if (!masked || (frame[0] & 0x70) != 0 || !known || (control && (!last || size > 125))){
+
+            const uint8_t protocol[2] = {0x03, 0xEA};
+            appendWebSocketFrame(link.outbox, 0x8, protocol, 2);
+            link.closing = true;
+            break;
+
+        }
+
+        /// Mensaje Fragmentado (Primer Cuadro sin Fin o Continuación): No Soportado (1003)
+        if (!control && (!last || opcode == 0x0)){
+
+            const uint8_t unsupported[2] = {0x03, 0xEB};
+            appendWebSocketFrame(link.outbox, 0x8, unsupported, 2);
+            link.closing = true;
+            break;
+
+        }
+        size_t mask = header;
+        header += 4;
+        if (available < header + size) break;
+
+        /// Carga sin Máscara
+        uint8_t payload[WEBSOCKET_PAYLOAD_LIMIT];
+        for (size_t i = 0; i < size; i++) payload[i] = frame[header + i] ^ frame[mask + (i & 3)];
+        cursor += header + size;
+
+        /// Control: Cierre y Ping
+        if (opcode == 0x8){
+
+            appendWebSocketFrame(link.outbox, 0x8, payload, std::min<size_t>(size, 2));
+            link.closing = true;
+            break;
+
+        }
+        if (opcode == 0x9){appendWebSocketFrame(link.outbox, 0xA, payload, std::min<size_t>(size, 125)); continue;}
+        if (control || size == 0) continue;                                   // Pong o Mensaje Vacío
+
+        /// Saludo de Juego: Asientos (2: Ambos en este Navegador; 1: Buscar Rival) y un Nombre por Asiento
+        if (link.seat == SEAT_NONE){
+
+            if (payload[0] != MESSAGE_JOIN || size < 2 || (payload[1] != 1 && payload[1] != 2)){
+
+                const uint8_t protocol[2] = {0x03, 0xEA};                    // 1002: Error de Protocolo
+                appendWebSocketFrame(link.outbox, 0x8, protocol, 2);
+                link.closing = true;
+                break;
+
+            }
+            std::string names[2];
+            for (size_t seat = 0, at = 2; seat < payload[1] && at < size; seat++, at += 1 + payload[at]){
+
+                names[seat].assign(reinterpret_cast<const char*>(payload + at + 1), std::min<size_t>({payload[at], SEAT_NAME_BYTES, size - at - 1}));
+
+            }
+            if (payload[1] == 1){
+
+                link.name = names[0];
+                link.seat = SEAT_QUEUED;
+                break;                                                         // Lo que Siga Viaja con la Conexión
+
+            }
+            int index = openSession(server);
+            for (int seat = 0; seat < 2; seat++) server.pool[index].names[seat] = names[seat].empty() ? "Jugador " + std::to_string(seat + 1) : names[seat];
+            server.pool[index].members[0] = link.descriptor;
+            link.session = index;
+            link.seat = SEAT_BOTH;
+            startWebSession(server, index);
+            continue;
+
+        }
+        if (link.session < 0) continue;
+
+        /// Volteo (o Partida Nueva al Terminar)
+        WebSession& session = server.pool[link.session];
+        uint8_t position = payload[0];
+        if (session.step.await == AWAIT_DONE && position == 255){startWebSession(server, link.session); continue;}
+        if (session.step.await == AWAIT_PICK && position != 255 && (link.seat == SEAT_BOTH || link.seat == session.flow.guard.turn)){
+
+            /// Etapa de Validación (Mesa Única: la de la Sesión); las Reglas del Tablero las Resuelve el Flujo
+            uint32_t timestamp = static_cast<uint32_t>(chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - session.openedAt).count());
+            MoveRequest request = {0, session.flow.guard.turn, static_cast<int8_t>(position / 6), static_cast<int8_t>(position % 6), timestamp};
+            uint8_t verdict;
+            validateBatch(&session.flow.guard, 1, session.limiters, &request, 1, &verdict);
+            if (verdict & MOVE_TOO_FAST){
+
+                server.throttled++;
+                if (session.limiters[(request.player - 1) & 1].flagged){
+
+                    const uint8_t policy[2] = {0x03, 0xF0};                  // 1008: Violación de Política
+                    appendWebSocketFrame(link.outbox, 0x8, policy, 2);
+                    link.closing = true;
+                    break;
+
+                }
+                queueSessionFrame(link, session, MESSAGE_REPLY);
+                continue;
+
+            }
+            session.step = flowPick(session.flow, position / 6, position % 6);
+            if (session.step.await == AWAIT_TIMER) session.wakeAt = chrono::steady_clock::now() + chrono::milliseconds(session.step.milliseconds);
+            notifySession(server, link.session, &link);
+            continue;
+
+        }
+        queueSessionFrame(link, session, MESSAGE_REPLY);
+
+    }
+    link.inbox.erase(0, cursor);
+    return true;
+
+}
+
+
+
+
+/**
+ * @brief Función que Responde una Petición HTTP.
+ * @param server (WebServer): El Servidor.
+ * @param link (WebConnection): La Conexión.
+ * @param request (std::string): Línea de Petición y Encabezados (sin la Línea Vacía Final).
+ */
+void handleHttpRequest(WebServer& server, WebConnection& link, const std::string& request){
+
+    /*
+       - Función: Responder Petición
+       - Argumentos:
+            - server (WebServer): Servidor
+            - link (WebConnection): Conexión
+            - request (std::string): Petición
+       - Retorno: Ninguno
+       - Objetivo: /ws se Convierte en Sesión de Juego (que Espera el Saludo MESSAGE_JOIN); las Rutas del Sitio (index.html, css, js, imgs) son Archivos
+                   del Directorio Raíz, Enviados con sendfile y Etiquetado para que el Navegador Revalide con If-None-Match (304)
+    */
+
+    /// Línea de Petición
+    std::istringstream text(request);
+    std::string line, method, target, version;
+    std::getline(text, line);
+    std::istringstream(line) >> method >> target >> version;
+
+    /// Encabezados que Importan (Nombres sin Mayúsculas)
+    std::map<std::string, std::string> headers;
+    while (std::getline(text, line)){
+
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+        std::string name = line.substr(0, colon), value = line.substr(colon + 1);
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c){return static_cast<char>(std::tolower(c));});
+        value.erase(0, value.find_first_not_of(" \t"));
+        while (!value.empty() && (value.back() == '\r' || value.back() == ' ')) value.pop_back();
+        headers[name] = value;
+
+    }
+    std::string connection = headers["connection"];
+    std::transform(connection.begin(), connection.end(), connection.begin(), [](unsigned char c){return static_cast<char>(std::tolower(c));});
+    link.keepAlive = version == "HTTP/1.1" ? connection.find("close") == std::string::npos : connection.find("keep-alive") != std::string::npos;
+
+    /// Respuesta sin Archivo
+    auto respond = [&](const char* status, const std::string& extra){
+
+        link.outbox += std::string("HTTP/1.1 ") + status + "\r\nContent-Length: 0\r\n" + extra + (link.keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+        if (!link.keepAlive) link.closing = true;
+
+    };
+
+    /// Sesión de Juego
+    std::string upgrade = headers["upgrade"];
+    std::transform(upgrade.begin(), upgrade.end(), upgrade.begin(), [](unsigned char c){return static_cast<char>(std::tolower(c));});
+    if (target == "/ws"){
+
+        std::string key = headers["sec-websocket-key"];
+        if (method != "GET" || upgrade != "websocket" || key.empty()){respond("400 Bad Request", ""); return;}
+        std::array<uint8_t, 20> digest = sha1Digest(key + WEBSOCKET_GUID);
+        link.outbox += "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " + base64Encode(digest.data(), digest.size()) + "\r\n\r\n";
+        link.websocket = true;
+        server.sessions++;                                                   // La Partida Empieza con el Saludo de Juego
+        return;
+
+    }
+
+    /// Archivo Estático (sin Salir del Directorio Raíz)
+    if (method != "GET" && method != "HEAD"){respond("405 Method Not Allowed", "Allow: GET, HEAD\r\n"); return;}
+    target = target.substr(0, target.find('?'));
+    if (!target.empty() && target.back() == '/') target += "index.html";
+    if (!isSitePath(target)){respond("404 Not Found", ""); return;}
+    std::shared_ptr<StaticAsset> asset = findAsset(server, target);
+    if (!asset){respond("404 Not Found", ""); return;}
+    if (headers["if-none-match"] == asset->etag){
+
+        respond("304 Not Modified", "ETag: " + asset->etag + "\r\nCache-Control: no-cache\r\n");
+        server.notModified++;
+        return;
+
+    }
+
+    /// Encabezados y Cuerpo por sendfile
+    link.outbox += "HTTP/1.1 200 OK\r\nContent-Type: " + std::string(asset->type) + "\r\nContent-Length: " + std::to_string(asset->size) + "\r\nETag: " + asset->etag + "\r\nCache-Control: no-cache\r\n" + (link.keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+    if (method == "GET"){
+
+        link.asset = asset;
+        link.fileOffset = 0;
+
+    }
+    if (!link.keepAlive) link.closing = true;
+    server.responses++;
+
+}
+
+
+
+
+/**
+ * @brief Función que Envía lo Pendiente de una Conexión sin Bloquear.
+ * @param link (WebConnection): La Conexión.
+ * @return (bool) Falso si hay que Cerrarla.
+ */
+bool flushWebConnection(WebConnection& link){
+
+    /// Encabezados y Mensajes
+    while (link.offset < link.outbox.size()){
+
+        ssize_t sent = send(link.descriptor, link.outbox.data() + link.offset, link.outbox.size() - link.offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent > 0){link.offset += static_cast<size_t>(sent); continue;}
+        return sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+
+    }
+    link.outbox.clear();
+    link.offset = 0;
+
+    /// Cuerpo del Archivo: del Caché de Páginas al Socket sin Copiar a este Proceso
+    while (link.asset && link.fileOffset < link.asset->size){
+
+        #ifdef __linux__
+            off_t position = static_cast<off_t>(link.fileOffset);
+            ssize_t sent = sendfile(link.descriptor, link.asset->descriptor, &position, static_cast<size_t>(link.asset->size - link.fileOffset));
+        #else
+            char chunk[65536];
+            ssize_t sent = pread(link.asset->descriptor, chunk, std::min<int64_t>(sizeof(chunk), link.asset->size - link.fileOffset), link.fileOffset);
+            if (sent > 0) sent = send(link.descriptor, chunk, static_cast<size_t>(sent), MSG_NOSIGNAL | MSG_DONTWAIT);
+        #endif
+        if (sent > 0){link.fileOffset += sent; continue;}
+        return sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+
+    }
+    link.asset.reset();
+    return !link.closing;
+
+}
+
+
+
+
+/**
+ * @brief Función que Anota un Vencimiento en la Rueda de Pausas.
+ * @param wheel (TimerWheel): La Rueda.
+ * @param session (int): Partida que Espera.
+ * @param at (chrono::steady_clock::time_point): Vencimiento.
+ */
+void armTimer(TimerWheel& wheel, int session, chrono::steady_clock::time_point at){
+
+    /// Ranura Siguiente al Vencimiento (Nunca una ya Revisada)
+    long long due = (chrono::duration_cast<chrono::milliseconds>(at - wheel.origin).count() + TIMER_TICK_MS - 1) / TIMER_TICK_MS;
+    due = std::max(due, wheel.tick);
+    wheel.slots[due % TIMER_SLOTS].push_back({session, due});
+    wheel.armed++;
+
+}
+
+
+
+
+/**
+ * @brief Función que Saca de la Rueda los Vencimientos Cumplidos.
+ * @param wheel (TimerWheel): La Rueda.
+ * @param now (chrono::steady_clock::time_point): Momento Actual.
+ * @param due (std::vector<int>): Partidas Vencidas (Salida; se Agregan).
+ */
+void expireTimers(TimerWheel& wheel, chrono::steady_clock::time_point now, std::vector<int>& due){
+
+    /*
+       - Función: Vencer Pausas
+       - Argumentos:
+            - wheel (TimerWheel): Rueda
+            - now (chrono::steady_clock::time_point): Momento Actual
+            - due (std::vector<int>): Partidas Vencidas
+       - Retorno: Ninguno
+       - Objetivo: Revisa solo las Ranuras entre la Última Visita y Ahora (a lo más una Vuelta); una Entrada de
+                   una Vuelta Posterior se Queda en su Ranura hasta que le Toque
+    */
+
+    long long current = chrono::duration_cast<chrono::milliseconds>(now - wheel.origin).count() / TIMER_TICK_MS;
+    long long last = std::min(current, wheel.tick + TIMER_SLOTS - 1);
+    for (; wheel.armed > 0 && wheel.tick <= last; wheel.tick++){
+
+        std::vector<std::pair<int, long long>>& slot = wheel.slots[wheel.tick % TIMER_SLOTS];
+        for (size_t i = 0; i < slot.size();){
+
+            if (slot[i].second > current){i++; continue;}
+            due.push_back(slot[i].first);
+            slot[i] = slot.back();
+            slot.pop_back();
+            wheel.armed--;
+
+        }
+
+    }
+    wheel.tick = std::max(wheel.tick, current + 1);
+
+}
+
+
+
+
+/**
+ * @brief Función que Calcula cuánto Puede Esperar poll() sin Atrasar una Pausa.
+ * @param wheel (TimerWheel): La Rueda.
+ * @param now (chrono::steady_clock::time_point): Momento Actual.
+ * @param limit (int): Espera Máxima en Milisegundos.
+ * @return (int) Milisegundos hasta la Primera Ranura Ocupada (o limit).
+ */
+int timerTimeout(const TimerWheel& wheel, chrono::steady_clock::time_point now, int limit){
+
+    /// Primera Ranura con Entradas a partir de la Próxima por Revisar
+    if (wheel.armed == 0) return limit;
+    long long elapsed = chrono::duration_cast<chrono::milliseconds>(now - wheel.origin).count();
+    for (long long t = wheel.tick; t < wheel.tick + TIMER_SLOTS; t++){
+
+        if (wheel.slots[t % TIMER_SLOTS].empty()) continue;
+        return static_cast<int>(std::clamp<long long>(t * TIMER_TICK_MS - elapsed, 0, limit));
+
+    }
+    return limit;
+
+}
+
+
+
+
+/**
+ * @brief Función del Ciclo del Servidor Web: Acepta Conexiones, Responde y Conduce las Partidas.
+ * @param server (WebServer): El Servidor.
+ */
+void serveLoop(WebServer& server){
+
+    /*
+       - Función: Ciclo del Servidor
+       - Argumentos:
+            - server (WebServer): Servidor
+       - Retorno: Ninguno
+       - Objetivo: Un Hilo con poll() y Sockets no Bloqueantes por Shard; cada Partida del Depósito es un
+                   Marco TurnFlow que se Reanuda con los Volteos de sus Conexiones y con sus Pausas, Anotadas
+                   en la Rueda del Shard, cuya Primera Ranura Ocupada Fija la Espera de poll(), así que miles
+                   de Sesiones no Necesitan un Hilo cada una ni Recorrerse para Hallar la Próxima Pausa. Una
+                   Conexión que Busca Rival Sale del Shard hacia la Cola; las Parejas Llegan por el Anillo
+    */
+
+    std::vector<WebConnection>& links = server.links;
+    std::vector<int>& slotOf = server.slotOf;
+    std::vector<pollfd> descriptors;
+    std::vector<int> due;
+    TimerWheel wheel;
+    wheel.origin = chrono::steady_clock::now();
+    auto schedule = [&](int index){
+
+        WebSession& session = server.pool[index];
+        if (!session.active || session.step.await != AWAIT_TIMER || session.armedAt == session.wakeAt) return;
+        armTimer(wheel, index, session.wakeAt);
+        session.armedAt = session.wakeAt;
+
+    };
+    while (server.running){
+
+        /// Descriptores y Espera hasta la Pausa más Próxima
+        auto now = chrono::steady_clock::now();
+        descriptors.clear();
+        descriptors.push_back({server.listener, POLLIN, 0});
+        descriptors.push_back({server.wake[0], POLLIN, 0});
+        for (const WebConnection& link : links){
+
+            bool pending = link.offset < link.outbox.size() || link.asset;
+            descriptors.push_back({link.descriptor, static_cast<short>(POLLIN | (pending ? POLLOUT : 0)), 0});
+
+        }
+        if (poll(descriptors.data(), descriptors.size(), timerTimeout(wheel, now, 200)) < 0 && errno != EINTR) break;
+        now = chrono::steady_clock::now();
+
+        /// Vaciar la Tubería de Aviso (las Parejas se Adoptan al Final)
+        if (descriptors[1].revents & POLLIN){
+
+            char drain[256];
+            while (read(server.wake[0], drain, sizeof(drain)) > 0) {}
+
+        }
+
+        /// Pausas Vencidas (sus Mensajes Salen al Atender las Conexiones); una Entrada Vieja no Vence Nada
+        due.clear();
+        expireTimers(wheel, now, due);
+        for (int index : due){
+
+            WebSession& session = server.pool[index];
+            while (session.active && session.step.await == AWAIT_TIMER && now >= session.wakeAt){
+
+                session.step = flowTimer(session.flow);
+                if (session.step.await == AWAIT_TIMER) session.wakeAt += chrono::milliseconds(session.step.milliseconds);
+                notifySession(server, index, nullptr);
+
+            }
+            schedule(index);
+
+        }
+
+        /// Atender cada Conexión (de Atrás hacia Adelante para Poder Quitar)
+        for (size_t i = links.size(); i-- > 0;){
+
+            WebConnection& link = links[i];
+            short events = descriptors[i + 2].revents;
+            bool closed = (events & (POLLERR | POLLNVAL)) != 0;
+
+            /// Leer
+            if (!closed && (events & (POLLIN | POLLHUP))){
+
+                char buffer[16384];
+                ssize_t received = recv(link.descriptor, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (received > 0) link.inbox.append(buffer, static_cast<size_t>(received));
+                else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) closed = true;
+
+            }
+
+            /// Peticiones HTTP (una a la Vez: la Siguiente Espera a que Salga la Respuesta Anterior)
+            while (!closed && !link.websocket && !link.closing && link.outbox.empty() && !link.asset){
+
+                size_t end = link.inbox.find("\r\n\r\n");
+                if (end == std::string::npos){
+
+                    if (link.inbox.size() > HTTP_REQUEST_LIMIT) closed = true;
+                    break;
+
+                }
+                std::string request = link.inbox.substr(0, end);
+                link.inbox.erase(0, end + 4);
+                handleHttpRequest(server, link, request);
+
+            }
+
+            /// Mensajes de la Sesión (un Volteo puede Abrir una Pausa)
+            if (!closed && link.websocket && !link.closing) closed = !readWebSocketInput(server, link);
+            if (!closed && link.session >= 0) schedule(link.session);
+
+            /// Busca Rival: Enviar lo Pendiente y Pasar la Conexión Abierta a la Cola de Emparejamiento
+            if (!closed && link.seat == SEAT_QUEUED){
+
+                closed = !flushWebConnection(link);
+                if (!closed && enqueueMatch(server, link)){
+
+                    slotOf[link.descriptor] = -1;
+                    links[i] = std::move(links.back());
+                    links.pop_back();
+                    if (i < links.size()) slotOf[links[i].descriptor] = static_cast<int>(i);
+                    continue;
+
+                }
+
+            }
+
+            /// Enviar y Cerrar si Terminó (el Rival, si lo Hay, se Cierra También)
+            if (!closed) closed = !flushWebConnection(link);
+            if (closed){
+
+                if (link.session >= 0) leaveSession(server, link);
+                slotOf[link.descriptor] = -1;
+                close(link.descriptor);
+                links[i] = std::move(links.back());
+                links.pop_back();
+                if (i < links.size()) slotOf[links[i].descriptor] = static_cast<int>(i);
+
+            }
+
+        }
+
+        /// Aceptar Conexiones Nuevas
+        if (descriptors[0].revents & POLLIN){
+
+            int descriptor;
+            while ((descriptor = accept(server.listener, nullptr, nullptr)) >= 0){
+
+                int enable = 1;
+                fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+                setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                if (descriptor >= static_cast<int>(slotOf.size())) slotOf.resize(descriptor + 1, -1);
+                slotOf[descriptor] = static_cast<int>(links.size());
+                WebConnection link;
+                link.descriptor = descriptor;
+                links.push_back(std::move(link));
+
+            }
+
+        }
+
+        /// Parejas del Emparejador: sus dos Conexiones Quedan en este Shard y Comparten una Partida
+        MatchPair pair;
+        while (popRing(server.arrivals, pair)){
+
+            int index = openSession(server);
+            for (int seat = 0; seat < 2; seat++){
+
+                WebConnection* arriving = pair.links[seat];
+                if (arriving->descriptor >= static_cast<int>(slotOf.size())) slotOf.resize(arriving->descriptor + 1, -1);
+                slotOf[arriving->descriptor] = static_cast<int>(links.size());
+                arriving->session = index;
+                arriving->seat = static_cast<uint8_t>(SEAT_FIRST + seat);
+                server.pool[index].members[seat] = arriving->descriptor;
+                server.pool[index].names[seat] = arriving->name.empty() ? "Jugador " + std::to_string(seat + 1) : arriving->name;
+                links.push_back(std::move(*arriving));
+                delete arriving;
+
+            }
+            startWebSession(server, index);
+
+        }
+
+    }
+
+    /// Cerrar Conexiones
+    for (WebConnection& link : links) close(link.descriptor);
+    links.clear();
+
+}
+
+
+
+
+/**
+ * @brief Función que Cierra las Conexiones de las Parejas que Ningún Shard Adoptó.
+ * @param ring (SpscRing<MatchPair, HANDOFF_SLOTS>): Anillo de Llegadas de un Shard Detenido.
+ */
+void dropArrivals(SpscRing<MatchPair, HANDOFF_SLOTS>& ring){
+
+    /// Solo con el Shard y el Emparejador Detenidos
+    MatchPair pair;
+    while (popRing(ring, pair)){
+
+        for (WebConnection* link : pair.links){
+
+            close(link->descriptor);
+            delete link;
+
+        }
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Indica si el Navegador de una Conexión sin Atender Sigue Conectado.
+ * @param descriptor (int): El Socket.
+ * @return (bool) Falso si ya lo Cerró o Falló.
+ */
+bool stillConnected(int descriptor){
+
+    /// Mirar sin Consumir: 0 Bytes es Cierre
+    char byte;
+    ssize_t received = recv(descriptor, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return received > 0 || (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR));
+
+}
+
+
+
+
+/**
+ * @brief Función del Hilo Emparejador: Forma Parejas con los Boletos y las Entrega a un Shard.
+ * @param sharded (ShardedServer): Los Shards y su Emparejador.
+ */
+void matchLoop(ShardedServer& sharded){
+
+    /*
+       - Función: Emparejar
+       - Argumentos:
+            - sharded (ShardedServer): Shards
+       - Retorno: Ninguno
+       - Objetivo: Los Shards Meten Boletos en la Cola sin Candados y Avisan por la Tubería; este Hilo es el
+                   único que los Saca, Guarda uno hasta que Llegue Otro y Manda la Pareja al Shard del que
+                   Esperaba más, por su Anillo (un Productor y un Consumidor). El Tablero es Siempre de 6 x 6
+                   y cada Boleto Pide un Asiento, así que Todos los Boletos son del mismo Grupo
+    */
+
+    Matchmaker& matchmaker = *sharded.matchmaker;
+    MatchTicket held, ticket;
+    bool holding = false;
+    auto discard = [&](MatchTicket& dropped){
+
+        close(dropped.link->descriptor);
+        delete dropped.link;
+        matchmaker.depth--;
+
+    };
+    while (matchmaker.running){
+
+        /// Esperar Aviso de un Shard
+        pollfd wake = {matchmaker.wake[0], POLLIN, 0};
+        if (poll(&wake, 1, 100) > 0){
+
+            char drain[256];
+            while (read(matchmaker.wake[0], drain, sizeof(drain)) > 0) {}
+
+        }
+
+        /// Emparejar en Orden de Llegada (un Navegador que ya se Fue no Ocupa Asiento)
+        while (matchmaker.running && popQueue(matchmaker.queue, ticket)){
+
+            if (!stillConnected(ticket.link->descriptor)){discard(ticket); matchmaker.abandoned++; continue;}
+            if (holding && !stillConnected(held.link->descriptor)){discard(held); matchmaker.abandoned++; holding = false;}
+            if (!holding){held = ticket; holding = true; continue;}
+
+            /// Entregar la Pareja (el Anillo solo se Llena si el Shard no da Abasto)
+            auto now = chrono::steady_clock::now();
+            if (matchmaker.waits.size() < MATCH_WAIT_SAMPLES){
+
+                matchmaker.waits.push_back(chrono::duration<double, std::milli>(now - held.joinedAt).count());
+                matchmaker.waits.push_back(chrono::duration<double, std::milli>(now - ticket.joinedAt).count());
+
+            }
+            MatchPair pair;
+            pair.links[0] = held.link;
+            pair.links[1] = ticket.link;
+            WebServer& target = *sharded.shards[held.shard];
+            bool delivered;
+            while (!(delivered = pushRing(target.arrivals, pair)) && matchmaker.running) std::this_thread::yield();
+            if (!delivered){discard(held); discard(ticket); holding = false; break;}
+            char notice = 1;
+            if (write(target.wake[1], &notice, 1) < 0) {}
+            matchmaker.depth -= 2;
+            matchmaker.matched++;
+            holding = false;
+
+        }
+
+    }
+
+    /// Al Detenerse: Cerrar los Boletos sin Pareja
+    if (holding) discard(held);
+    while (popQueue(matchmaker.queue, ticket)) discard(ticket);
+
+}
+
+
+
+
+/**
+ * @brief Función que Abre los Shards del Servidor Web y Arranca un Hilo por Shard.
+ * @param sharded (ShardedServer): Los Shards (Recibe Servidores, Hilos y Puerto).
+ * @param count (int): Número de Shards.
+ * @param host (std::string): Dirección Local.
+ * @param port (int): Puerto (0 para uno Libre).
+ * @param root (std::string): Directorio del Sitio.
+ * @param seed (uint64_t): Semilla de los Repartos (cada Shard Deriva la Suya).
+ */
+void startShards(ShardedServer& sharded, int count, const std::string& host, int port, const std::string& root, uint64_t seed){
+
+    /*
+       - Función: Arrancar Shards
+       - Argumentos:
+            - sharded (ShardedServer): Shards
+            - count (int): Número de Shards
+            - host (std::string): Dirección
+            - port (int): Puerto
+            - root (std::string): Directorio del Sitio
+            - seed (uint64_t): Semilla
+       - Retorno: Ninguno
+       - Objetivo: Cada Shard es un WebServer Completo con su propio Socket de Escucha en el mismo Puerto
+                   (SO_REUSEPORT, así el Núcleo Reparte las Conexiones sin un Hilo que Acepte por Todos), sus
+                   Archivos Abiertos, su Generador de Repartos, su Depósito de Partidas y su Rueda de Pausas.
+                   Solo se Comunican por la Cola de Emparejamiento y el Anillo de Llegadas de cada Shard
+    */
+
+    /// Emparejador y Tuberías de Aviso no Bloqueantes
+    sharded.matchmaker = std::make_unique<Matchmaker>();
+    auto openWake = [](int (&wake)[2]){
+
+        if (pipe(wake) != 0) throw std::runtime_error("No se pudo Crear la Tuberia de Aviso");
+        for (int end : wake) fcntl(end, F_SETFL, fcntl(end, F_GETFL) | O_NONBLOCK);
+
+    };
+    openWake(sharded.matchmaker->wake);
+
+    /// Sockets de Escucha (el Primero Fija el Puerto si se Pidió uno Libre)
+    for (int s = 0; s < count; s++){
+
+        sharded.shards.push_back(std::make_unique<WebServer>());
+        WebServer& server = *sharded.shards.back();
+        server.root = root;
+        server.rng.seed(mixSeed(seed + static_cast<uint64_t>(s)));
+        server.shard = s;
+        server.matchmaker = sharded.matchmaker.get();
+        openWake(server.wake);
+        server.listener = listenTcp(host, s ? sharded.port : port, sharded.port, count > 1);
+        server.running = true;
+
+    }
+
+    /// Un Ciclo por Hilo y el Emparejador
+    for (std::unique_ptr<WebServer>& server : sharded.shards) sharded.threads.emplace_back(serveLoop, std::ref(*server));
+    sharded.matchmaker->running = true;
+    sharded.matching = std::thread(matchLoop, std::ref(sharded));
+
+}
+
+
+
+
+/**
+ * @brief Función que Detiene los Shards del Servidor Web y Espera sus Hilos.
+ * @param sharded (ShardedServer): Los Shards (Quedan Vacíos; las Cifras del Emparejador Siguen Legibles).
+ */
+void stopShards(ShardedServer& sharded){
+
+    /// Primero los Shards (ya no Entran Boletos) y luego el Emparejador
+    for (std::unique_ptr<WebServer>& server : sharded.shards) server->running = false;
+    for (std::thread& thread : sharded.threads) thread.join();
+    sharded.matchmaker->running = false;
+    char notice = 1;
+    if (write(sharded.matchmaker->wake[1], &notice, 1) < 0) {}
+    sharded.matching.join();
+
+    /// Cerrar Parejas sin Adoptar, Tuberías y Sockets de Escucha
+    for (std::unique_ptr<WebServer>& server : sharded.shards){
+
+        dropArrivals(server->arrivals);
+        close(server->listener);
+        close(server->wake[0]);
+        close(server->wake[1]);
+
+    }
+    close(sharded.matchmaker->wake[0]);
+    close(sharded.matchmaker->wake[1]);
+    sharded.threads.clear();
+    sharded.shards.clear();
+
+}
+
+#endif
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Entorno de Aprendizaje ------------------------------------------------------
+
+/// Exportar Símbolos al Compilar como Biblioteca Compartida (-DMEMORAMA_LIBRARY)
+#ifdef _WIN32
+    #define MEMORAMA_API extern "C" __declspec(dllexport)
+#else
+    #define MEMORAMA_API extern "C" __attribute__((visibility("default")))
+#endif
+
+const int OBSERVATION_SIZE = 2 * CARD_COUNT + 2;                                  /// Bytes de Observación por Entorno
+const float REWARD_MATCH = 1.0f;                                                  /// Recompensa por Pareja
+const float REWARD_INVALID = -1.0f;                                               /// Recompensa por Voltear una Carta no Válida
+const int ENV_SHARD_MIN = 4096;                                                   /// Entornos Mínimos por Hilo
+
+/// Estructura: Lote de Entornos
+struct LearningEnv {
+
+    std::vector<SimGame> games;                  // Una Partida por Entorno (Memoria Contigua)
+    std::vector<uint64_t> seeds;                 // Semilla del Episodio en Curso (el Siguiente usa mixSeed)
+    int threads = 1;                             // Hilos para Lotes Grandes
+    HelperThreads workers;                       // Ayudantes Persistentes (se Crean en el Primer Lote Grande)
+
+};
+
+
+
+
+/**
+ * @brief Función que Escribe la Observación de un Entorno.
+ * @param game (SimGame): La Partida.
+ * @param out (int8_t*): Destino de OBSERVATION_SIZE Bytes.
+ */
+inline void writeObservation(const SimGame& game, int8_t* out){
+
+    /*
+       - Función: Escribir Observación
+       - Argumentos:
+            - game (SimGame): Partida
+            - out (int8_t*): Destino
+       - Retorno: Ninguno
+       - Objetivo: [0, 36) Cartas Boca Arriba (Letra o -1), [36, 72) Memoria de Cartas Vistas (Letra o -1),
+                   72 Primera Carta Pendiente (-1 si Ninguna), 73 Jugador en Turno (0 o 1)
+    */
+
+    /// Tablero Visible y Memoria
+    const CardTracker& tracker = game.tracker;
+    for (int k = 0; k < CARD_COUNT; k++){
+
+        bool faceUp = tracker.matched[k] || k == tracker.pendingFirst;
+        out[k] = faceUp ? static_cast<int8_t>(game.cards[k]) : int8_t(-1);
+        out[CARD_COUNT + k] = tracker.letterAt[k];
+
+    }
+    out[2 * CARD_COUNT] = static_cast<int8_t>(tracker.pendingFirst);
+    out[2 * CARD_COUNT + 1] = static_cast<int8_t>(game.turn);
+
+}
+
+
+
+
+/**
+ * @brief Función que Reinicia un Entorno con una Semilla.
+ * @param game (SimGame): La Partida.
+ * @param seed (uint64_t): Semilla del Episodio.
+ */
+inline void resetEnvironment(SimGame& game, uint64_t seed){
+
+    /// Reparto Reproducible
+    std::mt19937_64 rng(seed);
+    dealCards(game, rng);
+
+}
+
+
+
+
+/**
+ * @brief Función que Avanza un Entorno con un Volteo.
+ * @param game (SimGame): La Partida.
+ * @param action (int): Posición a Voltear (0-35).
+ * @param done (bool): Indica si la Partida Terminó (Salida).
+ * @return (float) Recompensa del Jugador que Volteó.
+ */
+inline float stepEnvironment(SimGame& game, int action, bool& done){
+
+    /*
+       - Función: Avanzar Entorno
+       - Argumentos:
+            - game (SimGame): Partida
+            - action (int): Posición a Voltear
+            - done (bool): Fin de la Partida
+       - Retorno: Recompensa
+       - Objetivo: Cada Paso es un Volteo: la Primera Carta queda Pendiente y la Segunda Resuelve con las
+                   Reglas de finishMove; un Volteo no Válido se Penaliza sin Cambiar el Estado
+    */
+
+    /// Volteo no Válido: fuera de Rango, Emparejada o la misma Pendiente
+    done = false;
+    int first = game.tracker.pendingFirst;
+    if (static_cast<unsigned>(action) >= static_cast<unsigned>(CARD_COUNT) || game.tracker.matched[action] || action == first){
+
+        game.errors++;
+        return REWARD_INVALID;
+
+    }
+
+    /// Primera Carta
+    if (first < 0){
+
+        revealFirst(game, action);
+        return 0.0f;
+
+    }
+
+    /// Segunda Carta: Resolver
+    int player = game.turn, points = game.points[player];
+    finishMove(game, first, action);
+    done = game.points[0] + game.points[1] == PAIR_COUNT;
+    return game.points[player] > points ? REWARD_MATCH : 0.0f;
+
+}
+
+
+
+
+/**
+ * @brief Función que Reparte un Rango de Entornos entre Hilos.
+ * @param env (LearningEnv): El Lote.
+ * @param work (Function): Trabajo sobre un Rango [inicio, fin).
+ */
+template <typename Function>
+void shardEnvironments(LearningEnv& env, Function work){
+
+    /*
+       - Función: Repartir Entornos
+       - Argumentos:
+            - env (LearningEnv): Lote
+            - work (Function): Trabajo sobre un Rango
+       - Retorno: Ninguno
+       - Objetivo: Los Hilos del Lote Persisten entre Pasos (runHelperThreads), así que un Paso solo
+                   Despierta a los Ayudantes en vez de Crear y Unir Hilos
+    */
+
+    /// Lotes Pequeños en el Hilo que Llama (Despertar Hilos Costaría más que el Paso)
+    size_t count = env.games.size();
+    size_t threads = std::min<size_t>(static_cast<size_t>(std::max(1, env.threads)), std::max<size_t>(1, count / ENV_SHARD_MIN));
+    if (threads == 1){
+
+        work(size_t(0), count);
+        return;
+
+    }
+
+    /// Un Rango Contiguo por Hilo (Cada Hilo Escribe su Propia Parte de los Búferes)
+    size_t shard = (count + threads - 1) / threads;
+    auto part = [&](int t){work(std::min(count, t * shard), std::min(count, (t + 1) * shard));};
+    runHelperThreads(env.workers, static_cast<int>(threads), std::ref(part));          // Por Referencia: std::function no Reserva
+
+}
+
+
+
+
+/**
+ * @brief Función que Crea un Lote de Entornos.
+ * @param count (int): Número de Entornos.
+ * @param threads (int): Hilos para Lotes Grandes (0 para Todos los Núcleos).
+ * @return (void*) El Lote (Liberar con memorama_env_destroy), o nullptr si count no es Positivo.
+ */
+MEMORAMA_API void* memorama_env_create(int count, int threads){
+
+    /// Reservar las Partidas
+    if (count < 1) return nullptr;
+    LearningEnv* env = new LearningEnv;
+    env->games.resize(static_cast<size_t>(count));
+    env->seeds.assign(static_cast<size_t>(count), 0);
+    env->threads = threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    return env;
+
+}
+
+
+
+
+/**
+ * @brief Función que Libera un Lote de Entornos.
+ * @param handle (void*): El Lote.
+ */
+MEMORAMA_API void memorama_env_destroy(void* handle){delete static_cast<LearningEnv*>(handle);}
+
+
+
+
+/**
+ * @brief Función que Devuelve los Bytes de Observación por Entorno.
+ * @return (int) OBSERVATION_SIZE.
+ */
+MEMORAMA_API int memorama_observation_size(){return OBSERVATION_SIZE;}
+
+
+
+
+/**
+ * @brief Función que Reinicia Todos los Entornos.
+ * @param handle (void*): El Lote.
+ * @param seeds (uint64_t*): Una Semilla por Entorno.
+ * @param observations (int8_t*): Búfer de count * OBSERVATION_SIZE Bytes.
+ */
+MEMORAMA_API void memorama_env_reset(void* handle, const uint64_t* seeds, int8_t* observations){
+
+    /// Repartir y Observar Directamente en el Búfer del Llamador
+    LearningEnv& env = *static_cast<LearningEnv*>(handle);
+    shardEnvironments(env, [&](size_t begin, size_t end){
+
+        for (size_t i = begin; i < end; i++){
+
+            env.seeds[i] = seeds[i];
+            resetEnvironment(env.games[i], seeds[i]);
+            writeObservation(env.games[i], observations + i * OBSERVATION_SIZE);
+
+        }
+
+    });
+
+}
+
+
+
+
+/**
+ * @brief Función que Avanza Todos los Entornos un Volteo.
+ * @param handle (void*): El Lote.
+ * @param actions (int32_t*): Posición a Voltear en cada Entorno.
+ * @param observations (int8_t*): Búfer de count * OBSERVATION_SIZE Bytes.
+ * @param rewards (float*): Recompensa de cada Entorno.
+ * @param dones (uint8_t*): 1 si el Episodio Terminó (el Entorno ya se Reinició y la Observación es la del Nuevo).
+ */
+MEMORAMA_API void memorama_env_step(void* handle, const int32_t* actions, int8_t* observations, float* rewards, uint8_t* dones){
+
+    /*
+       - Función: Paso del Lote
+       - Argumentos:
+            - handle (void*): Lote
+            - actions (int32_t*): Volteos
+            - observations (int8_t*): Observaciones
+            - rewards (float*): Recompensas
+            - dones (uint8_t*): Fines de Episodio
+       - Retorno: Ninguno
+       - Objetivo: Un Volteo por Entorno Escrito Directamente en los Búferes del Llamador (p. ej. Arreglos de
+                   NumPy); al Terminar un Episodio el Entorno se Reinicia Solo con mixSeed de su Semilla
+    */
+
+    /// Avanzar, Reiniciar si Terminó y Observar
+    LearningEnv& env = *static_cast<LearningEnv*>(handle);
+    shardEnvironments(env, [&](size_t begin, size_t end){
+
+        for (size_t i = begin; i < end; i++){
+
+            bool done;
+            rewards[i] = stepEnvironment(env.games[i], actions[i], done);
+            dones[i] = static_cast<uint8_t>(done);
+            if (done){
+
+                env.seeds[i] = mixSeed(env.seeds[i]);
+                resetEnvironment(env.games[i], env.seeds[i]);
+
+            }
+            writeObservation(env.games[i], observations + i * OBSERVATION_SIZE);
+
+        }
+
+    });
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Análisis de Repartos --------------------------------------------------------
+
+/// Estructura: Puntaje de un Reparto
+struct DealScore {
+
+    uint64_t seed = 0;                           // Semilla del Reparto (dealCards con mt19937_64(seed))
+    double moves = 0;                            // Movimientos Esperados
+    double advantage = 0;                        // Ventaja Esperada de Quien Empieza (Puntos)
+
+};
+
+/// Estructura: Los K Repartos más Extremos de un Hilo (Montículo de Capacidad Fija)
+struct DealHeap {
+
+    std::vector<DealScore> items;                // Reservado una sola Vez
+    size_t capacity = 0;                         // K
+    bool longest = false;                        // Verdadero: Conserva los más Largos (Difíciles)
+
+};
+
+/// Estructura: Resultado Parcial de un Hilo del Barrido
+struct SweepPartial {
+
+    DealHeap easiest;                            // Repartos más Cortos
+    DealHeap hardest;                            // Repartos más Largos
+    double totalMoves = 0;                       // Suma de Movimientos Esperados
+    double totalAdvantage = 0;                   // Suma de Ventajas Esperadas
+
+};
+
+
+
+
+/**
+ * @brief Función que Indica si un Reparto es más Extremo que Otro para un Montículo.
+ * @param heap (DealHeap): El Montículo (Define la Dirección).
+ * @param a (DealScore): Primer Reparto.
+ * @param b (DealScore): Segundo Reparto.
+ * @return (bool) Verdadero si a es más Extremo que b (Empates por Semilla Menor).
+ */
+inline bool moreExtreme(const DealHeap& heap, const DealScore& a, const DealScore& b){
+
+    /// Más Largo o más Corto según el Montículo
+    if (a.moves != b.moves) return heap.longest ? a.moves > b.moves : a.moves < b.moves;
+    return a.seed < b.seed;
+
+}
+
+
+
+
+/**
+ * @brief Función que Ofrece un Reparto a un Montículo de los K más Extremos.
+ * @param heap (DealHeap): El Montículo.
+ * @param score (DealScore): El Reparto.
+ */
+void offerDeal(DealHeap& heap, const DealScore& score){
+
+    /*
+       - Función: Ofrecer Reparto
+       - Argumentos:
+            - heap (DealHeap): Montículo
+            - score (DealScore): Reparto
+       - Retorno: Ninguno
+       - Objetivo: La Raíz es el Menos Extremo de los Guardados; un Reparto Nuevo solo Entra si la Supera
+    */
+
+    /// Raíz = Menos Extremo
+    auto lessExtreme = [&heap](const DealScore& a, const DealScore& b){return moreExtreme(heap, a, b);};
+    if (heap.capacity == 0) return;
+    if (heap.items.size() < heap.capacity){
+
+        heap.items.push_back(score);
+        std::push_heap(heap.items.begin(), heap.items.end(), lessExtreme);
+
+    }
+    else if (moreExtreme(heap, score, heap.items.front())){
+
+        std::pop_heap(heap.items.begin(), heap.items.end(), lessExtreme);
+        heap.items.back() = score;
+        std::push_heap(heap.items.begin(), heap.items.end(), lessExtreme);
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Puntúa un Reparto Jugándolo Varias Veces con una Estrategia.
+ * @param seed (uint64_t): Semilla del Reparto.
+ * @param strategy (Strategy): Estrategia de Ambos Jugadores.
+ * @param playouts (int): Partidas por Reparto.
+ * @return (DealScore) Movimientos y Ventaja Esperados.
+ */
+DealScore scoreDeal(uint64_t seed, const Strategy& strategy, int playouts){
+
+    /*
+       - Función: Puntuar Reparto
+       - Argumentos:
+            - seed (uint64_t): Semilla del Reparto
+            - strategy (Strategy): Estrategia de Ambos Jugadores
+            - playouts (int): Partidas por Reparto
+       - Retorno: Puntaje del Reparto
+       - Objetivo: Repartir una Vez y Jugar Copias del Reparto (en la Pila, sin Memoria Dinámica; con busqueda,
+                   chooseAction Usa Búferes del Hilo que se Reservan en la Primera Decisión); el mismo Generador
+                   Continúa entre Partidas, así que el Puntaje es Reproducible
+    */
+
+    /// Reparto Fijo
+    std::mt19937_64 rng(seed);
+    SimGame dealt;
+    dealCards(dealt, rng);
+
+    /// Jugar Copias del Reparto
+    const Strategy* const players[2] = {&strategy, &strategy};
+    long long moves = 0, margin = 0;
+    for (int p = 0; p < playouts; p++){
+
+        SimGame game = dealt;
+        playSimGame(game, players, rng);
+        moves += game.moves;
+        margin += game.points[game.firstPlayer] - game.points[1 - game.firstPlayer];
+
+    }
+
+    /// Promedios
+    DealScore score;
+    score.seed = seed;
+    score.moves = double(moves) / playouts;
+    score.advantage = double(margin) / playouts;
+    return score;
+
+}
+
+
+
+
+/**
+ * @brief Función que Barre Semillas en Paralelo y Conserva los Repartos más Fáciles y más Difíciles.
+ * @param baseSeed (uint64_t): Semilla Base (el Reparto i usa mixSeed(baseSeed + i)).
+ * @param count (long long): Número de Repartos.
+ * @param strategy (Strategy): Estrategia de Ambos Jugadores.
+ * @param playouts (int): Partidas por Reparto.
+ * @param k (size_t): Repartos a Conservar de cada Extremo.
+ * @param threads (int): Número de Hilos.
+ * @param result (SweepPartial): Resultado Combinado (Listas Ordenadas de más a menos Extremo).
+ */
+void sweepDeals(uint64_t baseSeed, long long count, const Strategy& strategy, int playouts, size_t k, int threads, SweepPartial& result){
+
+    /*
+       - Función: Barrido de Semillas
+       - Argumentos:
+            - baseSeed (uint64_t): Semilla Base
+            - count (long long): Número de Repartos
+            - strategy (Strategy): Estrategia
+            - playouts (int): Partidas por Reparto
+            - k (size_t): Repartos por Extremo
+            - threads (int): Número de Hilos
+            - result (SweepPartial): Resultado Combinado
+       - Retorno: Ninguno
+       - Objetivo: Cada Hilo Toma Bloques de Semillas y Llena sus Propios Montículos; al Final se Combinan
+    */
+
+    /// Resultados por Hilo (Montículos Reservados antes de Empezar)
+    std::vector<SweepPartial> partials(threads);
+    for (SweepPartial& partial : partials){
+
+        partial.easiest.capacity = partial.hardest.capacity = k;
+        partial.hardest.longest = true;
+        partial.easiest.items.reserve(k);
+        partial.hardest.items.reserve(k);
+
+    }
+
+    /// Bloques de Semillas Repartidos con un Contador Atómico
+    const long long BLOCK = 1024;
+    std::atomic<long long> nextBlock(0);
+    auto worker = [&](int t){
+
+        SweepPartial& partial = partials[t];
+        for (long long block = nextBlock++; block * BLOCK < count; block = nextBlock++){
+
+            long long end = std::min(count, (block + 1) * BLOCK);
+            for (long long i = block * BLOCK; i < end; i++){
+
+                DealScore score = scoreDeal(mixSeed(baseSeed + i), strategy, playouts);
+                partial.totalMoves += score.moves;
+                partial.totalAdvantage += score.advantage;
+                offerDeal(partial.easiest, score);
+                offerDeal(partial.hardest, score);
+
+            }
+
+        }
+
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) workers.emplace_back(worker, t);
+    worker(0);
+    for (std::thread& thread : workers) thread.join();
+
+    /// Combinar Montículos y Ordenar de más a menos Extremo
+    result.easiest.capacity = result.hardest.capacity = k;
+    result.hardest.longest = true;
+    for (const SweepPartial& partial : partials){
+
+        for (const DealScore& score : partial.easiest.items) offerDeal(result.easiest, score);
+        for (const DealScore& score : partial.hardest.items) offerDeal(result.hardest, score);
+        result.totalMoves += partial.totalMoves;
+        result.totalAdvantage += partial.totalAdvantage;
+
+    }
+    for (DealHeap* heap : {&result.easiest, &result.hardest}){
+
+        std::sort(heap->items.begin(), heap->items.end(), [heap](const DealScore& a, const DealScore& b){return moreExtreme(*heap, a, b);});
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Exporta Listas de Repartos a un Archivo CSV.
+ * @param path (std::string): Ruta del Archivo.
+ * @param result (SweepPartial): Resultado del Barrido.
+ * @throw std::runtime_error: Si no se Puede Escribir el Archivo.
+ */
+void exportDeals(const std::string& path, const SweepPartial& result){
+
+    /*
+       - Función: Exportar Repartos
+       - Argumentos:
+            - path (std::string): Ruta del Archivo
+            - result (SweepPartial): Resultado del Barrido
+       - Retorno: Ninguno
+       - Objetivo: Una Fila por Reparto con su Semilla, Puntaje y Tablero (Fila por Fila, 'A' a 'R'), para
+                   Armar Acertijos o Fijar Casos de Regresión
+    */
+
+    /// Abrir Archivo
+    std::ofstream file(path);
+    if (!file) throw std::runtime_error("No se pudo Escribir: " + path);
+    file << "tipo,semilla,movimientos,ventaja,tablero\n";
+
+    /// Filas de Ambos Extremos
+    const std::pair<const char*, const DealHeap*> lists[2] = {{"facil", &result.easiest}, {"dificil", &result.hardest}};
+    for (const auto& list : lists){
+
+        for (const DealScore& score : list.second->items){
+
+            std::mt19937_64 rng(score.seed);
+            SimGame game;
+            dealCards(game, rng);
+            char layout[CARD_COUNT + 1];
+            for (int i = 0; i < CARD_COUNT; i++) layout[i] = static_cast<char>('A' + game.cards[i]);
+            layout[CARD_COUNT] = '\0';
+            char row[160];
+            std::snprintf(row, sizeof(row), "%s,%llu,%.3f,%.3f,%s\n", list.first, static_cast<unsigned long long>(score.seed), score.moves, score.advantage, layout);
+            file << row;
+
+        }
+
+    }
+    if (!file) throw std::runtime_error("No se pudo Escribir: " + path);
+
+}
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Desafío Diario --------------------------------------------------------------
+
+const int LEADER_MAX_LEVEL = 16;                                                  /// Niveles de la Lista con Saltos (p = 1/4)
+const size_t LEADER_NAME_BYTES = 24;                                              /// Bytes del Nombre de una Entrada
+const size_t LEADER_INITIAL_BYTES = 1 << 20;                                      /// Tamaño Inicial del Archivo
+
+/// Estructura: Encabezado del Archivo de Clasificación
+struct LeaderboardHeader {
+
+    char magic[8];                               // Firma "MEMLDB01"
+    uint32_t version;                            // Versión del Formato
+    uint32_t day;                                // Día del Desafío (AAAAMMDD)
+    uint64_t count;                              // Entradas Registradas
+    uint64_t used;                               // Bytes Usados del Archivo
+    uint32_t levels;                             // Nivel más Alto en Uso
+    uint32_t reserved;                           // Relleno
+
+};
+
+/// Estructura: Enlace de un Nodo en un Nivel
+struct LeaderLink {
+
+    uint64_t next;                               // Posición del Siguiente Nodo en el Archivo (0 = Fin)
+    uint64_t span;                               // Entradas que Salta el Enlace (para Calcular Lugares)
+
+};
+
+/// Estructura: Entrada de la Clasificación (le Siguen height Enlaces en el Archivo)
+struct LeaderNode {
+
+    uint32_t moves;                              // Movimientos (Menos es Mejor)
+    uint32_t errors;                             // Errores (Desempate)
+    uint32_t seconds;                            // Tiempo en Segundos (Desempate)
+    uint32_t sequence;                           // Orden de Llegada (Último Desempate)
+    char name[LEADER_NAME_BYTES];                // Nombre (Terminado en Cero)
+    uint32_t height;                             // Niveles del Nodo
+    uint32_t reserved;                           // Relleno
+
+};
+
+/// Estructura: Clasificación Abierta
+struct Leaderboard {
+
+    MappedFile file;                             // Archivo Proyectado
+    std::string path;                            // Ruta del Archivo
+    #ifndef _WIN32
+        int lock = -1;                           // Descriptor con el Bloqueo Exclusivo (flock) mientras está Abierta
+    #endif
+
+};
+
+
+
+
+/// Accesos a la Proyección (las Posiciones son Bytes desde el Inicio del Archivo)
+inline LeaderboardHeader& leaderHeader(Leaderboard& board){return *static_cast<LeaderboardHeader*>(board.file.data);}
+inline LeaderNode& leaderNode(Leaderboard& board, uint64_t offset){return *reinterpret_cast<LeaderNode*>(static_cast<char*>(board.file.data) + offset);}
+inline LeaderLink* leaderLinks(LeaderNode& node){return reinterpret_cast<LeaderLink*>(&node + 1);}
+inline size_t leaderNodeBytes(uint32_t height){return sizeof(LeaderNode) + height * sizeof(LeaderLink);}
+const uint64_t LEADER_HEAD = sizeof(LeaderboardHeader);                           /// Posición del Nodo Cabeza
+const uint64_t LEADER_FIRST = LEADER_HEAD + sizeof(LeaderNode) + LEADER_MAX_LEVEL * sizeof(LeaderLink);   /// Posición del Primer Nodo tras la Cabeza
+
+
+
+
+/**
+ * @brief Función que Sigue un Enlace Validándolo contra el Espacio Usado.
+ * @param board (Leaderboard): La Clasificación.
+ * @param offset (uint64_t): Posición del Nodo Enlazado.
+ * @param level (int): Nivel del Enlace (el Nodo debe Tener más Niveles).
+ * @return (LeaderNode&) El Nodo.
+ * @throw std::runtime_error Si el Enlace Sale del Espacio Usado (Archivo Corrupto).
+ */
+inline LeaderNode& leaderFollow(Leaderboard& board, uint64_t offset, int level){
+
+    /// El Nodo y sus Enlaces Completos dentro de lo Usado, y con Altura Coherente
+    uint64_t used = leaderHeader(board).used;
+    if (offset < LEADER_FIRST || offset > used - sizeof(LeaderNode)) throw std::runtime_error("Clasificacion Corrupta: " + board.path);
+    LeaderNode& node = leaderNode(board, offset);
+    if (node.height <= static_cast<uint32_t>(level) || node.height > LEADER_MAX_LEVEL || offset + leaderNodeBytes(node.height) > used) throw std::runtime_error("Clasificacion Corrupta: " + board.path);
+    return node;
+
+}
+
+
+
+
+/**
+ * @brief Función que Compara una Entrada contra una Clave de Clasificación.
+ * @param node (LeaderNode): La Entrada.
+ * @param key (LeaderNode): La Clave.
+ * @return (bool) Verdadero si la Entrada va Antes que la Clave.
+ */
+inline bool leaderBefore(const LeaderNode& node, const LeaderNode& key){
+
+    /// Movimientos, luego Errores, luego Tiempo y al Final Orden de Llegada
+    if (node.moves != key.moves) return node.moves < key.moves;
+    if (node.errors != key.errors) return node.errors < key.errors;
+    if (node.seconds != key.seconds) return node.seconds < key.seconds;
+    return node.sequence < key.sequence;
+
+}
+
+
+
+
+/**
+ * @brief Función que Cierra una Clasificación Sincronizándola a Disco (y Suelta su Bloqueo).
+ * @param board (Leaderboard): La Clasificación.
+ */
+void closeLeaderboard(Leaderboard& board){
+
+    /// Sincronizar y Liberar
+    flushMappedFile(board.file);
+    unmapFile(board.file);
+    #ifndef _WIN32
+        if (board.lock >= 0) close(board.lock);                              // Cerrar el Descriptor Suelta el flock
+        board.lock = -1;
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Abre (o Crea) la Clasificación de un Día.
+ * @param board (Leaderboard): La Clasificación.
+ * @param path (std::string): Ruta del Archivo.
+ * @param day (uint32_t): Día del Desafío (AAAAMMDD).
+ * @throw std::runtime_error: Si el Archivo no es una Clasificación Válida.
+ */
+void openLeaderboard(Leaderboard& board, const std::string& path, uint32_t day){
+
+    /*
+       - Función: Abrir Clasificación
+       - Argumentos:
+            - board (Leaderboard): Clasificación
+            - path (std::string): Ruta del Archivo
+            - day (uint32_t): Día del Desafío
+       - Retorno: Ninguno
+       - Objetivo: Proyectar el Archivo Completo; si es Nuevo, Escribir Encabezado y Nodo Cabeza. El Bloqueo
+                   Exclusivo se Toma antes de Mirar el Archivo y se Suelta al Cerrarlo, así que dos Partidas
+                   que Terminan a la Vez no Mezclan Enlaces ni Crecen el Archivo al Mismo Tiempo
+    */
+
+    /// Bloqueo entre Procesos (en Windows la Proyección ya se Abre sin Compartir Escritura)
+    board.path = path;
+    #ifndef _WIN32
+        board.lock = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (board.lock < 0) throw std::runtime_error("No se pudo Abrir " + path);
+        while (flock(board.lock, LOCK_EX) != 0){
+
+            if (errno == EINTR) continue;
+            close(board.lock);
+            board.lock = -1;
+            throw std::runtime_error("No se pudo Bloquear " + path);
+
+        }
+    #endif
+
+    /// Archivo Existente: Validar el Encabezado sin Modificarlo, y solo entonces Proyectar para Escritura
+    std::error_code error;
+    uintmax_t existing = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    if (existing > 0){
+
+        mapFile(board.file, path, 0, false);
+        const LeaderboardHeader& found = *static_cast<const LeaderboardHeader*>(board.file.data);
+        bool valid = existing >= LEADER_FIRST && std::memcmp(found.magic, "MEMLDB01", 8) == 0 && found.version == 1 && found.used >= LEADER_FIRST && found.used <= existing && found.levels >= 1 && found.levels <= LEADER_MAX_LEVEL;
+        unmapFile(board.file);
+        if (!valid){
+
+            closeLeaderboard(board);
+            throw std::runtime_error("Clasificacion Invalida: " + path);
+
+        }
+        mapFile(board.file, path, static_cast<size_t>(existing), true);
+        return;
+
+    }
+
+    /// Archivo Nuevo: Encabezado y Cabeza con Todos los Niveles
+    mapFile(board.file, path, LEADER_INITIAL_BYTES, true);
+    LeaderboardHeader& header = leaderHeader(board);
+    std::memcpy(header.magic, "MEMLDB01", 8);
+    header.version = 1;
+    header.day = day;
+    header.count = 0;
+    header.levels = 1;
+    header.used = LEADER_HEAD + leaderNodeBytes(LEADER_MAX_LEVEL);
+    LeaderNode& head = leaderNode(board, LEADER_HEAD);
+    std::memset(&head, 0, leaderNodeBytes(LEADER_MAX_LEVEL));
+    head.height = LEADER_MAX_LEVEL;
+
+}
+
+
+
+
+/**
+ * @brief Función que Inserta un Resultado en la Clasificación.
+ * @param board (Leaderboard): La Clasificación.
+ * @param name (std::string): Nombre de la Entrada.
+ * @param moves (int): Movimientos.
+ * @param errors (int): Errores.
+ * @param seconds (int): Tiempo en Segundos.
+ * @return (uint64_t) Lugar Obtenido (1 es el Primero).
+ */
+uint64_t insertLeaderEntry(Leaderboard& board, const std::string& name, int moves, int errors, int seconds){
+
+    /*
+       - Función: Insertar Resultado
+       - Argumentos:
+            - board (Leaderboard): Clasificación
+            - name (std::string): Nombre
+            - moves (int): Movimientos
+            - errors (int): Errores
+            - seconds (int): Tiempo en Segundos
+       - Retorno: Lugar Obtenido
+       - Objetivo: Lista con Saltos Indexable dentro del Archivo: se Baja por Niveles Sumando los Saltos (O(log n)),
+                   el Nodo Nuevo se Agrega al Final del Archivo y solo se Reescriben los Enlaces que lo Rodean
+    */
+
+    /// Crecer el Archivo si el Nodo más Alto no Cabe (Duplicando)
+    if (leaderHeader(board).used + leaderNodeBytes(LEADER_MAX_LEVEL) > board.file.size){
+
+        size_t size = board.file.size * 2;
+        unmapFile(board.file);
+        mapFile(board.file, board.path, size, true);
+
+    }
+    LeaderboardHeader& header = leaderHeader(board);
+
+    /// Clave de la Entrada Nueva
+    LeaderNode key{};
+    key.moves = static_cast<uint32_t>(moves);
+    key.errors = static_cast<uint32_t>(errors);
+    key.seconds = static_cast<uint32_t>(seconds);
+    key.sequence = static_cast<uint32_t>(header.count);
+
+    /// Bajar por Niveles Guardando el Último Nodo Anterior y su Lugar
+    uint64_t update[LEADER_MAX_LEVEL], rank[LEADER_MAX_LEVEL];
+    uint64_t current = LEADER_HEAD;
+    for (int level = static_cast<int>(header.levels) - 1; level >= 0; level--){
+
+        rank[level] = level == static_cast<int>(header.levels) - 1 ? 0 : rank[level + 1];
+        LeaderLink* links = leaderLinks(leaderNode(board, current));
+        while (links[level].next != 0 && leaderBefore(leaderFollow(board, links[level].next, level), key)){
+
+            rank[level] += links[level].span;
+            current = links[level].next;
+            links = leaderLinks(leaderNode(board, current));
+
+        }
+        update[level] = current;
+
+    }
+
+    /// Altura Aleatoria Reproducible (Probabilidad 1/4 por Nivel)
+    uint64_t bits = mixSeed(header.count ^ (uint64_t(header.day) << 32));
+    uint32_t height = 1;
+    while (height < LEADER_MAX_LEVEL && (bits & 3) == 0){height++; bits >>= 2;}
+    for (uint32_t level = header.levels; level < height; level++){
+
+        rank[level] = 0;
+        update[level] = LEADER_HEAD;
+        leaderLinks(leaderNode(board, LEADER_HEAD))[level].span = header.count;
+
+    }
+    header.levels = std::max(header.levels, height);
+
+    /// Escribir el Nodo al Final del Archivo
+    uint64_t offset = header.used;
+    LeaderNode& node = leaderNode(board, offset);
+    node = key;
+    std::strncpy(node.name, name.c_str(), LEADER_NAME_BYTES - 1);
+    node.name[LEADER_NAME_BYTES - 1] = '\0';
+    node.height = height;
+
+    /// Enlazar y Ajustar Saltos
+    LeaderLink* links = leaderLinks(node);
+    for (uint32_t level = 0; level < height; level++){
+
+        LeaderLink& previous = leaderLinks(leaderNode(board, update[level]))[level];
+        links[level].next = previous.next;
+        links[level].span = previous.span - (rank[0] - rank[level]);
+        previous.next = offset;
+        previous.span = rank[0] - rank[level] + 1;
+
+    }
+    for (uint32_t level = height; level < header.levels; level++) leaderLinks(leaderNode(board, update[level]))[level].span++;
+
+    /// Confirmar: Espacio Usado y Conteo al Final
+    header.used += leaderNodeBytes(height);
+    header.count++;
+    return rank[0] + 1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Calcula el Lugar que Tendría un Resultado.
+ * @param board (Leaderboard): La Clasificación.
+ * @param moves (int): Movimientos.
+ * @param errors (int): Errores.
+ * @param seconds (int): Tiempo en Segundos.
+ * @return (uint64_t) Lugar (1 + Entradas Estrictamente Mejores).
+ */
+uint64_t leaderRank(Leaderboard& board, int moves, int errors, int seconds){
+
+    /// Clave sin Desempate por Llegada (Empata con Todas las Iguales)
+    LeaderNode key{};
+    key.moves = static_cast<uint32_t>(moves);
+    key.errors = static_cast<uint32_t>(errors);
+    key.seconds = static_cast<uint32_t>(seconds);
+    key.sequence = 0;
+
+    /// Bajar por Niveles Sumando Saltos
+    uint64_t rank = 0, current = LEADER_HEAD;
+    for (int level = static_cast<int>(leaderHeader(board).levels) - 1; level >= 0; level--){
+
+        LeaderLink* links = leaderLinks(leaderNode(board, current));
+        while (links[level].next != 0 && leaderBefore(leaderFollow(board, links[level].next, level), key)){
+
+            rank += links[level].span;
+            current = links[level].next;
+            links = leaderLinks(leaderNode(board, current));
+
+        }
+
+    }
+    return rank + 1;
+
+}
+
+
+
+
+/**
+ * @brief Función que Devuelve las Primeras Entradas de la Clasificación.
+ * @param board (Leaderboard): La Clasificación.
+ * @param count (size_t): Entradas a Devolver.
+ * @param out (std::vector<LeaderNode>): Destino (en Orden).
+ */
+void topLeaderEntries(Leaderboard& board, size_t count, std::vector<LeaderNode>& out){
+
+    /// Recorrer el Nivel 0 desde la Cabeza
+    out.clear();
+    uint64_t current = leaderLinks(leaderNode(board, LEADER_HEAD))[0].next;
+    while (current != 0 && out.size() < count){
+
+        LeaderNode& node = leaderFollow(board, current, 0);
+        out.push_back(node);
+        current = leaderLinks(node)[0].next;
+
+    }
+
+}
+
+
+
+
+/**
+ * @brief Función que Devuelve el Día Actual como AAAAMMDD.
+ * @return (uint32_t) El Día Local.
+ */
+uint32_t currentDay(){
+
+    /// Fecha Local
+    time_t now = time(0);
+    tm local = *localtime(&now);
+    return static_cast<uint32_t>((local.tm_year + 1900) * 10000 + (local.tm_mon + 1) * 100 + local.tm_mday);
+
+}
+
+
+
+
+/**
+ * @brief Función que Devuelve la Ruta de la Clasificación de un Día.
+ * @param day (uint32_t): Día (AAAAMMDD).
+ * @return (std::string) La Ruta.
+ */
+inline std::string leaderboardPath(uint32_t day){return "memorama-" + std::to_string(day) + ".top";}
+
+
+
+
+/**
+ * @brief Función que Reparte el Tablero del Desafío de un Día.
+ * @param day (uint32_t): Día (AAAAMMDD).
+ * @param letters (std::vector<std::string>): Las 18 Letras.
+ * @param pairs (std::vector<std::string>): Las 36 Cartas en Orden de Tablero (Salida).
+ */
+void dealDaily(uint32_t day, const std::vector<std::string>& letters, std::vector<std::string>& pairs){
+
+    /*
+       - Función: Repartir Desafío Diario
+       - Argumentos:
+            - day (uint32_t): Día del Desafío
+            - letters (std::vector<std::string>): Letras
+            - pairs (std::vector<std::string>): Cartas Repartidas
+       - Retorno: Ninguno
+       - Objetivo: Mismo Reparto para Todos: dealCards con una Semilla Derivada Solo de la Fecha (en lugar de rand())
+    */
+
+    /// Reparto Reproducible
+    std::mt19937_64 rng(mixSeed(day));
+    SimGame game;
+    dealCards(game, rng);
+    for (int i = 0; i < CARD_COUNT; i++) pairs[i] = letters[game.cards[i]];
+
+}
+
+
+
+
+/**
+ * @brief Función que Imprime la Clasificación del Día y el Lugar Obtenido.
+ * @param board (Leaderboard): La Clasificación.
+ * @param place (uint64_t): Lugar Obtenido (0 si Solo se Consulta).
+ * @param top (size_t): Entradas a Mostrar.
+ */
+void printLeaderboard(Leaderboard& board, uint64_t place, size_t top){
+
+    /// Encabezado
+    char row[160];
+    std::vector<LeaderNode> entries;
+    topLeaderEntries(board, top, entries);
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Desafio del %u   Participantes: %llu", leaderHeader(board).day, static_cast<unsigned long long>(leaderHeader(board).count));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    if (place > 0){
+
+        std::snprintf(row, sizeof(row), "Tu Lugar: %llu", static_cast<unsigned long long>(place));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+
+    /// Primeros Lugares
+    std::snprintf(row, sizeof(row), "%-6s %-26s %12s %10s %12s", "Lugar", "Jugadores", "Movimientos", "Errores", "Tiempo(s)");
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    for (size_t i = 0; i < entries.size(); i++){
+
+        std::snprintf(row, sizeof(row), "%-6zu %-26s %12u %10u %12u", i + 1, entries[i].name, entries[i].moves, entries[i].errors, entries[i].seconds);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+
+}
+
+
+
+
+/**
+ * @brief Función que Registra el Resultado de un Desafío y Muestra la Clasificación.
+ * @param day (uint32_t): Día del Desafío (AAAAMMDD).
+ * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
+ * @param movesCounter (int): Movimientos.
+ * @param errorCounter (int): Errores.
+ * @param seconds (int): Tiempo Total en Segundos.
+ * @throw std::runtime_error: Si la Clasificación no se puede Abrir.
+ */
+void recordDaily(uint32_t day, const std::vector<std::string>& playerNames, int movesCounter, int errorCounter, int seconds){
+
+    /// Insertar y Sincronizar a Disco
+    Leaderboard leaderboard;
+    openLeaderboard(leaderboard, leaderboardPath(day), day);
+    uint64_t place = insertLeaderEntry(leaderboard, playerNames[0] + " / " + playerNames[1], movesCounter, errorCounter, seconds);
+
+    /// Pantalla de Clasificación
+    clearScreen();
+    printLeaderboard(leaderboard, place, 10);
+    closeLeaderboard(leaderboard);
+    screen << "                                                         ";
+    pauseExecution();
+
+}
+
+
+// =====================================================================================================================================
+// ------------------------------------------------------- Línea de Comandos -----------------------------------------------------------
+
+/**
+ * @brief Función que Obtiene el Valor de una Opción de la Línea de Comandos.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @param option (const char*): Nombre de la Opción (por ejemplo "--seed").
+ * @param fallback (std::string): Valor por Defecto.
+ * @return (std::string) El Valor de la Opción o el Valor por Defecto.
+ */
+std::string getOption(int argc, char* argv[], const char* option, const std::string& fallback){
+
+    /// Buscar "--opcion valor"
+    for (int i = 1; i + 1 < argc; i++) if (std::strcmp(argv[i], option) == 0) return argv[i + 1];
+    return fallback;
+
+}
+
+
+
+
+/**
+ * @brief Función que Indica si una Bandera está Presente en la Línea de Comandos.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @param flag (const char*): Nombre de la Bandera.
+ * @return (bool) Verdadero si la Bandera está Presente.
+ */
+bool hasFlag(int argc, char* argv[], const char* flag){
+
+    /// Buscar la Bandera
+    for (int i = 1; i < argc; i++) if (std::strcmp(argv[i], flag) == 0) return true;
+    return false;
+
+}
+
+
+
+
+/**
+ * @brief Función que Lee los Parámetros del Jugador por Búsqueda.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ */
+void readSearchSettings(int argc, char* argv[]){
+
+    /// Opciones --budget, --playouts, --search-threads y --tt-mb
+    searchSettings.budgetMilliseconds = std::stoi(getOption(argc, argv, "--budget", std::to_string(searchSettings.budgetMilliseconds)));
+    searchSettings.playouts = std::stoi(getOption(argc, argv, "--playouts", std::to_string(searchSettings.playouts)));
+    searchSettings.threads = std::stoi(getOption(argc, argv, "--search-threads", std::to_string(searchSettings.threads)));
+    searchSettings.tableMegabytes = std::stoi(getOption(argc, argv, "--tt-mb", std::to_string(searchSettings.tableMegabytes)));
+    if (searchSettings.budgetMilliseconds < 0 || searchSettings.playouts < 0) throw std::out_of_range("El Presupuesto de Busqueda no puede ser Negativo");
+    if (searchSettings.threads < 1) throw std::out_of_range("El Numero de Hilos debe ser Positivo");
+    if (searchSettings.tableMegabytes < 0) throw std::out_of_range("El Tamano de la Tabla no puede ser Negativo");
+    resizeTranspositions(searchSettings.tableMegabytes);
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Modo Simulación.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int simulationMain(int argc, char* argv[]){
+
+    /*
+       - Función: Modo Simulación
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --simulate <partidas> [--seed S] [--strategies e1,e2] [--rules variante] [--threads T] [--export directorio]
+                            [--checkpoint archivo] [--checkpoint-interval segundos]
+                   memorama --resume <archivo> [--threads T] [--export directorio]
+                   (con busqueda: [--budget ms] [--playouts N] [--search-threads T] [--tt-mb M])
+    */
+
+    /// Lectura de Opciones Comunes
+    int threads = std::stoi(getOption(argc, argv, "--threads", std::to_string(std::max(1u, std::thread::hardware_concurrency()))));
+    int checkpointSeconds = std::stoi(getOption(argc, argv, "--checkpoint-interval", "30"));
+    std::string checkpointPath = getOption(argc, argv, "--checkpoint", "");
+    if (threads < 1) throw std::out_of_range("El Numero de Hilos debe ser Positivo");
+    if (checkpointSeconds < 1) throw std::out_of_range("El Intervalo de Guardado debe ser Positivo");
+    readSearchSettings(argc, argv);
+
+    /// Trabajo Nuevo o Reanudado
+    SimulationJob job;
+    if (hasFlag(argc, argv, "--resume")){
+
+        checkpointPath = getOption(argc, argv, "--resume", "");
+        readCheckpoint(job, checkpointPath);                                 // Parámetros, Avance y Resumen Parcial
+
+    }
+    else{
+
+        job.games = std::stoll(getOption(argc, argv, "--simulate", "1000"));
+        job.baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+        job.shardSize = std::stoll(getOption(argc, argv, "--shard-size", "65536"));
+        if (job.games < 0) throw std::out_of_range("El Numero de Partidas debe ser Positivo");
+        if (job.shardSize < 1) throw std::out_of_range("El Tamano de Fragmento debe ser Positivo");
+
+        /// Estrategias de cada Jugador
+        std::string names = getOption(argc, argv, "--strategies", "memoria,memoria");
+        size_t comma = names.find(',');
+        job.strategies[0] = findStrategy(names.substr(0, comma));
+        job.strategies[1] = findStrategy(comma == std::string::npos ? names : names.substr(comma + 1));
+        job.rules = findRuleVariant(getOption(argc, argv, "--rules", RULE_VARIANTS[0].name));
+        initSummary(job.summary, marginReach(job.rules));
+
+    }
+
+    /// Validar la Ruta del Punto de Control antes de Simular (Guarda el Avance Inicial)
+    if (!checkpointPath.empty()) writeCheckpoint(job, checkpointPath);
+
+    /// Exportación Columnar Opcional (al Reanudar se Conservan las Filas ya Escritas)
+    std::string exportDirectory = getOption(argc, argv, "--export", "");
+    ResultColumns table;
+    if (!exportDirectory.empty()) createResultColumns(table, exportDirectory, job.games);
+
+    /// Simular e Imprimir Resumen
+    runSimulation(job, threads, exportDirectory.empty() ? nullptr : &table, checkpointPath, checkpointSeconds);
+    if (!exportDirectory.empty()) closeResultColumns(table);
+    printSummary(job.summary);
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición del Jugador por Búsqueda.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchSearchMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de Búsqueda
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-search [--games N] [--seed S] [--budget ms] [--playouts N] [--search-threads T]
+                   Enfrenta busqueda contra memoria (Alternando Asientos) y Reporta Simulaciones/s y Victorias
+    */
+
+    /// Lectura de Opciones
+    readSearchSettings(argc, argv);
+    long long games = std::stoll(getOption(argc, argv, "--games", "200"));
+    uint64_t baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+    if (games < 1) throw std::out_of_range("El Numero de Partidas debe ser Positivo");
+    int searcher = findStrategy("busqueda"), baseline = findStrategy("memoria");
+
+    /// Jugar Alternando el Asiento del Buscador
+    long long wins = 0, losses = 0, ties = 0, margin = 0;
+    searchPlayouts = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long long g = 0; g < games; g++){
+
+        int seat = static_cast<int>(g & 1);                                 // Asiento del Buscador
+        const Strategy* players[2];
+        players[seat] = &STRATEGIES[searcher];
+        players[1 - seat] = &STRATEGIES[baseline];
+        GameResult result = simulateGame(mixSeed(baseSeed + g), players);
+        int difference = result.points[seat] - result.points[1 - seat];
+        margin += difference;
+        if (difference > 0) wins++;
+        else if (difference < 0) losses++;
+        else ties++;
+
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                      Busqueda contra Memoria Perfecta                          * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Partidas: %-8lld Victorias: %5.1f%%   Derrotas: %5.1f%%   Empates: %5.1f%%", games, 100.0 * wins / games, 100.0 * losses / games, 100.0 * ties / games);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Margen Medio: %+.2f   Simulaciones/s: %.0f   Tiempo: %.2f s", double(margin) / games, searchPlayouts / std::max(seconds, 1e-9), seconds);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de la Tabla de Transposición.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchTranspositionMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de la Tabla de Transposición
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-tt [--deals D] [--replays R] [--seed S] [--playouts N] [--tt-mb M]
+                   Juega busqueda contra inferencia R Veces sobre cada Reparto (Distinto Azar de Juego) con 1, 4
+                   y todos los Núcleos, sin y con Tabla Compartida, y Reporta Tiempo, Aceleración, Aciertos y
+                   Colisiones
+    */
+
+    /// Lectura de Opciones (Simulaciones Fijas para que ambas Mediciones Hagan el mismo Trabajo)
+    long long deals = std::stoll(getOption(argc, argv, "--deals", "16"));
+    long long replays = std::stoll(getOption(argc, argv, "--replays", "8"));
+    uint64_t baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+    int playouts = std::stoi(getOption(argc, argv, "--playouts", "256"));
+    int megabytes = std::stoi(getOption(argc, argv, "--tt-mb", "16"));
+    if (deals < 1 || replays < 1) throw std::out_of_range("El Numero de Partidas debe ser Positivo");
+    if (playouts < 1 || megabytes < 1) throw std::out_of_range("Simulaciones y Tamano de Tabla deben ser Positivos");
+    searchSettings.playouts = playouts;
+    searchSettings.threads = 1;
+    const Strategy* players[2] = {&STRATEGIES[findStrategy("busqueda")], &STRATEGIES[findStrategy("inferencia")]};
+
+    /// Hilos a Medir: 1, 4 y Todos los Núcleos (sin Repetir)
+    int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> counts = {1};
+    if (cores > 4) counts.push_back(4);
+    if (cores > 1) counts.push_back(cores);
+    if (cores < 4) counts.push_back(4);
+
+    /// Encabezado
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                       Tabla de Transposicion Compartida                        * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Repartos: %lld x %lld   Simulaciones: %d   Tabla: %d MB   Nucleos: %d", deals, replays, playouts, megabytes, cores);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "%-6s %-6s %10s %8s %10s %11s %8s", "Hilos", "Tabla", "Tiempo(s)", "Acel.", "Aciertos", "Colisiones", "Margen");
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    /// Cada Configuración Juega las mismas Partidas
+    double baseline = 0;
+    for (int threads : counts) for (int shared = 0; shared < 2; shared++){
+
+        resizeTranspositions(shared ? megabytes : 0);
+        transpositionStats.probes = transpositionStats.hits = transpositionStats.stores = transpositionStats.evictions = 0;
+        std::atomic<long long> next(0), margin(0);
+        auto worker = [&](){
+
+            for (long long g = next++; g < deals * replays; g = next++){
+
+                if (g % replays == 0) transpositionAge++;                           // Nueva Generación por Reparto
+                std::mt19937_64 rng(mixSeed(baseSeed + g / replays));          // Reparto Compartido por las Repeticiones
+                SimGame game;
+                dealCards(game, rng);
+                rng.seed(mixSeed(baseSeed ^ (0x7EBA11ULL + g)));               // Azar de Juego Propio
+                playSimGame(game, players, rng);
+                margin += game.points[0] - game.points[1];
+
+            }
+
+        };
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; t++) pool.emplace_back(worker);
+        worker();
+        for (std::thread& thread : pool) thread.join();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (threads == 1 && !shared) baseline = seconds;
+
+        /// Fila de la Configuración
+        long long probes = transpositionStats.probes, stores = transpositionStats.stores;
+        std::snprintf(row, sizeof(row), "%-6d %-6s %10.2f %7.2fx %9.1f%% %10.1f%% %+8.2f", threads, shared ? "si" : "no", seconds, baseline / std::max(seconds, 1e-9),
+                      probes ? 100.0 * transpositionStats.hits / probes : 0.0, stores ? 100.0 * transpositionStats.evictions / stores : 0.0, double(margin) / (deals * replays));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+    resizeTranspositions(0);
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de Variantes de Reglas.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchRulesMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de Variantes
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-rules [--games N] [--seed S] [--strategies e1,e2]
+                   Juega las mismas Partidas con simulateGame y con el Motor de cada Variante, en un Hilo, y
+                   Reporta Movimientos/s (las Variantes Cambian el Largo de la Partida) Relativos a simulateGame,
+                   Turnos Medios y Margen Medio
+    */
+
+    /// Lectura de Opciones
+    long long games = std::stoll(getOption(argc, argv, "--games", "200000"));
+    uint64_t baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+    std::string names = getOption(argc, argv, "--strategies", "memoria,memoria");
+    if (games < 1) throw std::out_of_range("El Numero de Partidas debe ser Positivo");
+    size_t comma = names.find(',');
+    const Strategy* players[2] = {&STRATEGIES[findStrategy(names.substr(0, comma))], &STRATEGIES[findStrategy(comma == std::string::npos ? names : names.substr(comma + 1))]};
+
+    /// Encabezado
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                           Variantes de Reglas                                  * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "%-12s %12s %9s %9s %9s", "Motor", "Movs/s", "Relativo", "Turnos", "Margen");
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    /// Referencia (simulateGame) y luego cada Variante, sobre las mismas Semillas
+    double reference = 0;
+    for (int v = -1; v < RULE_VARIANT_COUNT; v++){
+
+        GameResult (*simulate)(uint64_t, const Strategy* const[2]) = v < 0 ? simulateGame : RULE_VARIANTS[v].simulate;
+        long long turns = 0, moves = 0, margin = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long long g = 0; g < games; g++){
+
+            GameResult result = simulate(mixSeed(baseSeed + g), players);
+            turns += result.turns;
+            moves += result.moves;
+            margin += result.points[0] - result.points[1];
+
+        }
+        double rate = moves / std::max(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), 1e-9);
+        if (v < 0) reference = rate;
+        std::snprintf(row, sizeof(row), "%-12s %12.0f %8.2fx %9.2f %+9.2f", v < 0 ? "referencia" : RULE_VARIANTS[v].name, rate, rate / reference, double(turns) / games, double(margin) / games);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función que Compone un Cuadro de Juego con Inserciones Sucesivas (Render Anterior, solo para Medir).
+ * @param out (std::ostream): El Flujo de Salida.
+ * @param points (int[2]): Puntos de los Jugadores.
+ * @param turn (int): Turno del Jugador Actual.
+ * @param visibleCards (std::vector<std::vector<std::string>>): Matriz de Cartas Visibles.
+ * @param playersNames (std::vector<std::string>): Nombres de los Jugadores.
+ */
+void renderReferenceFrame(std::ostream& out, const int points[2], int turn, const std::vector<std::vector<std::string>>& visibleCards, const std::vector<std::string>& playersNames){
+
+    /// Portada, Línea por Línea
+    out << "                      ********************************************************************************** \n";
+    out << "                      *                                                                                * \n";
+    out << "                      *          **   **  *****  **   **  *****  *****   ***   **   **  ***            * \n";
+    out << "                      *          * * * *  *      * * * *  *   *  *   *  *   *  * * * * *   *           * \n";
+    out << "                      *          *  *  *  ****   *  *  *  *   *  ****   *****  *  *  * *****           * \n";
+    out << "                      *          *     *  *      *     *  *   *  *   *  *   *  *     * *   *           * \n";
+    out << "                      *          *     *  *****  *     *  *****  *   *  *   *  *     * *   *           * \n";
+    out << "                      *                                                                                * \n";
+    out << "                      ********************************************************************************** \n";
+
+    /// Datos Generales
+    out << "                      *            " << playersNames[0] << " : " << points[0] << " puntos           |            " << playersNames[1] << " : " << points[1] << " puntos \n";
+    out << "                      ********************************************************************************** \n";
+    out << "                      *                               Turno del jugador: " << playersNames[turn - 1] << "\n";
+    out << "                      ********************************************************************************** \n";
+
+    /// Tablero, Carta por Carta
+    out << "                      *                                                                                * \n";
+    out << "                      *                                     0 1 2 3 4 5                                * \n";
+    for (int i = 0; i < 6; i++){
+
+        out << "                      *                                   " << i << " ";
+        for (int j = 0; j < 6; j++){
+
+            if (j == 5) out << visibleCards[i][j] << "                                * \n";
+            else out << visibleCards[i][j] << " ";
+
+        }
+
+    }
+    out << "                      *                                                                                * \n";
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición del Render.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchRenderMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición del Render
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-render [--frames N]
+                   Compara el Tiempo por Cuadro del Render por Inserciones contra el de Pantallas Precompuestas
+    */
+
+    /// Lectura de Opciones
+    long long frames = std::stoll(getOption(argc, argv, "--frames", "200000"));
+    if (frames < 1) throw std::out_of_range("El Numero de Cuadros debe ser Positivo");
+
+    /// Partida de Muestra a Medio Juego
+    std::vector<std::string> playersNames = {"Jugador 1", "Jugador 2"};
+    std::vector<std::vector<std::string>> visibleCards(6, std::vector<std::string>(6, "X"));
+    for (int k = 0; k < CARD_COUNT; k += 3) visibleCards[k / 6][k % 6] = std::string(1, static_cast<char>('A' + k / 2));
+    int points[2] = {4, 3}, turn = 2;
+
+    /// Antes: Inserciones Sucesivas en un Flujo (Reutilizado entre Cuadros)
+    std::ostringstream stream;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long long f = 0; f < frames; f++){
+
+        stream.str("");
+        renderReferenceFrame(stream, points, turn, visibleCards, playersNames);
+        bytes += static_cast<size_t>(stream.tellp());
+
+    }
+    double before = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    /// Después: Copias de Pantallas Precompuestas y Huecos Parchados (el Búfer se Vacía sin Escribir)
+    start = std::chrono::steady_clock::now();
+    for (long long f = 0; f < frames; f++){
+
+        screen.data.clear();
+        printGame(points[0], points[1], turn, visibleCards, playersNames, nullptr);
+        bytes += screen.data.size();
+
+    }
+    double after = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / frames;
+    screen.data.clear();
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                              Tiempo de Render por Cuadro                       * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Cuadros: %-10lld Antes: %8.1f ns   Despues: %8.1f ns   x%.1f", frames, before, after, before / std::max(after, 1e-9));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Bytes por Cuadro: %zu", bytes / static_cast<size_t>(2 * frames));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de la Validación.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchValidateMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de la Validación
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-validate [--moves N] [--tables T] [--seed S]
+                   Valida Volteos Sintéticos de Muchas Mesas por Lotes en un Núcleo y Reporta Validaciones/s
+    */
+
+    /// Lectura de Opciones
+    long long moves = std::stoll(getOption(argc, argv, "--moves", "10000000"));
+    long long tables = std::stoll(getOption(argc, argv, "--tables", "1024"));
+    std::mt19937_64 rng(std::stoull(getOption(argc, argv, "--seed", "1")));
+    if (moves < 1 || tables < 1) throw std::out_of_range("Movimientos y Mesas deben ser Positivos");
+
+    /// Mesas a Medio Juego y Tráfico Sintético (Generado antes de Medir)
+    std::vector<MoveGuard> guards(tables);
+    std::vector<RateLimiter> limiters(tables * 2);
+    for (MoveGuard& guard : guards){
+
+        guard.hidden = rng() & ((uint64_t(1) << CARD_COUNT) - 1);
+        guard.turn = static_cast<uint8_t>(1 + (rng() & 1));
+        guard.pendingFirst = (rng() & 1) ? static_cast<int8_t>(rng() % CARD_COUNT) : -1;
+
+    }
+    const size_t BLOCK = 4096;
+    std::vector<MoveRequest> requests(BLOCK * 64);
+    std::vector<uint32_t> clock(tables * 2, 0);
+    for (MoveRequest& request : requests){
+
+        request.table = static_cast<uint32_t>(rng() % tables);
+        request.player = static_cast<uint8_t>(1 + (rng() & 1));
+        request.row = static_cast<int8_t>(static_cast<int>(rng() % 8) - 1);             // Incluye -1, 6 y 7 fuera de Rango
+        request.column = static_cast<int8_t>(static_cast<int>(rng() % 8) - 1);
+        uint32_t& now = clock[request.table * 2 + request.player - 1];
+        now += static_cast<uint32_t>(rng() % 400);                                      // Algunos Volteos más Rápidos que un Humano
+        request.timestamp = now;
+
+    }
+
+    /// Validar por Lotes
+    uint8_t verdicts[BLOCK];
+    long long counts[6] = {0, 0, 0, 0, 0, 0};
+    auto start = std::chrono::steady_clock::now();
+    for (long long done = 0; done < moves; done += BLOCK){
+
+        size_t count = static_cast<size_t>(std::min<long long>(BLOCK, moves - done));
+        size_t offset = static_cast<size_t>((done / BLOCK) % 64) * BLOCK;
+        validateBatch(guards.data(), guards.size(), limiters.data(), requests.data() + offset, count, verdicts);
+        for (size_t i = 0; i < count; i++){
+
+            counts[0] += verdicts[i] == MOVE_OK;
+            for (int bit = 0; bit < 5; bit++) counts[bit + 1] += (verdicts[i] >> bit) & 1;
+
+        }
+
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long flagged = 0;
+    for (const RateLimiter& limiter : limiters) flagged += limiter.flagged;
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                              Validacion de Volteos                             * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Volteos: %-12lld Validaciones/s: %.0f", moves, moves / std::max(seconds, 1e-9));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Validos: %lld  Rango: %lld  Descubierta: %lld  Misma: %lld", counts[0], counts[1], counts[2], counts[3]);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Sin Turno: %lld  Rapidos: %lld  Conexiones Marcadas: %lld", counts[4], counts[5], flagged);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición del Flujo de Turnos.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchFlowMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición del Flujo de Turnos
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-flow [--games N] [--tables C] [--seed S]
+                   Conduce N Partidas entre Bots, C a la Vez, en un solo Hilo con Reloj Virtual
+    */
+
+    /// Lectura de Opciones
+    long long games = std::stoll(getOption(argc, argv, "--games", "20000"));
+    long long tables = std::stoll(getOption(argc, argv, "--tables", "10000"));
+    uint64_t seed = std::stoull(getOption(argc, argv, "--seed", "1"));
+    if (games < 1 || tables < 1) throw std::out_of_range("Partidas y Mesas deben ser Positivas");
+
+    /// Conducir
+    long long steps = 0;
+    uint64_t virtualMilliseconds = 0;
+    auto start = std::chrono::steady_clock::now();
+    driveFlows(games, static_cast<size_t>(tables), seed, steps, virtualMilliseconds);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                          Medicion del Flujo de Turnos                          * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Partidas: %lld  Mesas Simultaneas: %lld  Marco: %zu bytes", games, tables, sizeof(TurnFlow));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Reanudaciones/s: %.0f  Partidas/s: %.0f  Tiempo Simulado: %.1f h", steps / std::max(seconds, 1e-9), games / std::max(seconds, 1e-9), virtualMilliseconds / 3600000.0);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición del Entorno de Aprendizaje.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchEnvMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición del Entorno
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-env [--envs N] [--steps S] [--threads T] [--seed S]
+                   Llama a la Interfaz C igual que un Enlace desde Python y Mide Pasos de Entorno por Segundo
+    */
+
+    /// Lectura de Opciones
+    long long envs = std::stoll(getOption(argc, argv, "--envs", "65536"));
+    long long steps = std::stoll(getOption(argc, argv, "--steps", "200"));
+    int threads = std::stoi(getOption(argc, argv, "--threads", "1"));
+    uint64_t seed = std::stoull(getOption(argc, argv, "--seed", "1"));
+    if (envs < 1 || envs > std::numeric_limits<int>::max() || steps < 1 || threads < 1) throw std::out_of_range("Entornos, Pasos e Hilos deben ser Positivos");
+
+    /// Búferes del Llamador
+    size_t count = static_cast<size_t>(envs);
+    std::vector<uint64_t> seeds(count);
+    std::vector<int8_t> observations(count * OBSERVATION_SIZE);
+    std::vector<int32_t> actions(count);
+    std::vector<float> rewards(count);
+    std::vector<uint8_t> dones(count);
+    for (size_t i = 0; i < count; i++) seeds[i] = mixSeed(seed + i);
+    void* env = memorama_env_create(static_cast<int>(envs), threads);
+    memorama_env_reset(env, seeds.data(), observations.data());
+
+    /// Política de Prueba (fuera de la Medición): una Carta Boca Abajo desde una Posición Pseudoaleatoria
+    double stepSeconds = 0.0, totalReward = 0.0;
+    long long episodes = 0;
+    for (long long s = 0; s < steps; s++){
+
+        for (size_t i = 0; i < count; i++){
+
+            const int8_t* observation = observations.data() + i * OBSERVATION_SIZE;
+            int action = static_cast<int>(mixSeed(seed ^ (s * count + i)) % CARD_COUNT);
+            for (int tries = 0; tries < CARD_COUNT && observation[action] >= 0; tries++) action = (action + 1) % CARD_COUNT;
+            actions[i] = action;
+
+        }
+        auto start = std::chrono::steady_clock::now();
+        memorama_env_step(env, actions.data(), observations.data(), rewards.data(), dones.data());
+        stepSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (size_t i = 0; i < count; i++){
+
+            totalReward += rewards[i];
+            episodes += dones[i];
+
+        }
+
+    }
+    memorama_env_destroy(env);
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                       Medicion del Entorno de Aprendizaje                      * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Entornos: %lld  Pasos: %lld  Hilos: %d  Observacion: %d bytes", envs, steps, threads, OBSERVATION_SIZE);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Pasos/s: %.0f  Episodios: %lld  Recompensa Media: %.4f", envs * steps / std::max(stepSeconds, 1e-9), episodes, totalReward / (envs * steps));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función que Imprime una Cuadrícula 6x6 del Reporte de Telemetría.
+ * @param title (const char*): Título de la Cuadrícula.
+ * @param values (double*): 36 Valores en Orden de Tablero.
+ * @param format (const char*): Formato de cada Celda (p. ej. " %9.0f").
+ */
+void printHeatmap(const char* title, const double* values, const char* format){
+
+    /// Encabezado de Columnas
+    char row[160], cell[32];
+    std::snprintf(row, sizeof(row), "%-16s", title);
+    for (int c = 0; c < 6; c++){std::snprintf(cell, sizeof(cell), " %9d", c); std::strcat(row, cell);}
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    /// Una Línea por Fila
+    for (int r = 0; r < 6; r++){
+
+        std::snprintf(row, sizeof(row), "%16d", r);
+        for (int c = 0; c < 6; c++){std::snprintf(cell, sizeof(cell), format, values[r * 6 + c]); std::strcat(row, cell);}
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Reporte de Telemetría.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int heatmapMain(int argc, char* argv[]){
+
+    /*
+       - Función: Reporte de Telemetría
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --heatmap archivo.tel
+                   Frecuencia de Volteo, Errores y Tiempo de Pensar Medio por Casilla, y Tiempos por Tipo de Volteo
+    */
+
+    /// Leer Todas las Muestras
+    std::string path = getOption(argc, argv, "--heatmap", "memorama.tel");
+    std::ifstream input(path, std::ios::binary);
+    if (!input) throw std::runtime_error("No se pudo Abrir " + path);
+    double flips[CARD_COUNT] = {}, errors[CARD_COUNT] = {}, think[CARD_COUNT] = {};
+    double firstThink = 0, secondThink = 0, between = 0, firstCount = 0, secondCount = 0;
+    long long samples = 0, outOfRange = 0, inputErrors = 0, discarded = 0;
+    std::set<uint32_t> games;
+    FlipSample sample;
+    while (input.read(reinterpret_cast<char*>(&sample), sizeof(sample))){
+
+        /// Registros Corruptos o de otro Formato: la Casilla Indexa los Mapas, así que se Descartan
+        bool onBoard = sample.row >= 0 && sample.row < 6 && sample.column >= 0 && sample.column < 6;
+        if (sample.event != EVENT_RANGE && !onBoard){discarded++; continue;}
+
+        samples++;
+        games.insert(sample.game);
+        inputErrors += sample.inputErrors;
+        if (sample.event == EVENT_RANGE){outOfRange++; continue;}
+        int position = sample.row * 6 + sample.column;
+        if (sample.event == EVENT_REVEALED || sample.event == EVENT_SAME_CARD){errors[position]++; continue;}
+        if (sample.event == EVENT_NO_MATCH) errors[position]++;                  // Segunda Carta sin Pareja: Intento Fallido
+        flips[position]++;
+        think[position] += sample.thinkMicros / 1000.0;
+        if (sample.stage == 1){firstThink += sample.thinkMicros / 1000.0; firstCount++;}
+        else {secondThink += sample.thinkMicros / 1000.0; between += sample.betweenMicros / 1000.0; secondCount++;}
+
+    }
+    for (int k = 0; k < CARD_COUNT; k++) think[k] = flips[k] > 0 ? think[k] / flips[k] : 0.0;
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                              Telemetria de Volteos                             * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Partidas: %zu  Intentos: %lld  Fuera de Rango: %lld  Entradas Invalidas: %lld", games.size(), samples, outOfRange, inputErrors);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Pensar 1a: %.0f ms  Pensar 2a: %.0f ms  Entre Volteos: %.0f ms", firstThink / std::max(1.0, firstCount), secondThink / std::max(1.0, secondCount), between / std::max(1.0, secondCount));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    if (discarded > 0){
+
+        std::snprintf(row, sizeof(row), "Registros Descartados (Casilla fuera del Tablero): %lld", discarded);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    }
+    screen << "                      ********************************************************************************** \n";
+    printHeatmap("Volteos", flips, " %9.0f");
+    printHeatmap("Errores", errors, " %9.0f");
+    printHeatmap("Pensar (ms)", think, " %9.0f");
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Generación de Tablas de Finales.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int buildTablebaseMain(int argc, char* argv[]){
+
+    /*
+       - Función: Generación de Tablas
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --build-tablebase [archivo.tb]
+                   Escribe las Tablas, las Vuelve a Proyectar y Mide Construcción, Apertura y Consulta
+    */
+
+    /// Construir y Escribir
+    std::string path = getOption(argc, argv, "--build-tablebase", TABLEBASE_PATH);
+    auto start = std::chrono::steady_clock::now();
+    writeTablebase(path);
+    double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Volver a Proyectar el Archivo Escrito
+    if (tablebaseFile.data) unmapFile(tablebaseFile);
+    start = std::chrono::steady_clock::now();
+    if (!openTablebase(path)) throw std::runtime_error("Tablas Invalidas: " + path);
+    double openSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Consultas Aleatorias
+    const int QUERIES = 10000000;
+    std::mt19937_64 rng(1);
+    std::vector<uint8_t> queries(4096);
+    for (uint8_t& query : queries) query = static_cast<uint8_t>(rng() % TABLEBASE_ENTRIES);
+    double checksum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; i++) checksum += tablebase[queries[i & 4095]].value;
+    double querySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Posiciones donde Conviene no Revelar
+    int singleFirst = 0, singleSecond = 0, passing = 0;
+    for (int n = 1; n <= PAIR_COUNT; n++){
+
+        for (int k = 0; k <= n; k++){
+
+            const TablebaseEntry& entry = tablebase[tablebaseIndex(n, k)];
+            singleFirst += entry.firstSingle > entry.firstUnknown;
+            singleSecond += entry.secondSingle > entry.secondUnknown;
+            passing += k >= 2 && entry.value < -1e-6f;                      // Pasar (Fuera del Modelo) Daría al menos 0
+
+        }
+
+    }
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                               Tablas de Finales                                * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Archivo: %s  Entradas: %d  Bytes: %zu", path.c_str(), TABLEBASE_ENTRIES, tablebaseFile.size);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Construccion: %.0f us  Apertura: %.1f us  Consulta: %.2f ns  (%.0f)", buildSeconds * 1e6, openSeconds * 1e6, querySeconds * 1e9 / QUERIES, checksum);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Ventaja de quien Abre (18 Pares): %+.4f", tablebase[tablebaseIndex(PAIR_COUNT, 0)].value);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Posiciones donde Conviene Abrir con Suelta: %d  Segunda Suelta: %d", singleFirst, singleSecond);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Posiciones donde Pasar Mejoraria (sin Modelar): %d", passing);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Coordinador de Simulación Distribuida.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int coordinateMain(int argc, char* argv[]){
+
+    /*
+       - Función: Coordinador
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --coordinate <partidas> [--seed S] [--strategies e1,e2[:e3,e4...]] [--rules variante]
+                            [--unit-size U] [--lease-seconds L] [--bind host] [--port P] [--spawn W]
+                   Reparte Unidades de (Enfrentamiento x Rango de Semillas) a Procesos memorama --work, Locales
+                   (--spawn) o en otros Equipos, e Imprime el Resumen de cada Enfrentamiento
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("La Simulacion Distribuida no esta Disponible en Windows");
+    #else
+
+        /// Lectura de Opciones
+        DistributedJob job;
+        readSearchSettings(argc, argv);
+        job.games = std::stoll(getOption(argc, argv, "--coordinate", "1000000"));
+        job.baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+        job.unitSize = std::stoll(getOption(argc, argv, "--unit-size", "65536"));
+        job.leaseSeconds = std::stoi(getOption(argc, argv, "--lease-seconds", "30"));
+        job.rules = findRuleVariant(getOption(argc, argv, "--rules", RULE_VARIANTS[0].name));
+        std::string host = getOption(argc, argv, "--bind", "127.0.0.1");
+        int port = std::stoi(getOption(argc, argv, "--port", "0"));
+        int spawn = std::stoi(getOption(argc, argv, "--spawn", "0"));
+        if (job.games < 1 || job.unitSize < 1) throw std::out_of_range("Partidas y Tamano de Unidad deben ser Positivos");
+        if (job.leaseSeconds < 1 || spawn < 0) throw std::out_of_range("Prestamo y Trabajadores no pueden ser Negativos");
+
+        /// Enfrentamientos Separados por ':'
+        std::stringstream list(getOption(argc, argv, "--strategies", "memoria,memoria"));
+        std::string names;
+        while (std::getline(list, names, ':')){
+
+            size_t comma = names.find(',');
+            job.matchups.push_back({findStrategy(names.substr(0, comma)), findStrategy(comma == std::string::npos ? names : names.substr(comma + 1))});
+
+        }
+        if (job.matchups.empty()) throw std::invalid_argument("Sin Enfrentamientos");
+
+        /// Escuchar y Anunciar la Dirección (para Trabajadores Remotos)
+        int boundPort = 0;
+        int listener = listenTcp(host, port, boundPort);
+        std::string address = (host == "0.0.0.0" || host == "::" ? std::string("127.0.0.1") : host) + ":" + std::to_string(boundPort);
+        char row[160];
+        std::snprintf(row, sizeof(row), "Coordinador en %s:%d   Unidades: %lld   Trabajadores Locales: %d", host.c_str(), boundPort, static_cast<long long>(job.matchups.size()) * ((job.games + job.unitSize - 1) / job.unitSize), spawn);
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        presentFrame();
+
+        /// Trabajadores Locales: el mismo Ejecutable en Modo --work
+        signal(SIGPIPE, SIG_IGN);
+        std::vector<pid_t> children;
+        for (int w = 0; w < spawn; w++){
+
+            pid_t child = fork();
+            if (child == 0){
+
+                close(listener);
+                #ifdef __linux__
+                    execl("/proc/self/exe", argv[0], "--work", address.c_str(), static_cast<char*>(nullptr));
+                #endif
+                execlp(argv[0], argv[0], "--work", address.c_str(), static_cast<char*>(nullptr));
+                _exit(127);
+
+            }
+            if (child > 0) children.push_back(child);
+
+        }
+
+        /// Coordinar hasta Combinar todas las Unidades
+        auto start = chrono::steady_clock::now();
+        coordinateJob(job, listener);
+        double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        close(listener);
+        for (pid_t child : children) waitpid(child, nullptr, 0);
+
+        /// Resumen de cada Enfrentamiento
+        for (size_t m = 0; m < job.matchups.size(); m++){
+
+            std::snprintf(row, sizeof(row), "Enfrentamiento: %s contra %s   Reglas: %s", STRATEGIES[job.matchups[m][0]].name, STRATEGIES[job.matchups[m][1]].name, RULE_VARIANTS[job.rules].name);
+            screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+            printSummary(job.summaries[m]);
+
+        }
+
+        /// Reporte de la Distribución
+        long long total = job.games * static_cast<long long>(job.matchups.size());
+        std::snprintf(row, sizeof(row), "Partidas: %lld   Tiempo: %.2f s   Partidas/s: %.0f", total, elapsed, total / std::max(elapsed, 1e-9));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Conexiones: %lld   Reasignadas: %lld   Duplicadas Descartadas: %lld", job.workers, job.releases, job.duplicates);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Trabajador de Simulación Distribuida.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int workMain(int argc, char* argv[]){
+
+    /*
+       - Función: Trabajador
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --work <host:puerto>
+                   Pide Unidades al Coordinador hasta que no Quede Trabajo
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("La Simulacion Distribuida no esta Disponible en Windows");
+    #else
+
+        /// Trabajar sin Pantalla (el Coordinador Imprime el Resumen)
+        runWorker(getOption(argc, argv, "--work", "127.0.0.1:7777"));
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Elige el Directorio del Sitio (--root, o el del Ejecutable; Nunca el de Trabajo por Omisión).
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (std::string) El Directorio Raíz.
+ * @throw std::runtime_error Si el Directorio no Contiene index.html.
+ */
+std::string siteRoot(int argc, char* argv[]){
+
+    /// Directorio Pedido o el que Contiene al Ejecutable
+    std::string root = getOption(argc, argv, "--root", "");
+    if (root.empty()){
+
+        std::error_code error;
+        std::filesystem::path executable = std::filesystem::canonical("/proc/self/exe", error);
+        if (error) executable = std::filesystem::absolute(argv[0], error);
+        root = executable.parent_path().string();
+
+    }
+
+    /// El Sitio debe Estar Ahí
+    if (!std::filesystem::is_regular_file(root + "/index.html")) throw std::runtime_error("No se Encontro index.html en " + root + " (use --root directorio)");
+    return root;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Servidor Web.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int serveMain(int argc, char* argv[]){
+
+    /*
+       - Función: Servidor Web
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --serve [puerto] [--root directorio] [--bind host] [--shards N]
+                   Sirve el Sitio (index.html, css, js, imgs) y Partidas en /ws hasta Interrumpirse, con
+                   un Ciclo por Shard (Uno por Defecto)
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("El Servidor Web no esta Disponible en Windows");
+    #else
+
+        /// Escuchar solo en este Equipo salvo que se Pida otra Dirección
+        std::string root = siteRoot(argc, argv);
+        std::string host = getOption(argc, argv, "--bind", "127.0.0.1");
+        std::string port = getOption(argc, argv, "--serve", "8080");
+        if (port.rfind("--", 0) == 0) port = "8080";                                       // --serve sin Puerto
+        int shards = std::stoi(getOption(argc, argv, "--shards", "1"));
+        if (shards < 1 || shards > 256) throw std::out_of_range("El Numero de Shards debe estar entre 1 y 256");
+        signal(SIGPIPE, SIG_IGN);
+        ShardedServer sharded;
+        startShards(sharded, shards, host, std::stoi(port), root, static_cast<uint64_t>(time(0)));
+
+        /// Anunciar y Servir hasta Interrumpirse
+        char row[160];
+        screen << "                      ********************************************************************************** \n";
+        std::snprintf(row, sizeof(row), "Sirviendo %s en http://%s:%d/   Partidas en /ws", root.c_str(), host.c_str(), sharded.port);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Shards: %d (un Hilo y un Socket de Escucha cada uno)", shards);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        presentFrame();
+        for (std::thread& thread : sharded.threads) thread.join();                          // Hasta Interrumpirse
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Prueba de Carga del Servidor Web.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchServeMain(int argc, char* argv[]){
+
+    /*
+       - Función: Prueba de Carga Web
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-serve [--sessions N] [--seconds S] [--think ms] [--requests R] [--shards N] [--root directorio]
+                   Levanta el Servidor en un Puerto Libre de 127.0.0.1; Mide Peticiones/s de index.html Completas
+                   y Revalidadas (304), y luego Abre N Sesiones WebSocket que Voltean Cartas al Azar cada
+                   --think ms, Reportando Volteos/s y Latencia Volteo-Respuesta. Sin --shards Repite la Fase
+                   WebSocket con 1, 2, 4... Shards hasta Todos los Núcleos; el Generador de Carga Usa un Hilo
+                   por Núcleo en todas las Configuraciones
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("El Servidor Web no esta Disponible en Windows");
+    #else
+
+        /// Lectura de Opciones
+        int sessions = std::stoi(getOption(argc, argv, "--sessions", "1000"));
+        double duration = std::stod(getOption(argc, argv, "--seconds", "5"));
+        int think = std::stoi(getOption(argc, argv, "--think", "50"));
+        int requests = std::stoi(getOption(argc, argv, "--requests", "2000"));
+        if (sessions < 1 || duration <= 0 || think < 0 || requests < 1) throw std::out_of_range("Parametros de la Prueba Invalidos");
+
+        /// Cliente y Servidor en este Proceso: Subir el Límite de Descriptores
+        rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max){
+
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+
+        }
+
+        /// Configuraciones: --shards N, o 1, 2, 4... hasta Todos los Núcleos
+        int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        int fixed = std::stoi(getOption(argc, argv, "--shards", "0"));
+        if (fixed < 0 || fixed > 256) throw std::out_of_range("El Numero de Shards debe estar entre 1 y 256");
+        std::vector<int> counts;
+        if (fixed > 0) counts.push_back(fixed);
+        else {for (int count = 1; count < cores; count *= 2) counts.push_back(count); counts.push_back(cores);}
+        std::string root = siteRoot(argc, argv);
+        signal(SIGPIPE, SIG_IGN);
+
+        /// Fase HTTP (Primera Configuración): una Conexión Persistente, Respuestas Completas y luego Revalidaciones
+        ShardedServer sharded;
+        startShards(sharded, counts[0], "127.0.0.1", 0, root, 1);
+        std::string address = "127.0.0.1:" + std::to_string(sharded.port);
+        int descriptor = connectTcp(address);
+        std::string buffer, etag;
+        long long bytes = 0;
+        auto fetch = [&](const std::string& condition){
+
+            std::string request = "GET / HTTP/1.1\r\nHost: " + address + "\r\n" + condition + "\r\n";
+            if (!writeExactly(descriptor, request.data(), request.size())) return 0;
+            size_t end;
+            while ((end = buffer.find("\r\n\r\n")) == std::string::npos){
+
+                char chunk[65536];
+                ssize_t received = read(descriptor, chunk, sizeof(chunk));
+                if (received <= 0) return 0;
+                buffer.append(chunk, static_cast<size_t>(received));
+
+            }
+            std::string head = buffer.substr(0, end);
+            size_t field = head.find("Content-Length: "), tag = head.find("ETag: ");
+            size_t length = field == std::string::npos ? 0 : std::stoul(head.substr(field + 16));
+            if (tag != std::string::npos) etag = head.substr(tag + 6, head.find("\r\n", tag) - tag - 6);
+            while (buffer.size() < end + 4 + length){
+
+                char chunk[65536];
+                ssize_t received = read(descriptor, chunk, sizeof(chunk));
+                if (received <= 0) return 0;
+                buffer.append(chunk, static_cast<size_t>(received));
+
+            }
+            bytes += static_cast<long long>(length);
+            buffer.erase(0, end + 4 + length);
+            return std::stoi(head.substr(9, 3));
+
+        };
+        double rates[2] = {0, 0};
+        int statuses[2] = {0, 0};
+        for (int phase = 0; phase < 2; phase++){
+
+            auto start = chrono::steady_clock::now();
+            for (int r = 0; r < requests; r++) statuses[phase] = fetch(phase ? "If-None-Match: " + etag + "\r\n" : "");
+            rates[phase] = requests / std::max(chrono::duration<double>(chrono::steady_clock::now() - start).count(), 1e-9);
+
+        }
+        close(descriptor);
+
+        /// Fase WebSocket: cada Hilo del Generador Conduce su Parte de las Sesiones
+        struct LoadSession {
+
+            int descriptor = -1;                 // Socket de la Sesión
+            std::string inbox;                   // Bytes Recibidos
+            bool open = false;                   // Saludo Completado
+            bool waiting = false;                // Volteo sin Respuesta
+            chrono::steady_clock::time_point sentAt, nextAt;
+
+        };
+        struct LoadResult {
+
+            std::vector<double> latencies;       // Latencia de cada Volteo Respondido (ms)
+            long long frames = 0;                // Mensajes Recibidos
+            long long established = 0;           // Saludos Completados
+            double seconds = 0;                  // Duración de la Medición
+
+        };
+        auto drive = [&](int count, uint64_t seed, LoadResult& result){
+
+            std::vector<LoadSession> clients(count);
+            std::mt19937_64 rng(seed);
+            const std::string handshake = "GET /ws HTTP/1.1\r\nHost: " + address + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n"
+                                          + std::string("\x82\x82\0\0\0\0", 6) + static_cast<char>(MESSAGE_JOIN) + '\x02';     // Saludo de Juego: Ambos Asientos (Máscara Cero)
+            for (LoadSession& client : clients){
+
+                client.descriptor = connectTcp(address);
+                writeExactly(client.descriptor, handshake.data(), handshake.size());
+                fcntl(client.descriptor, F_SETFL, fcntl(client.descriptor, F_GETFL) | O_NONBLOCK);
+
+            }
+            std::vector<pollfd> descriptors(clients.size());
+            auto start = chrono::steady_clock::now(), stop = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(duration));
+            while (chrono::steady_clock::now() < stop){
+
+                for (size_t i = 0; i < clients.size(); i++) descriptors[i] = {clients[i].descriptor, POLLIN, 0};
+                poll(descriptors.data(), descriptors.size(), 5);
+                auto now = chrono::steady_clock::now();
+                for (size_t i = 0; i < clients.size(); i++){
+
+                    /// Recibir: Saludo y luego Mensajes sin Máscara
+                    LoadSession& client = clients[i];
+                    if (descriptors[i].revents & POLLIN){
+
+                        char chunk[16384];
+                        ssize_t received = recv(client.descriptor, chunk, sizeof(chunk), MSG_DONTWAIT);
+                        if (received > 0) client.inbox.append(chunk, static_cast<size_t>(received));
+
+                    }
+                    if (!client.open){
+
+                        size_t end = client.inbox.find("\r\n\r\n");
+                        if (end == std::string::npos) continue;
+                        client.inbox.erase(0, end + 4);
+                        client.open = true;
+                        result.established++;
+
+                    }
+                    while (client.inbox.size() >= 2){
+
+                        size_t size = static_cast<uint8_t>(client.inbox[1]) & 0x7F, header = 2;
+                        if (size == 126){
+
+                            if (client.inbox.size() < 4) break;
+                            size = static_cast<size_t>(static_cast<uint8_t>(client.inbox[2])) << 8 | static_cast<uint8_t>(client.inbox[3]);
+                            header = 4;
+
+                        }
+                        if (client.inbox.size() < header + size) break;
+                        if (size > 0 && client.inbox[header] == MESSAGE_REPLY && client.waiting){
+
+                            result.latencies.push_back(chrono::duration<double, std::milli>(now - client.sentAt).count());
+                            client.waiting = false;
+                            client.nextAt = now + chrono::milliseconds(think);
+
+                        }
+                        result.frames++;
+                        client.inbox.erase(0, header + size);
+
+                    }
+
+                    /// Voltear una Carta al Azar (Enmascarada como Manda el Protocolo; 255 Reparte al Terminar)
+                    if (client.open && !client.waiting && now >= client.nextAt){
+
+                        uint8_t mask[4], position = static_cast<uint8_t>(rng() % 37);
+                        for (uint8_t& byte : mask) byte = static_cast<uint8_t>(rng());
+                        uint8_t frame[7] = {0x82, 0x81, mask[0], mask[1], mask[2], mask[3], static_cast<uint8_t>((position == 36 ? 255 : position) ^ mask[0])};
+                        if (send(client.descriptor, frame, sizeof(frame), MSG_NOSIGNAL | MSG_DONTWAIT) == static_cast<ssize_t>(sizeof(frame))){
+
+                            client.waiting = true;
+                            client.sentAt = now;
+
+                        }
+
+                    }
+
+                }
+
+            }
+            result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            for (LoadSession& client : clients) close(client.descriptor);
+
+        };
+
+        /// Encabezado del Reporte
+        char row[160];
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *                         Prueba de Carga del Servidor Web                       * \n";
+        screen << "                      ********************************************************************************** \n";
+        std::snprintf(row, sizeof(row), "GET / (%d): %.0f pet/s   Revalidado (%d): %.0f pet/s   %lld KB", statuses[0], rates[0], statuses[1], rates[1], bytes / 1024);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Sesiones: %d   Piensan: %d ms   Hilos del Generador: %d   Nucleos: %d", sessions, think, std::min(cores, sessions), cores);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "%-6s %8s %11s %10s %7s %7s %7s", "Shards", "Abiertas", "Por Shard", "Volteos/s", "p50 ms", "p99 ms", "Acel.");
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+        /// Cada Configuración con Shards Nuevos (la Primera ya Está Arriba)
+        double baseline = 0;
+        long long throttled = 0;
+        for (size_t c = 0; c < counts.size(); c++){
+
+            if (c > 0){
+
+                startShards(sharded, counts[c], "127.0.0.1", 0, root, 1);
+                address = "127.0.0.1:" + std::to_string(sharded.port);
+
+            }
+            int drivers = std::min(cores, sessions);
+            std::vector<LoadResult> results(drivers);
+            std::vector<std::thread> pool;
+            for (int d = 0; d < drivers; d++) pool.emplace_back(drive, sessions / drivers + (d < sessions % drivers), 7 + d, std::ref(results[d]));
+            for (std::thread& thread : pool) thread.join();
+
+            /// Reparto de Sesiones entre Shards y Pausa del Servidor
+            long long fewest = std::numeric_limits<long long>::max(), most = 0;
+            for (std::unique_ptr<WebServer>& server : sharded.shards){
+
+                fewest = std::min(fewest, server->sessions.load());
+                most = std::max(most, server->sessions.load());
+                throttled += server->throttled;
+
+            }
+            stopShards(sharded);
+
+            /// Fila de la Configuración
+            std::vector<double> latencies;
+            long long established = 0;
+            double rate = 0;
+            for (LoadResult& result : results){
+
+                latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+                established += result.established;
+                rate += result.latencies.size() / std::max(result.seconds, 1e-9);
+
+            }
+            std::sort(latencies.begin(), latencies.end());
+            auto percentile = [&](double p){return latencies.empty() ? 0.0 : latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];};
+            if (c == 0) baseline = rate;
+            char spread[32];
+            std::snprintf(spread, sizeof(spread), "%lld-%lld", fewest, most);
+            std::snprintf(row, sizeof(row), "%-6d %8lld %11s %10.0f %7.2f %7.2f %6.2fx", counts[c], established, spread, rate, percentile(0.5), percentile(0.99), rate / std::max(baseline, 1e-9));
+            screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+            presentFrame();
+
+        }
+        std::snprintf(row, sizeof(row), "Volteos Descartados por Ritmo no Humano: %lld", throttled);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Prueba de Carga del Emparejamiento.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchMatchMain(int argc, char* argv[]){
+
+    /*
+       - Función: Prueba de Emparejamiento
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-match [--joins N] [--rate R] [--shards N] [--root directorio]
+                   Levanta el Servidor en un Puerto Libre de 127.0.0.1 y Abre N Conexiones WebSocket que
+                   Piden Rival, R por Segundo Repartidas en un Hilo por Núcleo; Mide el Tiempo desde el
+                   Saludo de Juego hasta Recibir el Asiento (Cliente), el Tiempo en Cola y la Mayor
+                   Profundidad de la Cola (Servidor)
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("El Servidor Web no esta Disponible en Windows");
+    #else
+
+        /// Lectura de Opciones (Uniones en Número Par: Todas Tienen Rival)
+        int joins = std::stoi(getOption(argc, argv, "--joins", "4000"));
+        double rate = std::stod(getOption(argc, argv, "--rate", "4000"));
+        int shards = std::stoi(getOption(argc, argv, "--shards", "1"));
+        if (joins < 2 || rate <= 0 || shards < 1 || shards > 256) throw std::out_of_range("Parametros de la Prueba Invalidos");
+        joins += joins % 2;
+
+        /// Cliente y Servidor en este Proceso: Subir el Límite de Descriptores
+        rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max){
+
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+
+        }
+
+        /// Servidor
+        signal(SIGPIPE, SIG_IGN);
+        ShardedServer sharded;
+        startShards(sharded, shards, "127.0.0.1", 0, siteRoot(argc, argv), 1);
+        std::string address = "127.0.0.1:" + std::to_string(sharded.port);
+
+        /// Cada Hilo Abre las Uniones j = d, d + hilos, ... en su Momento (j / R Segundos)
+        struct Joiner {
+
+            int descriptor = -1;                 // Socket de la Conexión
+            std::string inbox;                   // Bytes Recibidos
+            bool open = false;                   // Saludo HTTP Completado
+            bool done = false;                   // Recibió su Asiento o un Cierre
+            chrono::steady_clock::time_point sentAt;
+
+        };
+        struct JoinResult {
+
+            std::vector<double> waits;           // Saludo de Juego a Asiento (ms)
+            long long refused = 0;               // Cerradas sin Asiento
+            chrono::steady_clock::time_point lastSent;
+
+        };
+        const std::string request = "GET /ws HTTP/1.1\r\nHost: " + address + "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n"
+                                    + std::string("\x82\x82\0\0\0\0", 6) + static_cast<char>(MESSAGE_JOIN) + '\x01';     // Saludo de Juego: un Asiento (Máscara Cero)
+        int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        int drivers = std::min(cores, joins);
+        auto start = chrono::steady_clock::now() + chrono::milliseconds(20);
+        auto arrival = [&](int j){return start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(j / rate));};
+        auto deadline = arrival(joins) + chrono::seconds(5);
+        auto drive = [&](int d, JoinResult& result){
+
+            std::vector<Joiner> joiners;
+            std::vector<pollfd> descriptors;
+            size_t finished = 0, mine = static_cast<size_t>((joins - d + drivers - 1) / drivers);
+            while (finished < mine && chrono::steady_clock::now() < deadline){
+
+                /// Llegadas cuyo Momento ya Pasó
+                auto now = chrono::steady_clock::now();
+                while (joiners.size() < mine && now >= arrival(d + static_cast<int>(joiners.size()) * drivers)){
+
+                    Joiner joiner;
+                    joiner.descriptor = connectTcp(address);
+                    joiner.sentAt = result.lastSent = chrono::steady_clock::now();
+                    writeExactly(joiner.descriptor, request.data(), request.size());
+                    fcntl(joiner.descriptor, F_SETFL, fcntl(joiner.descriptor, F_GETFL) | O_NONBLOCK);
+                    joiners.push_back(std::move(joiner));
+
+                }
+
+                /// Esperar Respuestas
+                descriptors.resize(joiners.size());
+                for (size_t i = 0; i < joiners.size(); i++) descriptors[i] = {joiners[i].done ? -1 : joiners[i].descriptor, POLLIN, 0};
+                poll(descriptors.data(), descriptors.size(), 1);
+                now = chrono::steady_clock::now();
+                for (size_t i = 0; i < joiners.size(); i++){
+
+                    Joiner& joiner = joiners[i];
+                    if (joiner.done || !(descriptors[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+                    char chunk[4096];
+                    ssize_t received = recv(joiner.descriptor, chunk, sizeof(chunk), MSG_DONTWAIT);
+                    if (received > 0) joiner.inbox.append(chunk, static_cast<size_t>(received));
+                    else if (received == 0){joiner.done = true; result.refused++; finished++; continue;}
+                    if (!joiner.open){
+
+                        size_t end = joiner.inbox.find("\r\n\r\n");
+                        if (end == std::string::npos) continue;
+                        joiner.inbox.erase(0, end + 4);
+                        joiner.open = true;
+
+                    }
+
+                    /// El Primer Mensaje con Rival es el Asiento; un Cierre es Rechazo
+                    if (joiner.inbox.size() >= 3){
+
+                        uint8_t opcode = static_cast<uint8_t>(joiner.inbox[0]) & 0x0F;
+                        if (opcode == 0x2 && static_cast<uint8_t>(joiner.inbox[2]) == MESSAGE_SEAT) result.waits.push_back(chrono::duration<double, std::milli>(now - joiner.sentAt).count());
+                        else result.refused++;
+                        joiner.done = true;
+                        finished++;
+
+                    }
+
+                }
+
+            }
+            for (Joiner& joiner : joiners) close(joiner.descriptor);
+
+        };
+        std::vector<JoinResult> results(drivers);
+        std::vector<std::thread> pool;
+        for (int d = 0; d < drivers; d++) pool.emplace_back(drive, d, std::ref(results[d]));
+        for (std::thread& thread : pool) thread.join();
+        stopShards(sharded);
+
+        /// Reporte
+        std::vector<double> seated;
+        long long refused = 0;
+        auto lastSent = start;
+        for (JoinResult& result : results){
+
+            seated.insert(seated.end(), result.waits.begin(), result.waits.end());
+            refused += result.refused;
+            lastSent = std::max(lastSent, result.lastSent);
+
+        }
+        Matchmaker& matchmaker = *sharded.matchmaker;
+        std::sort(seated.begin(), seated.end());
+        std::sort(matchmaker.waits.begin(), matchmaker.waits.end());
+        auto percentile = [](const std::vector<double>& values, double p){return values.empty() ? 0.0 : values[std::min(values.size() - 1, static_cast<size_t>(p * values.size()))];};
+        char row[160];
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *                        Prueba de Carga del Emparejamiento                      * \n";
+        screen << "                      ********************************************************************************** \n";
+        std::snprintf(row, sizeof(row), "Uniones: %d   Pedidas: %.0f/s   Logradas: %.0f/s   Shards: %d   Hilos: %d", joins, rate, (joins - 1) / std::max(chrono::duration<double>(lastSent - start).count(), 1e-9), shards, drivers);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Sentadas: %zu   Parejas: %lld   Rechazadas: %lld   Abandonos: %lld", seated.size(), matchmaker.matched.load(), refused, matchmaker.abandoned.load());
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Mayor Profundidad de la Cola: %lld   Sin Lugar (1013): %lld", matchmaker.deepest.load(), matchmaker.rejected.load());
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Tiempo en Cola (ms)        p50: %6.2f   p99: %6.2f   Max: %6.2f", percentile(matchmaker.waits, 0.5), percentile(matchmaker.waits, 0.99), matchmaker.waits.empty() ? 0.0 : matchmaker.waits.back());
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Saludo hasta Asiento (ms)  p50: %6.2f   p99: %6.2f   Max: %6.2f", percentile(seated, 0.5), percentile(seated, 0.99), seated.empty() ? 0.0 : seated.back());
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función Principal del Reproductor de Grabaciones.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int playMain(int argc, char* argv[]){
+
+    /*
+       - Función: Reproductor
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --play F [--speed N]
+                   Reproduce una Grabación con sus Tiempos Originales, N Veces más Rápido o sin Esperas (N = 0)
+    */
+
+    /// Lectura de Opciones
+    std::string path = getOption(argc, argv, "--play", "memorama.mrec");
+    double speed = std::stod(getOption(argc, argv, "--speed", "1"));
+    if (!(speed >= 0)) throw std::out_of_range("La Velocidad no puede ser Negativa");
+
+    /// Reproducir (los Cuadros Ya Traen su Sangría y Colores)
+    playRecording(path, speed);
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de la Grabación.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchRecordMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de la Grabación
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-record [--frames N] [--fps R] [--output F]
+                   Compone y Escribe (a /dev/null) R Cuadros por Segundo de una Partida que Avanza, sin y con Grabación,
+                   Midiendo el Tiempo de CPU del Hilo que Dibuja; Reporta el Costo Agregado por Cuadro contra lo que Cuesta
+                   Dibujarlo y, Aparte, contra el Periodo del Cuadro (la Meta de 1%), el del Hilo de Codificación, la
+                   Compresión, y Verifica que el Reproductor Recupere los Mismos Bytes
+    */
+
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("La Medicion de la Grabacion no esta Disponible en Windows");
+    #else
+
+        /// Lectura de Opciones
+        long long frames = std::stoll(getOption(argc, argv, "--frames", "2000"));
+        double rate = std::stod(getOption(argc, argv, "--fps", "500"));
+        std::string path = getOption(argc, argv, "--output", (std::filesystem::temp_directory_path() / "memorama-bench.mrec").string());
+        if (frames < 1) throw std::out_of_range("El Numero de Cuadros debe ser Positivo");
+        if (!(rate > 0)) throw std::out_of_range("Los Cuadros por Segundo deben ser Positivos");
+        auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / rate));
+
+        /// Partida de Muestra: cada Cuadro Destapa o Tapa una Carta y a Veces Cambian Turno y Puntos
+        std::vector<std::string> playersNames = {"Jugador 1", "Jugador 2"};
+        std::vector<std::vector<std::string>> visibleCards(6, std::vector<std::string>(6, "X"));
+        auto advance = [&](long long f, int points[2], int& turn){
+
+            int k = static_cast<int>((f * 7) % CARD_COUNT);
+            std::string& card = visibleCards[k / 6][k % 6];
+            card = (card == "X") ? std::string(1, static_cast<char>('A' + k / 2)) : "X";
+            if (f % 5 == 0) turn = 3 - turn;
+            if (f % 11 == 0) points[turn - 1] = (points[turn - 1] + 1) % PAIR_COUNT;
+
+        };
+
+        /// Tiempo de CPU del Hilo Actual (el Hilo de Codificación no Cuenta)
+        auto threadNanos = [](){
+
+            timespec now;
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+            return static_cast<double>(now.tv_sec) * 1e9 + static_cast<double>(now.tv_nsec);
+
+        };
+
+        /// Salida a /dev/null Mientras se Mide
+        std::fflush(stdout);
+        int saved = dup(STDOUT_FILENO);
+        int sink = open("/dev/null", O_WRONLY);
+        if (saved < 0 || sink < 0) throw std::runtime_error("No se pudo Redirigir la Salida");
+        dup2(sink, STDOUT_FILENO);
+        close(sink);
+
+        /// Pasadas Alternadas (la Mejor de Cada Modo), la Última Grabación se Conserva
+        double plain = 1e300, recorded = 1e300;
+        uint64_t written = 0;
+        uint64_t writtenHash = 14695981039346656037ULL;
+        RecordStats stats;
+        for (int pass = 0; pass < 4; pass++){
+
+            bool recording = (pass % 2 == 1);
+            if (recording) startRecording(path);
+            for (auto& row : visibleCards) std::fill(row.begin(), row.end(), "X");
+            int points[2] = {0, 0}, turn = 1;
+            bool last = (pass == 3);
+            auto tick = std::chrono::steady_clock::now();
+            double spent = 0;
+            for (long long f = 0; f < frames; f++){
+
+                tick += period;
+                std::this_thread::sleep_until(tick);
+                advance(f, points, turn);
+                double began = threadNanos();
+                printGame(points[0], points[1], turn, visibleCards, playersNames, nullptr);
+                if (last){
+
+                    written += screen.data.size();
+                    for (unsigned char byte : screen.data) writtenHash = (writtenHash ^ byte) * 1099511628211ULL;
+
+                }
+                presentFrame();
+                spent += threadNanos() - began;
+
+            }
+            spent /= frames;
+            if (recording){
+
+                recorded = std::min(recorded, spent);
+                stats = stopRecording();
+
+            }
+            else plain = std::min(plain, spent);
+
+        }
+
+        /// Reproducir sin Esperas Capturando los Bytes
+        int pipes[2];
+        if (pipe(pipes) != 0) throw std::runtime_error("No se pudo Crear la Tuberia");
+        uint64_t replayed = 0, replayedHash = 14695981039346656037ULL;
+        std::thread reader([&](){
+
+            char chunk[65536];
+            ssize_t got;
+            while ((got = read(pipes[0], chunk, sizeof(chunk))) > 0){
+
+                replayed += static_cast<uint64_t>(got);
+                for (ssize_t k = 0; k < got; k++) replayedHash = (replayedHash ^ static_cast<unsigned char>(chunk[k])) * 1099511628211ULL;
+
+            }
+
+        });
+        dup2(pipes[1], STDOUT_FILENO);
+        close(pipes[1]);
+        uint64_t played = 0;
+        std::string failure;
+        try {
+
+            played = playRecording(path, 0);
+
+        }
+        catch (const std::exception& error){
+
+            failure = error.what();
+
+        }
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+        reader.join();
+        close(pipes[0]);
+        std::filesystem::remove(path);
+        if (!failure.empty()) throw std::runtime_error(failure);
+
+        /// Reporte
+        uint64_t totalLines = stats.kinds[0] + stats.kinds[1] + stats.kinds[2] + stats.kinds[3];
+        char row[160];
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *                              Grabacion de Sesiones                             * \n";
+        screen << "                      ********************************************************************************** \n";
+        std::snprintf(row, sizeof(row), "CPU por Cuadro (%.0f/s): %.0f ns sin Grabar, %.0f ns Grabando", rate, plain, recorded);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Costo sobre el Dibujo: %+.0f ns por Cuadro = %+.1f%%", recorded - plain, 100.0 * (recorded - plain) / plain);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Meta < 1%% (Relativa al Periodo de %.0f us, no al Dibujo): %+.3f%%", 1e6 / rate, 100.0 * (recorded - plain) * rate / 1e9);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Hilo de Codificacion: %.0f ns por Cuadro (Fuera del Hilo que Dibuja)", 1000.0 * stats.encodeMicros / std::max<uint64_t>(1, stats.frames));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Bytes: %llu -> %llu (x%.0f)   %.1f Bytes por Cuadro", static_cast<unsigned long long>(stats.rawBytes), static_cast<unsigned long long>(stats.storedBytes), static_cast<double>(stats.rawBytes) / std::max<uint64_t>(1, stats.storedBytes), static_cast<double>(stats.storedBytes) / std::max<uint64_t>(1, stats.frames));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Lineas: %.1f%% Iguales  %.1f%% Diccionario  %.1f%% Diferencias  %.1f%% Literales", 100.0 * stats.kinds[LINE_SAME] / std::max<uint64_t>(1, totalLines), 100.0 * stats.kinds[LINE_SHARED] / std::max<uint64_t>(1, totalLines), 100.0 * stats.kinds[LINE_DIFF] / std::max<uint64_t>(1, totalLines), 100.0 * stats.kinds[LINE_LITERAL] / std::max<uint64_t>(1, totalLines));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        bool identical = (played == stats.frames && replayed == written && replayedHash == writtenHash);
+        std::snprintf(row, sizeof(row), "Reproduccion: %llu Cuadros, %s", static_cast<unsigned long long>(played), identical ? "Bytes Identicos" : "BYTES DISTINTOS");
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        return identical ? 0 : 1;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de los Relojes de Turno.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchClockMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de los Relojes
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-clock [--tables N] [--seconds S] [--bank ms] [--increment ms] [--think ms] [--load us] [--seed S]
+                   N Mesas de Bots con Reloj en un solo Hilo: cada Mesa tiene un timerfd para su Bandera y otro para la
+                   Próxima Carta del Bot, Todos en un epoll. Cada Carta se Cobra en su Instante Programado (no en el de
+                   su Proceso) y --load Simula Trabajo por Evento; se Reporta cuánto Tarda en Detectarse una Bandera y
+                   cuánto se Habría Cobrado de Más al Cobrar en el Momento de Procesar
+    */
+
+    #ifndef __linux__
+        (void)argc; (void)argv;
+        throw std::runtime_error("La Medicion de los Relojes Requiere timerfd (Linux)");
+    #else
+
+        /// Lectura de Opciones
+        long long tables = std::stoll(getOption(argc, argv, "--tables", "1000"));
+        double duration = std::stod(getOption(argc, argv, "--seconds", "5"));
+        long long bank = std::stoll(getOption(argc, argv, "--bank", "1000"));
+        long long increment = std::stoll(getOption(argc, argv, "--increment", "100"));
+        long long think = std::stoll(getOption(argc, argv, "--think", "150"));
+        long long load = std::stoll(getOption(argc, argv, "--load", "0"));
+        std::mt19937_64 rng(std::stoull(getOption(argc, argv, "--seed", "1")));
+        if (tables < 1 || !(duration > 0) || bank < 1 || increment < 0 || think < 1 || load < 0) throw std::out_of_range("Opciones fuera de Rango");
+
+        /// Dos timerfd por Mesa: Subir el Límite de Descriptores
+        rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max){
+
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+
+        }
+
+        /// Mesas (el Evento Lleva Mesa * 2 + Tipo: 0 = Carta del Bot, 1 = Bandera)
+        struct ClockTable {
+
+            TurnFlow flow;                       // Partida
+            TurnClock clock;                     // Relojes
+            int thinkDescriptor = -1;            // timerfd de la Próxima Carta
+            long long thinkAt = 0;               // Instante Programado de la Próxima Carta
+
+        };
+        std::vector<ClockTable> pool(static_cast<size_t>(tables));
+        int poller = epoll_create1(EPOLL_CLOEXEC);
+        if (poller < 0) throw std::runtime_error("No se pudo Crear el epoll");
+        for (size_t t = 0; t < pool.size(); t++){
+
+            pool[t].clock.descriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            pool[t].thinkDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (pool[t].clock.descriptor < 0 || pool[t].thinkDescriptor < 0) throw std::runtime_error("No se pudieron Crear los Temporizadores (Descriptores Insuficientes)");
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = t * 2;
+            epoll_ctl(poller, EPOLL_CTL_ADD, pool[t].thinkDescriptor, &event);
+            event.data.u64 = t * 2 + 1;
+            epoll_ctl(poller, EPOLL_CTL_ADD, pool[t].clock.descriptor, &event);
+
+        }
+
+        /// Bot: Piensa entre 0 y 2 Veces --think y Voltea una Carta Boca Abajo
+        std::uniform_int_distribution<long long> thinking(0, 2 * think * 1000000LL);
+        auto scheduleThink = [&](ClockTable& table, long long from){
+
+            table.thinkAt = from + thinking(rng);
+            setTimerDeadline(table.thinkDescriptor, table.thinkAt);
+
+        };
+        SimGame deal;
+        auto startTable = [&](ClockTable& table, long long now){
+
+            dealCards(deal, rng);
+            FlowStep step = startFlow(table.flow, deal.cards, (uint64_t(1) << CARD_COUNT) - 1, 1 + deal.firstPlayer, 0, 0, 0, 0);
+            table.clock.bankNanos[0] = table.clock.bankNanos[1] = bank * 1000000LL;
+            table.clock.usedNanos[0] = table.clock.usedNanos[1] = 0;
+            table.clock.incrementNanos = increment * 1000000LL;
+            table.clock.flagged = 0;
+            armClock(table.clock, step.await == AWAIT_PICK ? table.flow.guard.turn : 1, now);
+            scheduleThink(table, now);
+
+        };
+        long long begin = monotonicNanos();
+        for (ClockTable& table : pool) startTable(table, begin);
+
+        /// Bucle de Eventos
+        std::vector<long long> flagLatency, processLag;
+        long long moves = 0, games = 0, flags = 0, events = 0, lagTotal = 0;
+        std::vector<epoll_event> ready(1024);
+        long long end = begin + static_cast<long long>(duration * 1e9);
+        auto lose = [&](ClockTable& table, long long now){
+
+            flagLatency.push_back(now - (table.clock.startedAt + table.clock.bankNanos[table.clock.running - 1]));
+            chargeClock(table.clock, now);
+            flags++;
+            startTable(table, now);
+
+        };
+        while (monotonicNanos() < end){
+
+            int count = epoll_wait(poller, ready.data(), static_cast<int>(ready.size()), 100);
+            for (int k = 0; k < count; k++){
+
+                ClockTable& table = pool[ready[k].data.u64 / 2];
+                bool flagEvent = ready[k].data.u64 & 1;
+                uint64_t expirations;
+                if (read(flagEvent ? table.clock.descriptor : table.thinkDescriptor, &expirations, sizeof(expirations)) != sizeof(expirations)) continue;  // Ya Rearmado
+                long long now = monotonicNanos();
+                events++;
+
+                /// Trabajo Simulado por Evento
+                while (monotonicNanos() - now < load * 1000) {}
+
+                /// Bandera: el Kernel Avisó al Agotarse el Tiempo
+                if (flagEvent){
+
+                    if (table.clock.running) lose(table, now);
+                    continue;
+
+                }
+
+                /// Carta del Bot: Cobrar en su Instante Programado (si Llegó Tarde, la Bandera ya Había Caído)
+                processLag.push_back(now - table.thinkAt);
+                lagTotal += now - table.thinkAt;
+                if (clockOverdrawn(table.clock, table.thinkAt)){
+
+                    lose(table, now);
+                    continue;
+
+                }
+                int candidates[CARD_COUNT], hiddenCount = 0;
+                for (int c = 0; c < CARD_COUNT; c++) if ((table.flow.guard.hidden >> c) & 1) candidates[hiddenCount++] = c;
+                int mover = table.flow.guard.turn;
+                int position = candidates[rng() % hiddenCount];
+                FlowStep step = flowPick(table.flow, position / 6, position % 6);
+                if (step.event == EVENT_MATCH || step.event == EVENT_NO_MATCH){
+
+                    chargeClock(table.clock, table.thinkAt);
+                    table.clock.bankNanos[mover - 1] += table.clock.incrementNanos;
+                    moves++;
+
+                }
+                while (step.await == AWAIT_TIMER) step = flowTimer(table.flow);           // Sin Pausas en la Medición
+                if (step.await == AWAIT_DONE){
+
+                    games++;
+                    startTable(table, table.thinkAt);
+                    continue;
+
+                }
+                if (!table.clock.running) armClock(table.clock, table.flow.guard.turn, table.thinkAt);
+                scheduleThink(table, table.thinkAt);
+
+            }
+
+        }
+        double seconds = (monotonicNanos() - begin) / 1e9;
+        for (ClockTable& table : pool){
+
+            close(table.clock.descriptor);
+            close(table.thinkDescriptor);
+
+        }
+        close(poller);
+
+        /// Percentiles en Milisegundos
+        auto percentile = [](std::vector<long long>& values, double q){
+
+            if (values.empty()) return 0.0;
+            size_t at = std::min(values.size() - 1, static_cast<size_t>(q * values.size()));
+            std::nth_element(values.begin(), values.begin() + at, values.end());
+            return values[at] / 1e6;
+
+        };
 
-                rowCard1(card1Row, false);                                                    // Leer Fila de la Primera Carta
-                if (std::cin.fail()){                                                         // Si se ingresa un Tipo Incorrecto
+        /// Reporte
+        char row[160];
+        screen << "                      ********************************************************************************** \n";
+        screen << "                      *                           Medicion de Relojes de Turno                         * \n";
+        screen << "                      ********************************************************************************** \n";
+        std::snprintf(row, sizeof(row), "Mesas: %lld  Bolsa: %lld ms +%lld ms  Pensar: 0-%lld ms  Carga: %lld us/Evento", tables, bank, increment, 2 * think, load);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Eventos/s: %.0f  Movimientos: %lld  Partidas: %lld  Banderas: %lld", events / seconds, moves, games, flags);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Bandera tras el Limite: p50 %.3f ms  p99 %.3f ms  max %.3f ms", percentile(flagLatency, 0.5), percentile(flagLatency, 0.99), percentile(flagLatency, 1.0));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Retraso de Proceso: p50 %.3f ms  p99 %.3f ms  max %.3f ms", percentile(processLag, 0.5), percentile(processLag, 0.99), percentile(processLag, 1.0));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        std::snprintf(row, sizeof(row), "Cobrando al Procesar se Cobrarian %.1f ms de Mas (%.3f ms por Carta)", lagTotal / 1e6, lagTotal / 1e6 / std::max<size_t>(1, processLag.size()));
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+        screen << "                      ********************************************************************************** \n";
+        return 0;
 
-                    std::cin.clear();                                                         // Limpiar Estado de Fallo
-                    std::cin.ignore(MAX_LIMIT, '\n');                                         // Ignorar Entrada Inválida
-                    printError(typeError);                                                    // Imprimir Error de Tipo
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    continue;                                                                 // Continuar Bucle
+    #endif
 
-                }
-                if (card1Row < 0 || card1Row > 5){                                            // Si el Valor está Fuera de Rango
+}
 
-                    printError(rangeError);                                                   // Imprimir Error de Rango
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    continue;                                                                 // Continuar Bucle
 
-                }
-                break;                                                                        // Salir del Bucle si la Entrada es Válida
 
-            }
-            clearScreen();                                                                    // Limpiar Pantalla
-            printGame(player1Points, player2Points, turn, visibleCards, playerNames);         // Reimprimir Juego
-            rowCard1(card1Row, true);                                                         // Imprimir Fila de la Primera Carta
-            while (true){                                                                     // Mientras
 
-            columnCard1(card1Column);                                                         // Leer Columna de la Primera Carta
-                if (std::cin.fail()){ 
+/**
+ * @brief Función Principal del Modo Espectador.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int spectateMain(int argc, char* argv[]){
 
-                    std::cin.clear();                                                         // Limpiar Estado de Fallo
-                    std::cin.ignore(MAX_LIMIT, '\n');                                         // Ignorar Entrada Inválida
-                    printError(typeError);                                                    // Imprimir Error de Tipo
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    rowCard1(card1Row, true);                                                 // Imprimir Fila de la Primera Carta
-                    continue;                                                                 // Continuar Bucle
+    /*
+       - Función: Modo Espectador
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --spectate <socket>
+                   Recibe el Estado Completo al Unirse y luego Diferencias, y Dibuja cada Cuadro
+    */
 
-                }
-                if (card1Column < 0 || card1Column > 5){
+    #ifdef _WIN32
+        (void)argc; (void)argv;
+        throw std::runtime_error("El Modo Espectador no esta Disponible en Windows");
+    #else
 
-                    printError(rangeError);                                                   // Imprimir Error de Rango
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    rowCard1(card1Row, true);                                                 // Imprimir Fila de la Primera Carta
-                    continue;                                                                 // Continuar Bucle
-                }
-                if (visibleCards[card1Row][card1Column] != "X"){
+        /// Conectar al Socket de la Partida
+        std::string path = getOption(argc, argv, "--spectate", "memorama.sock");
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) throw std::runtime_error("Ruta de Socket Demasiado Larga: " + path);
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (descriptor < 0 || connect(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0){
 
-                    errorCounter++;                                                           // Incrementar Contador de Errores
-                    clearScreen();                                                            // Limpiar Pantalla
-                    cardDiscoveredError(false);                                               // Imprimir Error de Carta ya Descubierta
-                    waitSeconds(2);                                                           // Esperar 2 Segundos
-                    break;                                                                    // Continuar Bucle
+            if (descriptor >= 0) close(descriptor);
+            throw std::runtime_error("No hay Partida Transmitiendo en " + path);
 
-                }
-                validCard = true;                                                             // Marcar Carta como Válida
-                break;                                                                        // Salir del Bucle si la Entrada es Válida
+        }
 
-            }
+        /// Estado Local del Espectador
+        std::vector<std::vector<std::string>> visibleCards(6, std::vector<std::string>(6, "X"));
+        std::vector<std::string> playersNames(2);
+        int points[2] = {0, 0}, turn = 1;
+        uint64_t frames = 0, lost = 0, expected = 0;
+        bool synchronized = false;
 
-        }while(!validCard);                                                                   // Repetir hasta que la Carta sea Válida
-        visibleCards[card1Row][card1Column] = board[card1Row][card1Column];                   // Revelar Primera Carta
-        do{                                                                                   // Repetir hasta que la Carta sea Válida   
-        
-            validCard = false;                                                                // Reiniciar Bandera de Carta Válida
-            clearScreen();                                                                    // Limpiar Pantalla
-            printGame(player1Points,player2Points,turn,visibleCards,playerNames);             // Reimprimir Juego
-            while (true){
+        /// Recibir y Dibujar Cuadros hasta que la Partida Termine
+        uint8_t header[SPECTATOR_HEADER_BYTES], payload[SPECTATOR_FRAME_BYTES];
+        while (readExactly(descriptor, header, sizeof(header))){
 
-                rowCard2(card2Row, false);                                                    // Leer Fila de la Segunda Carta
-                if (std::cin.fail()){                                                         // Si se ingresa un Tipo Incorrecto
-                    
-                    std::cin.clear();                                                         // Limpiar Estado de Fallo
-                    std::cin.ignore(MAX_LIMIT, '\n');                                         // Ignorar Entrada Inválida
-                    printError(typeError);                                                    // Imprimir Error de Tipo
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    continue;                                                                 // Continuar Bucle
+            /// Encabezado
+            size_t length = header[8] | (header[9] << 8);
+            uint32_t sequence = header[4] | (header[5] << 8) | (header[6] << 16) | (static_cast<uint32_t>(header[7]) << 24);
+            if (length > sizeof(payload) || !readExactly(descriptor, payload, length)) break;
+            turn = header[1];
+            points[0] = header[2];
+            points[1] = header[3];
 
-                }
-                if (card2Row < 0 || card2Row > 5) {                                           // Si el Valor está Fuera de Rango
+            /// Estado Completo: Cartas y Nombres
+            if (header[0] == MESSAGE_SNAPSHOT){
+
+                for (int k = 0; k < CARD_COUNT; k++) visibleCards[k / 6][k % 6] = std::string(1, static_cast<char>(payload[k]));
+                size_t cursor = CARD_COUNT;
+                for (int p = 0; p < 2; p++){
 
-                    printError(rangeError);                                                   // Imprimir Error de Rango
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    continue;                                                                 // Continuar Bucle
+                    size_t size = payload[cursor++];
+                    playersNames[p].assign(reinterpret_cast<const char*>(payload + cursor), size);
+                    cursor += size;
 
                 }
-                break;                                                                        // Salir del Bucle si la Entrada es Válida
+                if (synchronized) lost += sequence - expected;                       // Cuadros Perdidos por Atraso
+                synchronized = true;
+                expected = sequence;
 
             }
-            while(true){                                                                      // Mientras
-
-                columnCard2(card2Column);                                                     // Leer Columna de la Segunda Carta
-                if (std::cin.fail()){                                                         // Si se ingresa un Tipo Incorrecto
-
-                    std::cin.clear();                                                         // Limpiar Estado de Fallo
-                    std::cin.ignore(MAX_LIMIT, '\n');                                         // Ignorar Entrada Inválida
-                    printError(typeError);                                                    // Imprimir Error de Tipo
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    rowCard2(card2Row, true);                                                 // Imprimir Fila de la Segunda Carta
-                    continue;                                                                 // Continuar Bucle
-                
-                }
-                if (card2Column < 0 || card2Column > 5){
 
-                    printError(rangeError);                                                   // Imprimir Error de Rango
-                    printGame(player1Points, player2Points, turn, visibleCards, playerNames); // Reimprimir Juego
-                    rowCard2(card2Row, true);                                                 // Imprimir Fila de la Segunda Carta
-                    continue;                                                                 // Continuar Bucle
+            /// Diferencias: Pares (Posición, Carta)
+            else{
+
+                for (int d = 0; d < payload[0]; d++){
+
+                    int position = payload[1 + 2 * d];
+                    if (position < CARD_COUNT) visibleCards[position / 6][position % 6] = std::string(1, static_cast<char>(payload[2 + 2 * d]));
 
                 }
-                if (card2Row == card1Row && card2Column == card1Column){                      // Si es la Misma Carta
-    
-                    errorCounter++;                                                           // Incrementar Contador de Errores
-                    clearScreen();                                                            // Limpiar Pantalla
-                    cardDiscoveredError(true);                                                // Imprimir Error de Carta ya Descubierta
-                    waitSeconds(2);                                                           // Esperar 2 Segundos
-                    break;                                                                    // Salimos del Bucle
-                
-                }
-                if (visibleCards[card2Row][card2Column] != "X"){                              // Si la Carta ya fue Descubierta
-
-                    errorCounter++;                                                           // Incrementar Contador de Errores
-                    clearScreen();                                                            // Limpiar Pantalla
-                    cardDiscoveredError(false);                                               // Imprimir Error de Carta ya Descubierta
-                    waitSeconds(2);                                                           // Esperar 2 Segundos
-                    break;                                                                    // Salimos del Bucle
-                
-                }
-                validCard = true;                                                             // Marcamos como Selección Válida de Cartas
-                break;                                                                        // Salir del Bucle si la Entrada es Válida
-            
+                expected = sequence + 1;
+
             }
-        
-        }while(!validCard);                                                                   // Hasta que Selección de Cartas sea Válida
-        visibleCards[card2Row][card2Column] = board[card2Row][card2Column];                   // Revelar Segunda Carta
-        movesCounter++;                                                                       // Incrementar Contador de Movimientos
-        clearScreen();                                                                        // Limpiar Pantalla
-        printGame(player1Points, player2Points, turn, visibleCards, playerNames);             // Reimprimir Juego
-        if (board[card1Row][card1Column] == board[card2Row][card2Column]){                    // Si las Cartas son Iguales
-        
-            cardMessage(true);                                                                // Imprimir Mensaje de Pareja Encontrada
-            waitSeconds(2);                                                                   // Esperar 2 Segundos
-            if (turn == 1) player1Points++;                                                   // Asignar Punto al Jugador Correspondiente
-            else player2Points++;                                                             // Asignar Punto al Jugador Correspondiente
-    
-        }
-        else{                                                                                 // Si las Cartas No Son Iguales
-            
-            errorCounter++;
-            cardMessage(false);                                                               // Imprimir Mensaje de No Son Iguales
-            waitSeconds(2);                                                                   // Esperamos 2 Segundos
-            visibleCards[card1Row][card1Column] = "X";                                        // Tapamos la Primera Carta
-            visibleCards[card2Row][card2Column] = "X";                                        // Tapamos la Segunda Carta
-            turn == 1 ? turn = 2 : turn = 1;                                                  // Alternamos el Turno
-            waitSeconds(2);                                                                   // Esperamos 2 Segundos
+
+            /// Dibujar el Cuadro
+            frames++;
+            clearScreen();
+            printGame(points[0], points[1], turn, visibleCards, playersNames, nullptr);
+            screen << "                      ********************************************************************************** \n";
+            screen << "                      *   Espectador   Cuadros: " << static_cast<long long>(frames) << "   Perdidos: " << static_cast<long long>(lost) << "\n";
+            screen << "                      ********************************************************************************** \n";
+            presentFrame();
 
         }
-    
+
+        /// Fin de la Transmisión
+        close(descriptor);
+        screen << "                      *                             La Transmision Termino                             * \n";
+        screen << "                      ********************************************************************************** \n";
+        return 0;
+
+    #endif
+
+}
+
+
+
+
+/**
+ * @brief Función que Imprime una Lista de Repartos en un Recuadro.
+ * @param title (const char*): Título de la Lista.
+ * @param heap (DealHeap): Repartos Ordenados.
+ */
+void printDealList(const char* title, const DealHeap& heap){
+
+    /// Encabezado
+    char row[160];
+    std::snprintf(row, sizeof(row), "%-20s %22s %14s %14s", title, "Semilla", "Movimientos", "Ventaja J.Ini");
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
+    /// Un Renglón por Reparto
+    for (const DealScore& score : heap.items){
+
+        std::snprintf(row, sizeof(row), "%-20s %22llu %14.2f %+14.2f", "", static_cast<unsigned long long>(score.seed), score.moves, score.advantage);
+        screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+
     }
-    auto end_time = std::chrono::steady_clock::now();                                         // Pausamos el Cronómetro
-    auto game_duration = chrono::duration_cast<chrono::seconds>(end_time - start_time);       // Tiempo en Juego en Segundos
-    int totalSeconds = game_duration.count();                                                 // Asignar Minutos
-    minutes = totalSeconds / 60;                                                              // Convertir a Minutos
-    seconds = totalSeconds % 60;                                                              // Convertir a Segundos
+    screen << "                      ********************************************************************************** \n";
 
 }
 
@@ -1117,70 +12473,187 @@ void mainLoop(
 
 
 /**
- * @brief Función de Imprimir Resultados Finales.
- * @param minutes (int): Minutos Transcurridos.
- * @param seconds (int): Segundos Transcurridos.
- * @param movesCounter (int): Contador de Movimientos.
- * @param errorCounter (int): Contador de Errores.
- * @param player1Points (int): Puntos del Jugador 1.
- * @param player2Points (int): Puntos del Jugador 2.
- * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
- * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ * @brief Función Principal del Barrido de Semillas.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
  */
-void printFinalResults(
-    
-    int minutes, 
-    int seconds,
-    int movesCounter, 
-    int errorCounter, 
-    int player1Points, 
-    int player2Points, 
-    const std::vector<std::string>& playerNames
+int sweepMain(int argc, char* argv[]){
 
-){
+    /*
+       - Función: Barrido de Semillas
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --sweep <repartos> [--seed S] [--strategy nombre] [--playouts R] [--top K] [--threads T]
+                            [--export-deals archivo.csv]
+    */
+
+    /// Lectura de Opciones
+    long long count = std::stoll(getOption(argc, argv, "--sweep", "100000"));
+    uint64_t baseSeed = std::stoull(getOption(argc, argv, "--seed", std::to_string(time(0))));
+    int strategy = findStrategy(getOption(argc, argv, "--strategy", "memoria"));
+    int playouts = std::stoi(getOption(argc, argv, "--playouts", "16"));
+    long long top = std::stoll(getOption(argc, argv, "--top", "10"));
+    int threads = std::stoi(getOption(argc, argv, "--threads", std::to_string(std::max(1u, std::thread::hardware_concurrency()))));
+    std::string exportPath = getOption(argc, argv, "--export-deals", "");
+    if (count < 1 || playouts < 1 || top < 1 || threads < 1) throw std::out_of_range("Repartos, Partidas, K e Hilos deben ser Positivos");
+    readSearchSettings(argc, argv);
+
+    /// Barrido
+    SweepPartial result;
+    auto start = std::chrono::steady_clock::now();
+    sweepDeals(baseSeed, count, STRATEGIES[strategy], playouts, static_cast<size_t>(top), threads, result);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                               Analisis de Repartos                             * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Repartos: %lld  Estrategia: %s  Partidas por Reparto: %d", count, STRATEGIES[strategy].name, playouts);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Mov. Medios: %.2f  Ventaja Media: %+.3f  Repartos/s: %.0f", result.totalMoves / count, result.totalAdvantage / count, count / std::max(seconds, 1e-9));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    printDealList("Mas Faciles", result.easiest);
+    printDealList("Mas Dificiles", result.hardest);
+
+    /// Exportar Listas
+    if (!exportPath.empty()) exportDeals(exportPath, result);
+    return 0;
+
+}
+
+
+
+
+/**
+ * @brief Función que Lee el Día de --date (o el Actual).
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (uint32_t) Día (AAAAMMDD).
+ * @throw std::out_of_range: Si la Fecha no Tiene la Forma AAAAMMDD.
+ */
+uint32_t readDay(int argc, char* argv[]){
+
+    /// Fecha Pedida o la de Hoy
+    long long day = std::stoll(getOption(argc, argv, "--date", std::to_string(currentDay())));
+    if (day < 19000101 || day > 99991231 || day % 100 < 1 || day % 100 > 31 || day / 100 % 100 < 1 || day / 100 % 100 > 12) throw std::out_of_range("La Fecha debe Tener la Forma AAAAMMDD");
+    return static_cast<uint32_t>(day);
+
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Consulta de Clasificación.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int leaderboardMain(int argc, char* argv[]){
 
     /*
-       - Función: Imprimir Resultados Finales
+       - Función: Consulta de Clasificación
        - Argumentos:
-            - minutes (int): Minutos Transcurridos.
-            - seconds (int): Segundos Transcurridos.
-            - movesCounter (int): Contador de Movimientos.
-            - errorCounter (int): Contador de Errores.
-            - player1Points (int): Puntos del Jugador 1.
-            - player2Points (int): Puntos del Jugador 2.
-            - playerNames (std::vector<std::string>): Nombres de los Jugadores.
-       - Retorno: Ninguno
-       - Objetivo: Imprimir los Resultados Finales del Juego
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --leaderboard [--date AAAAMMDD] [--top N]
     */
 
-    /// Validación de Argumentos Enteros
-    validatePositiveInt(minutes);                      // Minutos
-    validatePositiveInt(seconds);                      // Segundos
-    validatePositiveInt(movesCounter);                 // Contador de Movimientos
-    validatePositiveInt(errorCounter);                 // Contador de Errores
-    validatePositiveInt(player1Points);                // Puntos del Jugador 1
-    validatePositiveInt(player2Points);                // Puntos del Jugador 2
+    /// Lectura de Opciones
+    uint32_t day = readDay(argc, argv);
+    long long top = std::stoll(getOption(argc, argv, "--top", "10"));
+    if (top < 1) throw std::out_of_range("N debe ser Positivo");
+    if (!std::filesystem::exists(leaderboardPath(day))) throw std::runtime_error("No hay Resultados del " + std::to_string(day));
+
+    /// Imprimir
+    Leaderboard leaderboard;
+    openLeaderboard(leaderboard, leaderboardPath(day), day);
+    printLeaderboard(leaderboard, 0, static_cast<size_t>(top));
+    closeLeaderboard(leaderboard);
+    return 0;
 
-    /// Limpiar Pantalla e Imprimir Resultados Finales
-    clearScreen();
-    
-    /// Imprimir Resultados Finales
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                ¡Juego terminado!                               * \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *                          " << playerNames[0] << " : " << player1Points << " puntos                  \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *                          " << playerNames[1] << " : " << player2Points << " puntos                  \n";
-    std::cout << "                      *                                                                                * \n";
-    std::cout << "                      *                          Movimientos totales : " << movesCounter<< "                              *\n";
-    std::cout << "                      *                          Errores             : " << errorCounter << "                              *\n";
-    std::cout << "                      *                          Tiempo consumido    : " << minutes << " min, con " << seconds << " seg     \n";
-    std::cout << "                      ********************************************************************************** \n";
-    std::cout << "                                                         ";
-    
-    // Esperar a que el Usuario presione una Tecla para Continuar
-    pauseExecution();
+}
+
+
+
+
+/**
+ * @brief Función Principal de la Medición de la Clasificación.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
+ */
+int benchLeaderboardMain(int argc, char* argv[]){
+
+    /*
+       - Función: Medición de la Clasificación
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --bench-leaderboard [--entries N] [--seed S]
+                   Inserta N Resultados Aleatorios en un Archivo Temporal y Mide Inserción, Primeros 10 y Lugar
+    */
+
+    /// Lectura de Opciones
+    long long entries = std::stoll(getOption(argc, argv, "--entries", "1000000"));
+    std::mt19937_64 rng(std::stoull(getOption(argc, argv, "--seed", "1")));
+    if (entries < 1) throw std::out_of_range("Entradas debe ser Positivo");
+    std::string path = (std::filesystem::temp_directory_path() / ("memorama-bench-" + std::to_string(rng()) + ".top")).string();
+
+    /// Resultados Plausibles: 18 a 80 Movimientos, Errores = Movimientos - 18, hasta 15 Minutos
+    std::vector<LeaderNode> samples(static_cast<size_t>(entries));
+    for (LeaderNode& sample : samples){
+
+        sample.moves = static_cast<uint32_t>(18 + rng() % 63);
+        sample.errors = sample.moves - 18;
+        sample.seconds = static_cast<uint32_t>(rng() % 900);
+
+    }
+
+    /// Inserciones
+    Leaderboard leaderboard;
+    openLeaderboard(leaderboard, path, 20000101);
+    auto start = std::chrono::steady_clock::now();
+    for (const LeaderNode& sample : samples) insertLeaderEntry(leaderboard, "bench", sample.moves, sample.errors, sample.seconds);
+    double insertSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    /// Consultas de Primeros 10 y de Lugar
+    const int QUERIES = 100000;
+    std::vector<LeaderNode> top;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; i++) topLeaderEntries(leaderboard, 10, top);
+    double topSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; i++){
+
+        const LeaderNode& sample = samples[rng() % samples.size()];
+        checksum += leaderRank(leaderboard, sample.moves, sample.errors, sample.seconds);
+
+    }
+    double rankSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t fileBytes = leaderHeader(leaderboard).used;
+    unmapFile(leaderboard.file);
+    std::filesystem::remove(path);
+
+    /// Reporte
+    char row[160];
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *                          Medicion de la Clasificacion                          * \n";
+    screen << "                      ********************************************************************************** \n";
+    std::snprintf(row, sizeof(row), "Entradas: %lld  Archivo: %.1f MB  Suma de Lugares: %llu", entries, fileBytes / 1048576.0, static_cast<unsigned long long>(checksum));
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    std::snprintf(row, sizeof(row), "Insercion: %.3f us   Primeros 10: %.3f us   Lugar: %.3f us", insertSeconds * 1e6 / entries, topSeconds * 1e6 / QUERIES, rankSeconds * 1e6 / QUERIES);
+    screen << "                      *   " << row << std::string(76 - std::min<size_t>(76, strlen(row)), ' ') << " * \n";
+    screen << "                      ********************************************************************************** \n";
+    return 0;
 
 }
 
@@ -1188,54 +12661,184 @@ void printFinalResults(
 
 
 /**
- * @brief Función de Imprimir al Gandor.
- * @param player1Points (int): Puntos del Jugador 1.
- * @param player2Points (int): Puntos del Jugador 2.
- * @param playerNames (std::vector<std::string>): Nombres de los Jugadores.
- * @throw std::out_of_range (int): Si algún Entero es Negativo.
+ * @brief Función Principal del Modo Análisis.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos.
+ * @return (int) Código de Salida
  */
-void printWinner(int player1Points, int player2Points, const std::vector<std::string>& playerNames)
-{
-    
+int analyzeMain(int argc, char* argv[]){
 
-    /// Validar Argumentos Enteros
-    validatePositiveInt(player1Points);                // Puntos del Jugador 1
-    validatePositiveInt(player2Points);                // Puntos del Jugador 2
- 
-    /// Limpiar Pantalla
-    clearScreen();
+    /*
+       - Función: Modo Análisis
+       - Argumentos:
+            - argc (int): Número de Argumentos
+            - argv (char*[]): Argumentos
+       - Retorno: Código de Salida
+       - Objetivo: memorama --analyze <directorio> [--where filtro] [--group-by columna]
+    */
+
+    /// Abrir la Exportación
+    ResultColumns table;
+    std::vector<std::string> strategyNames;
+    openResultColumns(table, getOption(argc, argv, "--analyze", "."), strategyNames);
+    std::vector<ColumnPredicate> predicates = parsePredicates(getOption(argc, argv, "--where", ""), strategyNames);
+    std::string groupName = getOption(argc, argv, "--group-by", "");
+    int groupColumn = groupName.empty() ? -1 : findColumn(groupName);
+    if (groupColumn == COLUMN_SEED) throw std::invalid_argument("No se puede Agrupar por Semilla");
+
+    /// Acumuladores por Grupo (las Columnas Agrupables Caben en 16 Bits)
+    std::vector<long long> groupCount(65536, 0), groupMoves(65536, 0), groupErrors(65536, 0), groupWins(65536, 0);
+
+    /// Recorrer por Bloques: Máscara de Predicados y luego Agregación
+    const size_t BLOCK = 4096;
+    uint8_t mask[BLOCK];
+    const uint16_t* moves = static_cast<const uint16_t*>(table.files[COLUMN_MOVES].data);
+    const uint16_t* errors = static_cast<const uint16_t*>(table.files[COLUMN_ERRORS].data);
+    const uint16_t* points1 = static_cast<const uint16_t*>(table.files[COLUMN_POINTS1].data);         // Mismo Desplazamiento en Ambas
+    const uint16_t* points2 = static_cast<const uint16_t*>(table.files[COLUMN_POINTS2].data);
+    for (uint64_t begin = 0; begin < table.rows; begin += BLOCK){
+
+        size_t count = static_cast<size_t>(std::min<uint64_t>(BLOCK, table.rows - begin));
+        std::fill(mask, mask + count, 1);
+        for (const ColumnPredicate& predicate : predicates) applyPredicate(table, predicate, begin, count, mask);
+
+        for (size_t i = 0; i < count; i++){
+
+            if (!mask[i]) continue;                                                         // Fila Descartada
+            uint64_t row = begin + i;
+            size_t key = groupColumn < 0 ? 0 : static_cast<size_t>(readColumnValue(table, groupColumn, row));
+            groupCount[key]++;
+            groupMoves[key] += moves[row];
+            groupErrors[key] += errors[row];
+            groupWins[key] += points1[row] > points2[row];
+
+        }
 
-    /// Impresión de Ganador
-    if (player1Points > player2Points || player1Points < player2Points){
-        
-        win();
-        int winner;
-        player1Points > player2Points ? winner = 0 : winner = 1;
-        std::cout << "                      *                                 " << playerNames[winner] << "  Gana! \n";
-        std::cout << "                      ********************************************************************************** \n";
-    
     }
-    else{
 
-        tie();
-        std::cout << "                      *                                     Empate!                                    *\n";
-        std::cout << "                      ********************************************************************************** \n";
-    
+    /// Imprimir Grupos
+    screen << "                      ********************************************************************************** \n";
+    screen << "                      *   Grupo                 Partidas   Mov. Media   Err. Media   Victorias J1      * \n";
+    screen << "                      ********************************************************************************** \n";
+    for (size_t key = 0; key < groupCount.size(); key++){
+
+        if (groupCount[key] == 0) continue;
+        std::string label = groupColumn < 0 ? "Todas" : std::to_string(static_cast<long long>(key) - RESULT_COLUMNS[groupColumn].bias);
+        if ((groupColumn == COLUMN_STRATEGY1 || groupColumn == COLUMN_STRATEGY2) && key < strategyNames.size()) label = strategyNames[key];
+        char row[160];
+        std::snprintf(row, sizeof(row), "%-20s %11lld %12.2f %12.2f %13.1f%%", label.c_str(), groupCount[key], double(groupMoves[key]) / groupCount[key], double(groupErrors[key]) / groupCount[key], 100.0 * groupWins[key] / groupCount[key]);
+        screen << "                      *   " << row << "      * \n";
+
     }
-    std::cout << "\n";
+    screen << "                      ********************************************************************************** \n";
 
-    // Esperar a que el Usuario presione una Tecla para Continuar
-    pauseExecution();
+    /// Liberar Proyecciones
+    closeResultColumns(table);
+    return 0;
 
 }
 
 
 
+
+
+
+
+
+#ifndef MEMORAMA_LIBRARY                                                          // Sin main al Compilar como Biblioteca
+
 /**
  * @brief Función Principal.
+ * @param argc (int): Número de Argumentos.
+ * @param argv (char*[]): Argumentos de la Línea de Comandos.
  * @return (int) Código de Salida
  */
-int main() {
+int main(int argc, char* argv[]) {
+
+    /// Búfer de Pantalla
+    initScreen();
+
+    /// Modos sin Interfaz
+    uint32_t day = 0;
+    try {
+
+        openTablebase(TABLEBASE_PATH);
+        if (hasFlag(argc, argv, "--daily")) day = readDay(argc, argv);
+        int status = -1;
+        if (hasFlag(argc, argv, "--simulate") || hasFlag(argc, argv, "--resume")) status = simulationMain(argc, argv);
+        else if (hasFlag(argc, argv, "--analyze")) status = analyzeMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-search")) status = benchSearchMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-render")) status = benchRenderMain(argc, argv);
+        else if (hasFlag(argc, argv, "--spectate")) status = spectateMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-validate")) status = benchValidateMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-flow")) status = benchFlowMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-env")) status = benchEnvMain(argc, argv);
+        else if (hasFlag(argc, argv, "--heatmap")) status = heatmapMain(argc, argv);
+        else if (hasFlag(argc, argv, "--build-tablebase")) status = buildTablebaseMain(argc, argv);
+        else if (hasFlag(argc, argv, "--sweep")) status = sweepMain(argc, argv);
+        else if (hasFlag(argc, argv, "--leaderboard")) status = leaderboardMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-leaderboard")) status = benchLeaderboardMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-tt")) status = benchTranspositionMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-rules")) status = benchRulesMain(argc, argv);
+        else if (hasFlag(argc, argv, "--coordinate")) status = coordinateMain(argc, argv);
+        else if (hasFlag(argc, argv, "--work")) status = workMain(argc, argv);
+        else if (hasFlag(argc, argv, "--serve")) status = serveMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-serve")) status = benchServeMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-match")) status = benchMatchMain(argc, argv);
+        else if (hasFlag(argc, argv, "--play")) status = playMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-record")) status = benchRecordMain(argc, argv);
+        else if (hasFlag(argc, argv, "--bench-clock")) status = benchClockMain(argc, argv);
+        if (status >= 0){
+
+            presentFrame();
+            return status;
+
+        }
+
+    }
+    catch (const std::exception& error){
+
+        presentFrame();
+        std::cerr << "Error: " << error.what() << "\n";
+        return 1;
+
+    }
+
+    /// Jugar con Control de Tiempo si se Pide (si Falla, se Juega sin Relojes)
+    if (hasFlag(argc, argv, "--clock")){
+
+        try {
+
+            startMatchClock(getOption(argc, argv, "--clock", "5+3"));
+
+        }
+        catch (const std::exception& error){
+
+            presentFrame();
+            std::cerr << "Error: " << error.what() << "\n";
+            waitSeconds(2);
+
+        }
+
+    }
+
+    /// Grabar la Sesión si se Pide (si Falla, se Juega sin Grabar)
+    if (hasFlag(argc, argv, "--record")){
+
+        try {
+
+            startRecording(getOption(argc, argv, "--record", "memorama.mrec"));
+
+        }
+        catch (const std::exception& error){
+
+            presentFrame();
+            std::cerr << "Error: " << error.what() << "\n";
+            waitSeconds(2);
+
+        }
+
+    }
 
     /// Configuraciones Iniciales
     clearScreen();                     // Limpiar Pantalla
@@ -1246,6 +12849,7 @@ int main() {
     int turn = 1, player1Points = 0, player2Points = 0;                                   // Turno y Puntos de los Jugadores
     int movesCounter = 0, errorCounter = 0;                                               // Contadores de Movimientos y Errores
     int minutes = 0, seconds = 0;                                                         // Tiempo Transcurrido
+    long long elapsedMilliseconds = 0;                                                    // Tiempo ya Jugado (Partida Continuada)
 
     /// Declaración de Vectores y Matrices
     std::vector<std::string> letters(18);                                                 // 18 Letras Unicas
@@ -1277,20 +12881,80 @@ int main() {
     /// Inicializar la Semilla con el Tiempo Actual
     srand(time(0));
 
-    /// Ingreso de Nombres
-    inputNames(playerNames);
+    /// Desafío Diario: el Reparto Depende Solo de la Fecha
+    std::vector<std::string> dailyPairs(36);
+    if (day != 0) dealDaily(day, letters, dailyPairs);
+
+    /// Continuar la Partida Guardada si se Pide
+    bool continued = false;
+    if (hasFlag(argc, argv, "--continue")){
+
+        continued = loadGame(SAVE_PATH, board, visibleCards, playerNames, player1Points, player2Points, turn, movesCounter, errorCounter, elapsedMilliseconds);
+        if (!continued) printError(noSavedGameError);
+
+        /// Una Partida Guardada Cuenta para el Desafío Solo si es el Tablero del Día
+        for (int i = 0; continued && day != 0 && i < 36; i++) if (board[i / 6][i % 6] != dailyPairs[i]) day = 0;
+
+    }
+
+    /// Partida Nueva
+    if (!continued){
+
+        /// Ingreso de Nombres
+        inputNames(playerNames);
+
+        /// Animación Básica de Carga
+        loading();
+
+        /// Crear y Barajear el Arreglo de Pares (o Tomar el Reparto del Día)
+        if (day != 0) pairs = dailyPairs;
+        else {
+
+            createPairs(letters, pairs);
+            shuffleCards(pairs);
+
+        }
+
+        /// Asignar Pares al Tablero y Ocultar
+        createBoard(visibleCards, board, pairs);
+
+    }
+
+    /// Transmitir a Espectadores si se Pide (si Falla, se Juega sin Transmitir)
+    if (hasFlag(argc, argv, "--broadcast")){
+
+        try {
+
+            startBroadcast(getOption(argc, argv, "--broadcast", "memorama.sock"), visibleCards, player1Points, player2Points, turn, playerNames);
+
+        }
+        catch (const std::exception& error){
+
+            presentFrame();
+            std::cerr << "Error: " << error.what() << "\n";
+            waitSeconds(2);
+
+        }
+
+    }
+
+    /// Registrar la Telemetría de Volteos si se Pide (si Falla, se Juega sin Registrar)
+    if (hasFlag(argc, argv, "--telemetry")){
 
-    /// Animación Básica de Carga
-    loading();
+        try {
 
-    /// Crear el Arreglo de Pares
-    createPairs(letters, pairs);
+            startTelemetry(getOption(argc, argv, "--telemetry", "memorama.tel"));
 
-    /// Barajear el Arreglo de Pares
-    shuffleCards(pairs);
+        }
+        catch (const std::exception& error){
+
+            presentFrame();
+            std::cerr << "Error: " << error.what() << "\n";
+            waitSeconds(2);
+
+        }
 
-    /// Asignar Pares al Tablero y Ocultar
-    createBoard(visibleCards, board, pairs);
+    }
 
     /// Ciclo Principal
     mainLoop(
@@ -1308,17 +12972,49 @@ int main() {
         card2Column,
         playerNames, 
         board, 
-        visibleCards
+        visibleCards,
+        elapsedMilliseconds
     
     );
 
+    /// Terminar la Transmisión (los Espectadores Reciben Fin de Archivo)
+    stopBroadcast();
+
+    /// Vaciar la Telemetría Pendiente
+    stopTelemetry();
+
+    /// Detener los Relojes (Quién Perdió por Tiempo, si Alguien)
+    int flagged = stopMatchClock();
+
     /// Mostrar Resultados Finales
     printFinalResults(minutes, seconds, movesCounter, errorCounter, player1Points, player2Points, playerNames);
 
+    /// Registrar el Desafío Diario solo si se Completó el Tablero sin Caer la Bandera (si Falla, solo se Avisa)
+    if (day != 0 && flagged == 0 && player1Points + player2Points == PAIR_COUNT){
+
+        try {
+
+            recordDaily(day, playerNames, movesCounter, errorCounter, minutes * 60 + seconds);
+
+        }
+        catch (const std::exception& error){
+
+            presentFrame();
+            std::cerr << "Error: " << error.what() << "\n";
+            waitSeconds(2);
+
+        }
+
+    }
+
     /// Mensaje al Jugador Ganador
-    printWinner(player1Points, player2Points, playerNames);
+    printWinner(player1Points, player2Points, playerNames, flagged);
 
-    /// Código de Salida
+    /// Emitir el Último Cuadro, Cerrar la Grabación y Salir
+    presentFrame();
+    stopRecording();
     return 0;
 
-}
\ No newline at end of file
+}
+
+#endif
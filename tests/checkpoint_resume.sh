@@ -0,0 +1,46 @@
+#!/bin/sh
+# Prueba: una simulación cortada a la mitad y reanudada desde su punto de control da el mismo resumen que sin cortes.
+# Uso: sh tests/checkpoint_resume.sh   (desde la raíz del repositorio)
+set -ef
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+g++ -std=c++17 -O2 -pthread main.cpp -o "$work/memorama"
+cd "$work"
+
+# Resumen sin la fila de duración (tiempo de cómputo, distinto en cada corrida)
+summary() { grep -E "^ *\* +(Partidas|Turnos|Movimientos|Errores|Margen)" "$1"; }
+run="--simulate 2000000 --seed 5 --strategies memoria,inferencia --shard-size 8192"
+
+# Corrida de referencia sin cortes
+./memorama $run --threads 2 < /dev/null > straight.txt
+
+# Fragmentos ya combinados según el encabezado del punto de control
+completed() { od -An -t d8 -j 48 -N 8 run.ckp 2>/dev/null | tr -d ' '; }
+
+# La misma corrida muere (SIGKILL) en cuanto su punto de control tiene algún avance (guardado cada segundo)
+./memorama $run --threads 2 --checkpoint run.ckp --checkpoint-interval 1 < /dev/null > cut.txt 2>&1 &
+sim=$!
+for i in $(seq 1 300); do [ "$(completed)" -gt 0 ] 2>/dev/null && break; sleep 0.1; done
+kill -9 "$sim" 2>/dev/null || { echo "FALLO: la simulacion termino antes del corte; usa mas partidas"; exit 1; }
+wait "$sim" 2>/dev/null || true
+if [ ! -s run.ckp ]; then echo "FALLO: no quedo punto de control"; exit 1; fi
+done=$(completed)
+if [ "$done" -lt 1 ] || [ "$done" -ge 245 ]; then echo "FALLO: el corte dejo $done de 245 fragmentos; se esperaba un avance parcial"; exit 1; fi
+cp run.ckp partial.ckp
+
+# Reanudar con otro número de hilos combina los fragmentos en el mismo orden
+./memorama --resume run.ckp --threads 3 < /dev/null > resumed.txt
+if [ -z "$(summary straight.txt)" ]; then echo "FALLO: la corrida de referencia no imprimio resumen"; exit 1; fi
+if [ "$(summary straight.txt)" != "$(summary resumed.txt)" ]; then
+    echo "FALLO: el resumen reanudado difiere"; summary straight.txt; summary resumed.txt; exit 1
+fi
+
+# Un punto de control truncado o de otra versión se rechaza
+head -c 40 partial.ckp > truncated.ckp
+if ./memorama --resume truncated.ckp < /dev/null > bad.txt 2>&1; then echo "FALLO: se reanudo un punto de control truncado"; exit 1; fi
+cp partial.ckp version.ckp; printf '\001' | dd of=version.ckp bs=1 seek=8 conv=notrunc 2>/dev/null
+if ./memorama --resume version.ckp < /dev/null > bad.txt 2>&1; then echo "FALLO: se reanudo un punto de control de otra version"; exit 1; fi
+
+echo "OK"
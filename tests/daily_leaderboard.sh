@@ -0,0 +1,71 @@
+#!/bin/sh
+# Prueba: la clasificación del desafío diario ordena, da lugares, serializa escritores y solo recibe partidas completas.
+# Uso: sh tests/daily_leaderboard.sh   (desde la raíz del repositorio)
+set -ef
+
+root=$(pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+g++ -std=c++17 -O2 -pthread main.cpp -o "$work/memorama"
+
+# Inserta con la misma biblioteca: seed <archivo> <día> <movimientos[:errores]>... imprime el lugar de cada una;
+# "?M" solo consulta el lugar que tendría M movimientos
+cat > "$work/seed.cpp" <<'CPP'
+#include "main.cpp"
+int main(int argc, char* argv[]){
+    Leaderboard board;
+    try { openLeaderboard(board, argv[1], static_cast<uint32_t>(std::stoul(argv[2]))); }
+    catch (const std::exception& error){ std::printf("rechazada\n"); return 1; }
+    for (int i = 3; i < argc; i++){
+        std::string entry = argv[i];
+        if (entry[0] == '?'){ std::printf("%llu\n", static_cast<unsigned long long>(leaderRank(board, std::stoi(entry.substr(1)), 0, 60))); continue; }
+        size_t colon = entry.find(':');
+        int errors = colon == std::string::npos ? 0 : std::stoi(entry.substr(colon + 1));
+        std::printf("%llu\n", static_cast<unsigned long long>(insertLeaderEntry(board, "Semilla " + std::to_string(i - 2), std::stoi(entry), errors, 60)));
+    }
+    closeLeaderboard(board);
+    return 0;
+}
+CPP
+g++ -std=c++17 -O2 -pthread -DMEMORAMA_LIBRARY -I "$root" "$work/seed.cpp" -o "$work/seed"
+cd "$work"
+
+# Lugares al insertar: menos movimientos primero, luego menos errores, y en empate total el que llegó antes
+places=$(./seed order.top 20260102 30 40 35 20 30 30:2 30:1 ?30 ?19 | tr '\n' ' ')
+if [ "$places" != "1 2 2 1 3 4 4 2 1 " ]; then echo "FALLO: lugares '$places', se esperaba '1 2 2 1 3 4 4 2 1 '"; exit 1; fi
+./memorama --leaderboard --date 20260102 > /dev/null 2>&1 && { echo "FALLO: --leaderboard leyo un dia sin archivo"; exit 1; }
+cp order.top memorama-20260102.top
+./memorama --leaderboard --date 20260102 > top.txt
+order=$(grep -oE "Semilla [0-9]+" top.txt | awk '{printf "%s ", $2}')
+if [ "$order" != "4 1 5 7 6 3 2 " ]; then echo "FALLO: orden '$order', se esperaba '4 1 5 7 6 3 2 '"; exit 1; fi
+
+# Un archivo ajeno se rechaza sin modificarlo
+printf 'no es una clasificacion' > foreign.top
+foreign=$(cksum < foreign.top)
+if [ "$(./seed foreign.top 20260101 30)" != "rechazada" ] || [ "$(cksum < foreign.top)" != "$foreign" ]; then echo "FALLO: se acepto o modifico un archivo ajeno"; exit 1; fi
+
+# Dos procesos a la vez: el flock los serializa y no se pierde ni se mezcla ninguna entrada
+set +f
+a=""; b=""; for i in $(seq 1 1500); do a="$a $((i % 97 + 18))"; b="$b $((i % 89 + 18))"; done
+./seed race.top 20260103 $a > /dev/null & first=$!
+./seed race.top 20260103 $b > /dev/null & second=$!
+wait "$first"; wait "$second"
+set -f
+cp race.top memorama-20260103.top
+./memorama --leaderboard --date 20260103 --top 3000 > race.txt
+if ! grep -q "Participantes: 3000 " race.txt; then echo "FALLO: escritores concurrentes perdieron entradas: $(grep -o 'Participantes: [0-9]*' race.txt)"; exit 1; fi
+if ! grep -E "^ *\* +[0-9]+ +Semilla" race.txt | awk '{print $5}' | sort -n -c; then echo "FALLO: escritores concurrentes desordenaron la lista"; exit 1; fi
+if [ "$(grep -cE "^ *\* +[0-9]+ +Semilla" race.txt)" != "3000" ]; then echo "FALLO: la lista no recorre las 3000 entradas"; exit 1; fi
+
+# Clasificación del día con dos partidas completas
+./seed memorama-20260101.top 20260101 30 40 > /dev/null
+before=$(cksum < memorama-20260101.top)
+
+# Partida del día perdida por tiempo: el reloj mínimo cae antes de la primera carta
+printf 'Ana\nBeto\n' | ./memorama --daily --date 20260101 --clock 0.01+0 > forfeit.txt 2>&1
+if [ "$(cksum < memorama-20260101.top)" != "$before" ]; then echo "FALLO: la partida perdida por tiempo modifico la clasificacion"; exit 1; fi
+./memorama --leaderboard --date 20260101 > top.txt
+if ! grep -q "Participantes: 2 " top.txt || grep -q "Ana / Beto" top.txt; then echo "FALLO: la partida perdida por tiempo entro en la clasificacion"; exit 1; fi
+
+echo "OK"
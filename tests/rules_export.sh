@@ -0,0 +1,40 @@
+#!/bin/sh
+# Prueba: una variante con puntos negativos pasa por --export y --analyze sin desbordar las columnas.
+# Uso: sh tests/rules_export.sh   (desde la raíz del repositorio)
+set -ef
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+g++ -std=c++17 -O2 -pthread main.cpp -o "$work/memorama"
+
+# aleatoria contra memoria con penalización: el Jugador 1 pierde todas y acumula puntos negativos
+"$work/memorama" --simulate 5000 --seed 11 --rules penalizada --strategies aleatoria,memoria --export "$work/export" > "$work/simulate.txt" < /dev/null
+
+# Extrae "Partidas" y "Victorias J1" de la fila de un grupo
+row() { grep -E "^ *\* +$1 " "$work/analyze.txt" | awk '{print $3, $(NF-1)}'; }
+
+# Ninguna partida llega a 200 puntos
+"$work/memorama" --analyze "$work/export" --where "points1>=200" > "$work/analyze.txt" < /dev/null
+if [ -n "$(row Todas)" ]; then echo "FALLO: points1>=200 selecciono filas: $(row Todas)"; exit 1; fi
+
+# El Jugador 1 no gana ninguna partida
+"$work/memorama" --analyze "$work/export" > "$work/analyze.txt" < /dev/null
+set -- $(row Todas)
+if [ "$1" != "5000" ] || [ "$2" != "0.0%" ]; then echo "FALLO: sin filtro dio '$*', se esperaba '5000 0.0%'"; exit 1; fi
+
+# La mayoría de sus partidas terminan bajo cero
+"$work/memorama" --analyze "$work/export" --where "points1<0" > "$work/analyze.txt" < /dev/null
+set -- $(row Todas)
+if [ -z "$1" ] || [ "$1" -lt 2500 ] || [ "$2" != "0.0%" ]; then echo "FALLO: points1<0 dio '$*'"; exit 1; fi
+
+# Agrupar muestra los puntos con su signo
+"$work/memorama" --analyze "$work/export" --group-by points1 > "$work/analyze.txt" < /dev/null
+if ! grep -qE "^ *\* +-[0-9]+ " "$work/analyze.txt"; then echo "FALLO: --group-by points1 no muestra puntos negativos"; exit 1; fi
+
+# El margen medio cae dentro del histograma: la mediana no se sale del rango observado
+p50=$(grep -E "^ *\* +Margen " "$work/simulate.txt" | awk '{print $7}')
+mean=$(grep -E "^ *\* +Margen " "$work/simulate.txt" | awk '{print $3}')
+awk -v p="$p50" -v m="$mean" 'BEGIN {d = p - m; if (d < 0) d = -d; exit !(d < 3)}' || { echo "FALLO: margen p50 $p50 lejos de la media $mean"; exit 1; }
+
+echo "OK"
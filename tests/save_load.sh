@@ -0,0 +1,46 @@
+#!/bin/sh
+# Prueba: una partida guardada se continúa tal cual y un guardado dañado se rechaza.
+# Uso: sh tests/save_load.sh   (desde la raíz del repositorio)
+set -ef
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+g++ -std=c++17 -O2 -pthread main.cpp -o "$work/memorama"
+cd "$work"
+
+# Una partida de un movimiento: el guardado automático aparece al completarlo
+printf 'Ana\nBeto\n0\n0\n0\n1\n' | ./memorama > play.txt 2>&1 &
+game=$!
+for i in $(seq 1 300); do [ -f memorama.sav ] && break; sleep 0.1; done
+kill "$game" 2>/dev/null || true
+wait "$game" 2>/dev/null || true
+if [ ! -f memorama.sav ]; then echo "FALLO: no se escribio memorama.sav"; exit 1; fi
+cp memorama.sav good.sav
+
+# Continuar restaura nombres y contadores (un reloj mínimo termina la partida sin más entrada)
+./memorama --continue --clock 0.01+0 < /dev/null > continue.txt 2>&1
+if grep -q "No hay Partida Guardada" continue.txt; then echo "FALLO: el guardado valido se rechazo"; exit 1; fi
+if ! grep -q "Ana : " continue.txt || ! grep -q "Beto : " continue.txt; then echo "FALLO: --continue no restauro los nombres"; exit 1; fi
+if ! grep -qE "Movimientos totales : 1 " continue.txt; then echo "FALLO: --continue no restauro los movimientos"; exit 1; fi
+if [ -f memorama.sav ]; then echo "FALLO: la partida terminada dejo su guardado"; exit 1; fi
+
+# Escribe bytes en una copia del guardado válido: patch <desplazamiento> <bytes en printf>
+patch() { cp good.sav memorama.sav; printf "$2" | dd of=memorama.sav bs=1 seek="$1" conv=notrunc 2>/dev/null; }
+
+# Cada guardado dañado se rechaza y se pide una partida nueva
+rejects() {
+
+    printf 'Carla\nDani\n' | timeout 3 ./memorama --continue > reject.txt 2>&1 || true
+    if ! grep -q "No hay Partida Guardada" reject.txt; then echo "FALLO: se acepto un guardado con $1"; exit 1; fi
+
+}
+patch 12 'Z';       rejects "una letra fuera de A-R"
+patch 12 'AAA';     rejects "una letra tres veces"
+patch 48 '?';       rejects "una carta visible que no es la del tablero"
+patch 84 '\005';    rejects "puntos sin parejas descubiertas"
+patch 92 '\007';    rejects "un turno fuera de 1-2"
+patch 99 '\377';    rejects "movimientos negativos"
+cp good.sav memorama.sav; head -c 60 good.sav > memorama.sav; rejects "un archivo truncado"
+
+echo "OK"